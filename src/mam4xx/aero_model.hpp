@@ -628,6 +628,32 @@ void modal_aero_bcscavcoef_init(
 
 } // modal_aero_bcscavcoef_init
 
+// Version of the integration done by modal_aero_bcscavcoef_init, recorded in
+// the table generated by bcscavcoef_table_generator. Increment it whenever the
+// integration changes, so a stale generated table fails to compile.
+constexpr int bcscavcoef_table_version = 1;
+
+// Sets the mode parameters for which WetDeposition uses the impaction
+// scavenging table: the nominal diameters and widths of the modes, and the
+// aerosol dry densities of the original code. The table for these parameters
+// is generated at build time (see bcscavcoef_table.hpp). This is a host
+// function.
+inline void
+bcscavcoef_mode_parameters(Real dgnum_amode[AeroConfig::num_modes()],
+                           Real sigmag_amode[AeroConfig::num_modes()],
+                           Real aerosol_dry_density[AeroConfig::num_modes()]) {
+  for (int imode = 0; imode < AeroConfig::num_modes(); ++imode) {
+    dgnum_amode[imode] = modes(imode).nom_diameter;
+    sigmag_amode[imode] = modes(imode).mean_std_dev;
+  }
+  // Note: Original code uses the following aerosol densities.
+  // sulfate, sulfate, dust, p-organic
+  aerosol_dry_density[0] = mam4::mam4_density_so4;
+  aerosol_dry_density[1] = mam4::mam4_density_so4;
+  aerosol_dry_density[2] = mam4::mam4_density_dst;
+  aerosol_dry_density[3] = mam4::mam4_density_pom;
+}
+
 // =============================================================================
 KOKKOS_INLINE_FUNCTION
 void define_act_frac(const int lphase, const int imode, Real &sol_facti,
@@ -64,4 +64,32 @@ std::string aero_id_str(const AeroId aid) {
   }
 }
 
+std::string gas_id_str(const GasId gid) {
+  switch (gid) {
+  case (GasId::O3): {
+    return "ozone";
+  }
+  case (GasId::H2O2): {
+    return "hydrogen_peroxide";
+  }
+  case (GasId::H2SO4): {
+    return "sulfuric_acid";
+  }
+  case (GasId::SO2): {
+    return "sulfur_dioxide";
+  }
+  case (GasId::DMS): {
+    return "dimethyl_sulfide";
+  }
+  case (GasId::SOAG): {
+    return "soa_precursor";
+  }
+  case (GasId::None): {
+    return "none";
+  }
+  default:
+    return "invalid_gas_id";
+  }
+}
+
 } // namespace mam4
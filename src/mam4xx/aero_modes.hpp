@@ -105,8 +105,12 @@ static constexpr Real mam4_primary_carbon_mead_std_dev = 1.6;
 /// https://eagles-project.atlassian.net/wiki/spaces/Computation/pages/354877515/Module+verifications
 /// NOTE: These data are found on Anvil in
 /// NOTE: /lcrc/group/acme/ccsm-data/inputdata/atm/cam/physprops/
-KOKKOS_INLINE_FUNCTION const mam4::Mode &modes(const int i) {
-  static const mam4::Mode M[4] = {
+/// NOTE: The metadata in this file are constexpr tables (local to constexpr
+/// NOTE: functions, which are usable on devices) rather than function-local
+/// NOTE: statics, so calls with known indices fold to constants, and others
+/// NOTE: need no thread-safe initialization guards.
+KOKKOS_INLINE_FUNCTION constexpr mam4::Mode modes(const int i) {
+  constexpr mam4::Mode M[4] = {
       // accumulation
       {mam4_accum_min_diameter_m, mam4_accum_nom_diameter_m,
        mam4_accum_max_diameter_m, mam4_accum_mead_std_dev,
@@ -124,6 +128,81 @@ KOKKOS_INLINE_FUNCTION const mam4::Mode &modes(const int i) {
        mam4_primary_carbon_max_diameter_m, mam4_primary_carbon_mead_std_dev,
        mam4_crystallization_rel_hum, mam4_delequesence_rel_hum}};
   return M[i];
+}
+
+/// Factors of the log-normal size distributions of the modes that depend only
+/// on the logs of their geometric standard deviations: the moment factors of
+/// the diameter/volume conversions and the terms of the Gauss-Hermite
+/// quadrature in gasaerexch::gas_aer_uptkrates_1box1gas. These are fixed for
+/// a run, so processes compute them once in init instead of at every level.
+/// The diameter ratios at the quadrature points are only computed by
+/// set_quadrature_abscissae.
+struct ModeLognormalFactors {
+  static constexpr int num_modes = 4;
+  static constexpr int max_quadrature_points = 20;
+  Real alnsg[num_modes] = {};        // ln(sigma_g)
+  Real alnsg_sq[num_modes] = {};     // ln^2(sigma_g)
+  Real root2_alnsg[num_modes] = {};  // sqrt(2) ln(sigma_g)
+  Real exp45logsig[num_modes] = {};  // exp(4.5 ln^2(sigma_g))
+  Real expm15logsig[num_modes] = {}; // exp(-1.5 ln^2(sigma_g))
+  int num_quadrature_points = 0;
+  // exp(sqrt(2) ln(sigma_g) x) at the quadrature abscissae x (the first
+  // num_quadrature_points are set)
+  Real quadrature_dp_ratio[num_modes][max_quadrature_points];
+
+  /// Computes the factors of the modes of modes().
+  KOKKOS_INLINE_FUNCTION
+  ModeLognormalFactors() {
+    Real lnsg[num_modes];
+    for (int m = 0; m < num_modes; ++m)
+      lnsg[m] = haero::log(modes(m).mean_std_dev);
+    set(lnsg);
+  }
+
+  /// Computes the factors of modes with the given ln(sigma_g).
+  KOKKOS_INLINE_FUNCTION
+  explicit ModeLognormalFactors(const Real lnsg[num_modes]) { set(lnsg); }
+
+  /// Returns the geometric mean diameter [m] of mode m given its mean particle
+  /// volume [m3] (see conversions::mean_particle_diameter_from_volume)
+  KOKKOS_INLINE_FUNCTION
+  Real diameter_from_volume(const int m, const Real mean_volume) const {
+    const double pio6 = haero::Constants::pi_sixth;
+    return haero::cbrt(mean_volume / pio6) * expm15logsig[m];
+  }
+
+  /// Returns the mean particle volume [m3] of mode m given its geometric mean
+  /// diameter [m] (see conversions::mean_particle_volume_from_diameter)
+  KOKKOS_INLINE_FUNCTION
+  Real volume_from_diameter(const int m, const Real diameter) const {
+    const double pio6 = haero::Constants::pi_sixth;
+    return haero::cube(diameter) * exp45logsig[m] * pio6;
+  }
+
+  /// Computes the ratios of the diameters at the given Gauss-Hermite
+  /// quadrature abscissae to the center diameter of each mode.
+  template <std::size_t N>
+  KOKKOS_INLINE_FUNCTION void
+  set_quadrature_abscissae(const Kokkos::Array<Real, N> &abscissae) {
+    static_assert(N <= max_quadrature_points,
+                  "too many quadrature points for ModeLognormalFactors");
+    num_quadrature_points = N;
+    for (int m = 0; m < num_modes; ++m)
+      for (std::size_t iq = 0; iq < N; ++iq)
+        quadrature_dp_ratio[m][iq] = haero::exp(root2_alnsg[m] * abscissae[iq]);
+  }
+
+private:
+  KOKKOS_INLINE_FUNCTION
+  void set(const Real lnsg[num_modes]) {
+    for (int m = 0; m < num_modes; ++m) {
+      alnsg[m] = lnsg[m];
+      alnsg_sq[m] = haero::square(lnsg[m]);
+      root2_alnsg[m] = haero::sqrt(2.0) * lnsg[m];
+      exp45logsig[m] = haero::exp(4.5 * alnsg_sq[m]);
+      expm15logsig[m] = haero::exp(-1.5 * alnsg_sq[m]);
+    }
+  }
 };
 
 /// Identifiers for aerosol species that inhabit MAM4 modes.
@@ -190,8 +269,8 @@ static constexpr Real mam4_hyg_mom = 0.1;
   substances, differ from the values provided by NIST; these, too, are listed
   here as mam4_* constants.
 */
-KOKKOS_INLINE_FUNCTION AeroSpecies aero_species(const int i) {
-  static const AeroSpecies species[7] = {
+KOKKOS_INLINE_FUNCTION constexpr AeroSpecies aero_species(const int i) {
+  constexpr AeroSpecies species[7] = {
       AeroSpecies{Constants::molec_weight_c, mam4_density_soa,
                   mam4_hyg_soa}, // secondary organic aerosol
       AeroSpecies{Constants::molec_weight_so4, mam4_density_so4, mam4_hyg_so4},
@@ -209,11 +288,26 @@ KOKKOS_INLINE_FUNCTION AeroSpecies aero_species(const int i) {
   return species[i];
 }
 
+/// Returns the inverse density [m3/kg] of the aerosol species with the given
+/// index (see AeroId)
+KOKKOS_INLINE_FUNCTION constexpr Real aero_species_inv_density(const int i) {
+  constexpr Real inv_density[7] = {
+      1.0 / mam4_density_soa,  // secondary organic aerosol
+      1.0 / mam4_density_so4,  // sulphate
+      1.0 / mam4_density_pom,  // primary organic matter
+      1.0 / mam4_density_bc,   // black carbon
+      1.0 / mam4_density_nacl, // sodium chloride
+      1.0 / mam4_density_dst,  // dust
+      1.0 / mam4_density_mom   // marine organic matter
+  };
+  return inv_density[i];
+}
+
 // A list of species within each mode for MAM4.
-KOKKOS_INLINE_FUNCTION AeroId mode_aero_species(const int modeNo,
-                                                const int speciesNo) {
+KOKKOS_INLINE_FUNCTION constexpr AeroId mode_aero_species(const int modeNo,
+                                                          const int speciesNo) {
   // A list of species within each mode for MAM4.
-  static constexpr AeroId mode_aero_species[4][7] = {
+  constexpr AeroId mode_aero_species[4][7] = {
       {// accumulation mode
        AeroId::SOA, AeroId::SO4, AeroId::POM, AeroId::BC, AeroId::NaCl,
        AeroId::DST, AeroId::MOM},
@@ -238,27 +332,62 @@ KOKKOS_INLINE_FUNCTION AeroId mode_aero_species(const int modeNo,
 }
 
 /// Returns number of species per mode
-KOKKOS_INLINE_FUNCTION int num_species_mode(const int i) {
-  static constexpr int _num_species_mode[4] = {7, 4, 7, 3};
+KOKKOS_INLINE_FUNCTION constexpr int num_species_mode(const int i) {
+  constexpr int _num_species_mode[4] = {7, 4, 7, 3};
   return _num_species_mode[i];
 }
 
+/// Returns the inverse density [m3/kg] of the species with the given index
+/// within the given mode (see mode_aero_species)
+KOKKOS_INLINE_FUNCTION constexpr Real
+mode_species_inv_density(const int modeNo, const int speciesNo) {
+  return aero_species_inv_density(
+      static_cast<int>(mode_aero_species(modeNo, speciesNo)));
+}
+
 /// Returns the index of the given aerosol species within the given mode, or
 /// -1 if the species is not found within the mode.
-KOKKOS_INLINE_FUNCTION
-int aerosol_index_for_mode(ModeIndex mode, AeroId aero_id) {
-  int mode_index = static_cast<int>(mode);
-  for (int s = 0; s < 7; ++s) {
-    if (aero_id == mode_aero_species(mode_index, s)) {
-      return s;
+KOKKOS_INLINE_FUNCTION constexpr int aerosol_index_for_mode(ModeIndex mode,
+                                                            AeroId aero_id) {
+  // index of each species (by AeroId) within each mode
+  constexpr int aerosol_index[4][7] = {
+      {0, 1, 2, 3, 4, 5, 6},       // accumulation mode
+      {0, 1, -1, -1, 2, -1, 3},    // aitken mode
+      {0, 1, 2, 3, 4, 5, 6},       // coarse mode
+      {-1, -1, 0, 1, -1, -1, 2}}; // primary carbon mode
+  return (aero_id == AeroId::None)
+             ? -1
+             : aerosol_index[static_cast<int>(mode)][static_cast<int>(aero_id)];
+}
+
+namespace detail {
+// returns true iff aerosol_index_for_mode inverts mode_aero_species
+constexpr bool aerosol_indices_consistent() {
+  for (int m = 0; m < 4; ++m) {
+    for (int a = 0; a < 7; ++a) {
+      const int s = aerosol_index_for_mode(static_cast<ModeIndex>(m),
+                                           static_cast<AeroId>(a));
+      if (s != -1 &&
+          (s >= num_species_mode(m) ||
+           mode_aero_species(m, s) != static_cast<AeroId>(a)))
+        return false;
+      if (s == -1) {
+        for (int i = 0; i < num_species_mode(m); ++i)
+          if (mode_aero_species(m, i) == static_cast<AeroId>(a))
+            return false;
+      }
     }
   }
-  return -1;
+  return true;
 }
+} // namespace detail
+static_assert(detail::aerosol_indices_consistent(),
+              "aerosol_index_for_mode doesn't match mode_aero_species");
+
 /// Convenient function that returns bool indicating if species is
 /// within mode.
-KOKKOS_INLINE_FUNCTION
-bool mode_contains_species(ModeIndex mode, AeroId aero_id) {
+KOKKOS_INLINE_FUNCTION constexpr bool mode_contains_species(ModeIndex mode,
+                                                            AeroId aero_id) {
   return -1 != aerosol_index_for_mode(mode, aero_id);
 }
 
@@ -273,6 +402,10 @@ enum class GasId {
   None = 6,  // invalid gas id
 };
 
+/// Map GasId to string (for logging, e.g.)
+/// This function cannot be called inside a GPU kernel.
+std::string gas_id_str(const GasId gid);
+
 /// Molecular weight of carbon dioxide [kg/mol]
 static constexpr Real molec_weight_co2 = 0.0440095;
 /// Molecular weight of methane @f$\text{CH}_4@f$
@@ -295,8 +428,8 @@ static constexpr Real molec_weight_o3 = 0.0479982;
 static constexpr Real molec_weight_so2 = 0.06407;
 
 /// A list of gas species in MAM4.
-KOKKOS_INLINE_FUNCTION GasSpecies gas_species(const int i) {
-  static const GasSpecies species[13] = {
+KOKKOS_INLINE_FUNCTION constexpr GasSpecies gas_species(const int i) {
+  constexpr GasSpecies species[13] = {
       {molec_weight_o3},               // ozone
       {molec_weight_h2o2},             // hydrogen peroxide
       {Constants::molec_weight_h2so4}, // sulfuric acid
@@ -7,6 +7,7 @@
 #define MAM4XX_AGING_HPP
 #include <haero/math.hpp>
 #include <mam4xx/aero_config.hpp>
+#include <mam4xx/utils.hpp>
 
 namespace mam4 {
 
@@ -29,6 +30,23 @@ public:
   // name -- unique name of the process implemented by this class
   const char *name() const { return "MAM4 aging"; }
 
+  // memory_footprint -- bytes of device memory held by this process
+  std::size_t memory_footprint() const { return 0; }
+
+  // field_access -- groups of fields read and written by compute_tendencies
+  KOKKOS_INLINE_FUNCTION
+  static constexpr FieldAccess field_access() {
+    return {field::interstitial_aerosols,
+            field::interstitial_aerosols | field::level_work_arrays};
+  }
+
+  // prognostic_update -- compute_tendencies updates the prognostics in place,
+  // and the tendencies it sets only report the change
+  KOKKOS_INLINE_FUNCTION
+  static constexpr PrognosticUpdate prognostic_update() {
+    return PrognosticUpdate::in_place;
+  }
+
   // init -- initializes the implementation with MAM4's configuration
   void init(const AeroConfig &aero_config,
             const Config &process_config = Config());
@@ -430,11 +448,29 @@ void Aging::compute_tendencies(const AeroConfig &config, const ThreadTeam &team,
 
   const int nk = atm.num_levels();
 
-  Kokkos::parallel_for(
-      Kokkos::TeamThreadRange(team, nk), KOKKOS_CLASS_LAMBDA(int k) {
+  // Aging only transfers (a fraction of) primary carbon mode number and mass
+  // to the accumulation mode, so levels without any primary carbon aerosol
+  // are left unchanged.
+  const int ipc = static_cast<int>(ModeIndex::PrimaryCarbon);
+  const auto is_active = [&](int k) {
+    if (progs.n_mode_i[ipc](k) != 0) {
+      return true;
+    }
+    for (int ispec = 0; ispec < AeroConfig::num_aerosol_ids(); ++ispec) {
+      if (progs.q_aero_i[ipc][ispec](k) != 0) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  const int num_skipped = utils::for_each_active_level(
+      team, nk, diags.active_levels, is_active, [&](int k) {
         aging::aerosol_aging_rates_1box(k, config, dt, atm, progs, diags, tends,
                                         config_);
       });
+  utils::add_to_counter(team, diags.num_skipped_levels,
+                        Diagnostics::aging_skipped_levels, num_skipped);
 }
 
 } // namespace mam4
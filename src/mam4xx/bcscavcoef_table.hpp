@@ -0,0 +1,110 @@
+// mam4xx: Copyright (c) 2022,
+// Battelle Memorial Institute and
+// National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef MAM4XX_BCSCAVCOEF_TABLE_HPP
+#define MAM4XX_BCSCAVCOEF_TABLE_HPP
+
+#include <mam4xx/aero_config.hpp>
+#include <mam4xx/aero_model.hpp>
+
+// generated at build time by bcscavcoef_table_generator
+#include <mam4xx/bcscavcoef_table_data.hpp>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace mam4 {
+
+namespace aero_model {
+
+static_assert(bcscavcoef_data::version == bcscavcoef_table_version,
+              "bcscavcoef_table_data.hpp is stale: rebuild it with "
+              "bcscavcoef_table_generator");
+
+// The lookup table of impaction scavenging rates computed by
+// modal_aero_bcscavcoef_init for given mode parameters
+struct BcScavCoefTable {
+  // mode parameters the table is computed for
+  Real dgnum_amode[AeroConfig::num_modes()];
+  Real sigmag_amode[AeroConfig::num_modes()];
+  Real aerosol_dry_density[AeroConfig::num_modes()];
+  // log of the scavenging rates of aerosol number and volume [1/h]
+  Real scavimptblnum[nimptblgrow_total][AeroConfig::num_modes()];
+  Real scavimptblvol[nimptblgrow_total][AeroConfig::num_modes()];
+
+  // returns true iff the table is computed for the given mode parameters
+  bool matches(const Real dgnum[AeroConfig::num_modes()],
+               const Real sigmag[AeroConfig::num_modes()],
+               const Real dry_density[AeroConfig::num_modes()]) const {
+    for (int imode = 0; imode < AeroConfig::num_modes(); ++imode) {
+      if (dgnum_amode[imode] != dgnum[imode] ||
+          sigmag_amode[imode] != sigmag[imode] ||
+          aerosol_dry_density[imode] != dry_density[imode])
+        return false;
+    }
+    return true;
+  }
+};
+
+// Returns the impaction scavenging table generated at build time for the mode
+// parameters of bcscavcoef_mode_parameters. This is a host function.
+inline const BcScavCoefTable &default_bcscavcoef_table() {
+  static const BcScavCoefTable table = []() {
+    BcScavCoefTable t;
+    for (int imode = 0; imode < AeroConfig::num_modes(); ++imode) {
+      t.dgnum_amode[imode] = bcscavcoef_data::dgnum_amode[imode];
+      t.sigmag_amode[imode] = bcscavcoef_data::sigmag_amode[imode];
+      t.aerosol_dry_density[imode] =
+          bcscavcoef_data::aerosol_dry_density[imode];
+      for (int jgrow = 0; jgrow < nimptblgrow_total; ++jgrow) {
+        t.scavimptblnum[jgrow][imode] =
+            bcscavcoef_data::scavimptblnum[jgrow][imode];
+        t.scavimptblvol[jgrow][imode] =
+            bcscavcoef_data::scavimptblvol[jgrow][imode];
+      }
+    }
+    return t;
+  }();
+  return table;
+}
+
+// Returns the impaction scavenging table for the given mode parameters. For
+// the parameters of bcscavcoef_mode_parameters this is the table generated at
+// build time. For any other parameters, the numerical integration of
+// modal_aero_bcscavcoef_init is done the first time they are seen, and its
+// table is shared by all later callers. This is a host function.
+inline const BcScavCoefTable &
+bcscavcoef_table(const Real dgnum_amode[AeroConfig::num_modes()],
+                 const Real sigmag_amode[AeroConfig::num_modes()],
+                 const Real aerosol_dry_density[AeroConfig::num_modes()]) {
+  const BcScavCoefTable &default_table = default_bcscavcoef_table();
+  if (default_table.matches(dgnum_amode, sigmag_amode, aerosol_dry_density))
+    return default_table;
+
+  static std::mutex mutex;
+  static std::vector<std::unique_ptr<BcScavCoefTable>> tables;
+  std::lock_guard<std::mutex> lock(mutex);
+  for (const auto &table : tables) {
+    if (table->matches(dgnum_amode, sigmag_amode, aerosol_dry_density))
+      return *table;
+  }
+  auto table = std::make_unique<BcScavCoefTable>();
+  for (int imode = 0; imode < AeroConfig::num_modes(); ++imode) {
+    table->dgnum_amode[imode] = dgnum_amode[imode];
+    table->sigmag_amode[imode] = sigmag_amode[imode];
+    table->aerosol_dry_density[imode] = aerosol_dry_density[imode];
+  }
+  modal_aero_bcscavcoef_init(dgnum_amode, sigmag_amode, aerosol_dry_density,
+                             table->scavimptblnum, table->scavimptblvol);
+  tables.push_back(std::move(table));
+  return *tables.back();
+}
+
+} // end namespace aero_model
+
+} // end namespace mam4
+
+#endif
@@ -0,0 +1,113 @@
+// mam4xx: Copyright (c) 2022,
+// Battelle Memorial Institute and
+// National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+// SPDX-License-Identifier: BSD-3-Clause
+
+// bcscavcoef_table_generator integrates the impaction scavenging table of
+// aero_model::modal_aero_bcscavcoef_init for the mode parameters of
+// aero_model::bcscavcoef_mode_parameters, and writes it to a header of
+// constexpr arrays that aero_model::default_bcscavcoef_table loads. The values
+// are written as hexadecimal floating point literals, so the generated table
+// is bitwise identical to the integrated one.
+
+#include <mam4xx/aero_model.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace mam4;
+
+namespace {
+
+constexpr int num_modes = AeroConfig::num_modes();
+
+// returns the exact hexadecimal floating point literal for the given value
+std::string hex_literal(const Real value) {
+  char buf[64];
+  std::snprintf(buf, sizeof(buf), "%a", static_cast<double>(value));
+  return buf;
+}
+
+void write_array(std::ofstream &out, const char *name,
+                 const Real values[num_modes]) {
+  out << "constexpr Real " << name << "[AeroConfig::num_modes()] = {";
+  for (int imode = 0; imode < num_modes; ++imode)
+    out << (imode ? ", " : "") << hex_literal(values[imode]);
+  out << "};\n";
+}
+
+void write_table(std::ofstream &out, const char *name,
+                 const Real values[aero_model::nimptblgrow_total][num_modes]) {
+  out << "constexpr Real " << name
+      << "[aero_model::nimptblgrow_total][AeroConfig::num_modes()] = {\n";
+  for (int jgrow = 0; jgrow < aero_model::nimptblgrow_total; ++jgrow) {
+    out << "    {";
+    for (int imode = 0; imode < num_modes; ++imode)
+      out << (imode ? ", " : "") << hex_literal(values[jgrow][imode]);
+    out << "},\n";
+  }
+  out << "};\n";
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  if (argc != 2) {
+    std::cerr << "usage: bcscavcoef_table_generator <output header>"
+              << std::endl;
+    return 1;
+  }
+
+  Real dgnum_amode[num_modes], sigmag_amode[num_modes],
+      aerosol_dry_density[num_modes];
+  aero_model::bcscavcoef_mode_parameters(dgnum_amode, sigmag_amode,
+                                         aerosol_dry_density);
+  Real scavimptblnum[aero_model::nimptblgrow_total][num_modes];
+  Real scavimptblvol[aero_model::nimptblgrow_total][num_modes];
+  aero_model::modal_aero_bcscavcoef_init(dgnum_amode, sigmag_amode,
+                                         aerosol_dry_density, scavimptblnum,
+                                         scavimptblvol);
+  for (int jgrow = 0; jgrow < aero_model::nimptblgrow_total; ++jgrow) {
+    for (int imode = 0; imode < num_modes; ++imode) {
+      if (!std::isfinite(scavimptblnum[jgrow][imode]) ||
+          !std::isfinite(scavimptblvol[jgrow][imode])) {
+        std::cerr << "bcscavcoef_table_generator: non-finite scavenging rate"
+                  << " for mode " << imode << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  std::ofstream out(argv[1]);
+  if (!out) {
+    std::cerr << "bcscavcoef_table_generator: can't write " << argv[1]
+              << std::endl;
+    return 1;
+  }
+  out << "// Generated by bcscavcoef_table_generator. Do not edit.\n"
+      << "#ifndef MAM4XX_BCSCAVCOEF_TABLE_DATA_HPP\n"
+      << "#define MAM4XX_BCSCAVCOEF_TABLE_DATA_HPP\n\n"
+      << "#include <mam4xx/aero_config.hpp>\n"
+      << "#include <mam4xx/aero_model.hpp>\n\n"
+      << "namespace mam4 {\n\n"
+      << "namespace aero_model {\n\n"
+      << "namespace bcscavcoef_data {\n\n"
+      << "// aero_model::bcscavcoef_table_version of the integration\n"
+      << "constexpr int version = " << aero_model::bcscavcoef_table_version
+      << ";\n\n"
+      << "// mode parameters\n";
+  write_array(out, "dgnum_amode", dgnum_amode);
+  write_array(out, "sigmag_amode", sigmag_amode);
+  write_array(out, "aerosol_dry_density", aerosol_dry_density);
+  out << "\n// log of the scavenging rates of aerosol number and volume\n";
+  write_table(out, "scavimptblnum", scavimptblnum);
+  write_table(out, "scavimptblvol", scavimptblvol);
+  out << "\n} // end namespace bcscavcoef_data\n\n"
+      << "} // end namespace aero_model\n\n"
+      << "} // end namespace mam4\n\n"
+      << "#endif\n";
+  return out ? 0 : 1;
+}
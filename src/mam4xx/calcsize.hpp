@@ -15,6 +15,9 @@
 #include <mam4xx/mam4_types.hpp>
 #include <mam4xx/utils.hpp>
 
+#include <cstdint>
+#include <type_traits>
+
 namespace mam4 {
 
 using haero::max;
@@ -590,10 +593,11 @@ void update_tends_flx(const int klev,          // in
 
 /*
  * \brief Exchange aerosols between aitken and accumulation modes based on new
-    sizes.
+    sizes. Returns true if particles were transferred (i.e. if tendencies
+    were updated), false if not.
  */
 KOKKOS_INLINE_FUNCTION
-void aitken_accum_exchange(
+bool aitken_accum_exchange(
     const int &k, const int &aitken_idx, const int &accum_idx,
     const bool noxf_acc2ait[AeroConfig::num_aerosol_ids()],
     const int n_common_species_ait_accum, const int *ait_spec_in_acc,
@@ -835,8 +839,41 @@ void aitken_accum_exchange(
     } // end if (acc2_ait_index)
   }   // end if (ait2acc_index+acc2_ait_index > 0)
 
+  return ait2acc_index + acc2_ait_index > 0;
 } // aitken_accum_exchange
 
+/*
+ * \brief Returns a hash of the inputs of calcsize at level k: the time step
+    and the interstitial and cloud-borne mass and number mixing ratios of all
+    modes. The hash is never 0, which marks a level whose results can't be
+    reused (see CalcSize::Config::reuse_unchanged_levels).
+ */
+KOKKOS_INLINE_FUNCTION
+std::uint64_t level_input_hash(const int k, const Real dt,
+                               const Prognostics &prognostics) {
+  using Bits = std::conditional_t<sizeof(Real) == sizeof(std::uint64_t),
+                                  std::uint64_t, std::uint32_t>;
+  // FNV-1a over the bits of each value, followed by an xor-shift so that
+  // differences in high bits also reach the low bits. Every step is
+  // invertible, so changing any single input always changes the hash.
+  std::uint64_t hash = 14695981039346656037ull;
+  const auto combine = [&](const Real x) {
+    const Bits bits = Kokkos::bit_cast<Bits>(x);
+    hash = (hash ^ bits) * 1099511628211ull;
+    hash ^= hash >> 29;
+  };
+  combine(dt);
+  for (int imode = 0; imode < AeroConfig::num_modes(); ++imode) {
+    combine(prognostics.n_mode_i[imode](k));
+    combine(prognostics.n_mode_c[imode](k));
+    for (int ispec = 0; ispec < num_species_mode(imode); ++ispec) {
+      combine(prognostics.q_aero_i[imode][ispec](k));
+      combine(prognostics.q_aero_c[imode][ispec](k));
+    }
+  }
+  return (hash != 0) ? hash : 1;
+}
+
 } // namespace calcsize
 
 /// @class CalcSize
@@ -849,8 +886,17 @@ public:
     bool do_aitacc_transfer;
     bool do_adjust;
 
+    // reuse the diameters computed at a level by the previous call if the
+    // inputs there haven't changed and no number adjustment or aitken <-->
+    // accumulation transfer was needed (which leaves the same diameters and
+    // zero tendencies). Requires the calcsize work arrays of the diagnostics,
+    // which must be used with a single CalcSize configuration.
+    bool reuse_unchanged_levels;
+
     // default constructor -- sets default values for parameters
-    Config() : do_aitacc_transfer(true), do_adjust(true) {}
+    Config()
+        : do_aitacc_transfer(true), do_adjust(true),
+          reuse_unchanged_levels(false) {}
 
     Config(const Config &) = default;
     ~Config() = default;
@@ -900,6 +946,23 @@ public:
   // name -- unique name of the process implemented by this class
   const char *name() const { return "MAM4 calcsize"; }
 
+  // memory_footprint -- bytes of device memory held by this process
+  std::size_t memory_footprint() const { return 0; }
+
+  // field_access -- groups of fields read and written by compute_tendencies
+  KOKKOS_INLINE_FUNCTION
+  static constexpr FieldAccess field_access() {
+    return {field::interstitial_aerosols | field::cloudborne_aerosols,
+            field::interstitial_aerosols | field::cloudborne_aerosols |
+                field::particle_size | field::level_work_arrays};
+  }
+
+  // prognostic_update -- compute_tendencies only sets tendencies
+  KOKKOS_INLINE_FUNCTION
+  static constexpr PrognosticUpdate prognostic_update() {
+    return PrognosticUpdate::tendencies_only;
+  }
+
   // init -- initializes the implementation with MAM4's configuration and with
   // a process-specific configuration.
   void init(const AeroConfig &aero_config,
@@ -959,8 +1022,7 @@ public:
       // compute inv density; density is constant, so we can compute in init.
       const auto n_spec = num_species_mode(m);
       for (int ispec = 0; ispec < n_spec; ispec++) {
-        const int aero_id = int(mode_aero_species(m, ispec));
-        _inv_density[m][ispec] = Real(1.0) / aero_species(aero_id).density;
+        _inv_density[m][ispec] = mode_species_inv_density(m, ispec);
       } // for(ispec)
       // FIXME: do we need to update num2vol_ratio_min_nmodes and
       // num2vol_ratio_max_nmodes as well?
@@ -1008,8 +1070,42 @@ public:
     const auto n_common_species_ait_accum = _n_common_species_ait_accum;
     const auto noxf_acc2ait = _noxf_acc2ait;
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, nk), KOKKOS_CLASS_LAMBDA(int k) {
+    // hashes of the inputs and diameters saved by the previous call
+    const auto level_hash = diagnostics.calcsize_input_hash;
+    const auto saved_dgncur = diagnostics.calcsize_diameters;
+    const bool reuse_levels =
+        config_.reuse_unchanged_levels && level_hash.data() != nullptr;
+
+    int num_reused = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::TeamThreadRange(team, nk),
+        KOKKOS_CLASS_LAMBDA(int k, int &reused) {
+          // skip levels whose inputs haven't changed since the previous
+          // call, which left their diameters unchanged and wrote zero
+          // tendencies there
+          std::uint64_t input_hash = 0;
+          if (reuse_levels) {
+            input_hash = calcsize::level_input_hash(k, dt, prognostics);
+            if (level_hash(k) == input_hash) {
+              for (int imode = 0; imode < nmodes; imode++) {
+                dgncur_i[imode](k) = saved_dgncur(k, imode);
+                dgncur_c[imode](k) = saved_dgncur(k, nmodes + imode);
+                // the tendencies set by adjust_num_sizes
+                const bool is_aitken_or_accumulation =
+                    imode == accumulation_idx || imode == aitken_idx;
+                if (do_adjust &&
+                    !(is_aitken_or_accumulation && do_aitacc_transfer)) {
+                  dnidt[imode](k) = zero;
+                  dncdt[imode](k) = zero;
+                }
+              }
+              ++reused;
+              return;
+            }
+          }
+          // true if any tendency is updated at this level
+          bool updated_tends = false;
+
           Real dryvol_i = 0;
           Real dryvol_c = 0;
 
@@ -1149,6 +1245,8 @@ public:
                     adj_tscale_inv,                      // in
                     num_i_k, num_c_k,                    // out
                     interstitial_tend, cloudborne_tend); // out
+                updated_tends = updated_tends || interstitial_tend != zero ||
+                                cloudborne_tend != zero;
               }
             }
 
@@ -1205,7 +1303,7 @@ public:
           // ------------------------------------------------------------------
           if (do_aitacc_transfer) {
 
-            calcsize::aitken_accum_exchange(
+            const bool transferred = calcsize::aitken_accum_exchange(
                 k, aitken_idx, accumulation_idx, noxf_acc2ait,
                 n_common_species_ait_accum, ait_spec_in_acc, acc_spec_in_ait,
                 num2vol_ratio_max_nmodes, num2vol_ratio_min_nmodes,
@@ -1214,9 +1312,25 @@ public:
                 dt, prognostics, dryvol_i_aitsv, num_i_k_aitsv, dryvol_c_aitsv,
                 num_c_k_aitsv, dryvol_i_accsv, num_i_k_accsv, dryvol_c_accsv,
                 num_c_k_accsv, diagnostics, tendencies);
+            updated_tends = updated_tends || transferred;
 
           } // end do_aitacc_transfer
-        }); // kokkos::parfor(k)
+
+          // save the diameters for the next call, unless the tendencies
+          // change the inputs or can't be reproduced without recomputing them
+          if (reuse_levels) {
+            for (int imode = 0; imode < nmodes; imode++) {
+              saved_dgncur(k, imode) = dgncur_i[imode](k);
+              saved_dgncur(k, nmodes + imode) = dgncur_c[imode](k);
+            }
+            level_hash(k) = updated_tends ? 0 : input_hash;
+          }
+        },
+        num_reused); // kokkos::parreduce(k)
+    if (reuse_levels) {
+      utils::add_to_counter(team, diagnostics.num_skipped_levels,
+                            Diagnostics::calcsize_skipped_levels, num_reused);
+    }
   }
 };
 
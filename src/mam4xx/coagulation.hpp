@@ -43,6 +43,23 @@ public:
   // name -- unique name of the process implemented by this class
   const char *name() const { return "MAM4 Coagulation"; }
 
+  // memory_footprint -- bytes of device memory held by this process
+  std::size_t memory_footprint() const { return 0; }
+
+  // field_access -- groups of fields read and written by compute_tendencies
+  KOKKOS_INLINE_FUNCTION
+  static constexpr FieldAccess field_access() {
+    return {field::interstitial_aerosols | field::particle_size,
+            field::interstitial_aerosols};
+  }
+
+  // prognostic_update -- compute_tendencies updates the prognostics in place,
+  // and the tendencies it sets only report the change
+  KOKKOS_INLINE_FUNCTION
+  static constexpr PrognosticUpdate prognostic_update() {
+    return PrognosticUpdate::in_place;
+  }
+
   // init -- initializes the implementation with MAM4's configuration
   void init(const AeroConfig &aero_config,
             const Config &process_config = Config());
@@ -71,6 +88,8 @@ public:
 private:
   // Gas-Aerosol-Exchange-specific configuration
   Config config_;
+  // log-normal factors of the modes, fixed at init
+  ModeLognormalFactors factors_;
 };
 
 namespace coagulation {
@@ -1047,7 +1066,8 @@ void mam_coag_1subarea(
     Real qnum_cur[AeroConfig::num_modes()],
     Real qaer_cur[AeroConfig::num_aerosol_ids()][AeroConfig::num_modes()],
     Real qaer_del_coag_out[AeroConfig::num_aerosol_ids()]
-                          [AeroConfig::max_agepair()]) {
+                          [AeroConfig::max_agepair()],
+    const ModeLognormalFactors &factors) {
 
   const int num_aer = AeroConfig::num_aerosol_ids();
   const int num_mode = AeroConfig::num_modes();
@@ -1096,8 +1116,8 @@ void mam_coag_1subarea(
     const Real sigma_aer_dest = mam4::modes(dest_mode).mean_std_dev;
 
     getcoags_wrapper_f(temp, pmid, dgn_awet[src_mode], dgn_awet[dest_mode],
-                       sigma_aer_src, sigma_aer_dest, haero::log(sigma_aer_src),
-                       haero::log(sigma_aer_dest), wetdens[src_mode],
+                       sigma_aer_src, sigma_aer_dest, factors.alnsg[src_mode],
+                       factors.alnsg[dest_mode], wetdens[src_mode],
                        wetdens[dest_mode], ybetaij0[ip], ybetaij3[ip],
                        ybetaii0[ip], ybetajj0[ip]);
   }
@@ -1122,12 +1142,28 @@ void mam_coag_1subarea(
   mam_coag_aer_update(ybetaij3, deltat, qnum_tavg, qaer_bgn, qaer_cur,
                       qaer_del_coag_out);
 }
+// As above, with the log-normal factors of the modes of modes().
+KOKKOS_INLINE_FUNCTION
+void mam_coag_1subarea(
+    const Real deltat, const Real temp, const Real pmid, const Real aircon,
+    Real dgn_a[AeroConfig::num_modes()], Real dgn_awet[AeroConfig::num_modes()],
+    Real wetdens[AeroConfig::num_modes()],
+    Real qnum_cur[AeroConfig::num_modes()],
+    Real qaer_cur[AeroConfig::num_aerosol_ids()][AeroConfig::num_modes()],
+    Real qaer_del_coag_out[AeroConfig::num_aerosol_ids()]
+                          [AeroConfig::max_agepair()]) {
+  mam_coag_1subarea(deltat, temp, pmid, aircon, dgn_a, dgn_awet, wetdens,
+                    qnum_cur, qaer_cur, qaer_del_coag_out,
+                    ModeLognormalFactors());
+}
+
 KOKKOS_INLINE_FUNCTION
 void coagulation_rates_1box(const int k, const AeroConfig &aero_config,
                             const Real dt, const Atmosphere &atm,
                             const Prognostics &progs, const Diagnostics &diags,
                             const Tendencies &tends,
-                            const Coagulation::Config &config) {
+                            const Coagulation::Config &config,
+                            const ModeLognormalFactors &factors) {
 
   const int num_aer = AeroConfig::num_aerosol_ids();
   const int num_mode = AeroConfig::num_modes();
@@ -1162,7 +1198,7 @@ void coagulation_rates_1box(const int k, const AeroConfig &aero_config,
                         [AeroConfig::max_agepair()];
 
   mam_coag_1subarea(dt, temp, pmid, aircon, dgn_a, dgn_awet, wet_density,
-                    qnum_cur, qaer_cur, qaer_del_coag_out);
+                    qnum_cur, qaer_cur, qaer_del_coag_out, factors);
 
   // compute the tendencies
   for (int imode = 0; imode < num_mode; ++imode) {
@@ -1194,8 +1230,8 @@ void coagulation_rates_1box(const int k, const AeroConfig &aero_config,
 // init -- initializes the implementation with MAM4's configuration
 inline void Coagulation::init(const AeroConfig &aero_config,
                               const Config &process_config) {
-  // TODO
   config_ = process_config;
+  factors_ = ModeLognormalFactors();
 }
 
 // compute_tendencies -- computes tendencies and updates diagnostics
@@ -1213,7 +1249,7 @@ void Coagulation::compute_tendencies(const AeroConfig &config,
   Kokkos::parallel_for(
       Kokkos::TeamThreadRange(team, nk), KOKKOS_CLASS_LAMBDA(int k) {
         coagulation::coagulation_rates_1box(k, config, dt, atm, progs, diags,
-                                            tends, config_);
+                                            tends, config_, factors_);
       });
 }
 } // namespace mam4
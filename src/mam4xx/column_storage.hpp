@@ -0,0 +1,159 @@
+// mam4xx: Copyright (c) 2022,
+// Battelle Memorial Institute and
+// National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef MAM4XX_COLUMN_STORAGE_HPP
+#define MAM4XX_COLUMN_STORAGE_HPP
+
+#include <mam4xx/aero_config.hpp>
+#include <mam4xx/diagnostic_fields.hpp>
+
+#include <haero/atmosphere.hpp>
+#include <haero/haero.hpp>
+
+#include <type_traits>
+#include <vector>
+
+namespace mam4 {
+
+/// @class ColumnStorage
+/// A ColumnStorage owns the device memory behind column views (which may be
+/// unmanaged), so that the containers whose views it creates stay valid for
+/// as long as it exists.
+class ColumnStorage {
+public:
+  ColumnStorage() = default;
+  ColumnStorage(const ColumnStorage &) = delete;
+  ColumnStorage &operator=(const ColumnStorage &) = delete;
+
+  /// Returns a new zeroed column view of the given number of values.
+  ColumnView column_view(const int num_values) {
+    views_.push_back(DeviceType::view_1d<Real>("mam4::ColumnStorage",
+                                               num_values));
+    return ColumnView(views_.back().data(), num_values);
+  }
+
+  /// Releases all views created by this storage.
+  void clear() { views_.clear(); }
+
+private:
+  std::vector<DeviceType::view_1d<Real>> views_;
+};
+
+/// Creates a Prognostics object with the given number of vertical levels whose
+/// (zeroed) column views are created by create_column_view(n), which returns a
+/// ColumnView of n values that outlives the Prognostics.
+template <typename CreateColumnView>
+Prognostics create_prognostics(const int num_levels,
+                               CreateColumnView &&create_column_view) {
+  const auto zeroed_view = [&]() {
+    const ColumnView v = create_column_view(num_levels);
+    Kokkos::deep_copy(v, 0.0);
+    return v;
+  };
+  Prognostics p(num_levels);
+  for (int mode = 0; mode < AeroConfig::num_modes(); ++mode) {
+    p.n_mode_i[mode] = zeroed_view();
+    p.n_mode_c[mode] = zeroed_view();
+    for (int spec = 0; spec < AeroConfig::num_aerosol_ids(); ++spec) {
+      p.q_aero_i[mode][spec] = zeroed_view();
+      p.q_aero_c[mode][spec] = zeroed_view();
+    }
+  }
+  for (int gas = 0; gas < AeroConfig::num_gas_ids(); ++gas) {
+    p.q_gas[gas] = zeroed_view();
+    p.q_gas_avg[gas] = zeroed_view();
+    for (int mode = 0; mode < AeroConfig::num_modes(); ++mode)
+      p.uptkaer[gas][mode] = zeroed_view();
+  }
+  return p;
+}
+
+/// Creates a Prognostics object with the given number of vertical levels whose
+/// column views are held by the given storage.
+inline Prognostics create_prognostics(const int num_levels,
+                                      ColumnStorage &storage) {
+  return create_prognostics(num_levels, [&](const int n) {
+    return storage.column_view(n);
+  });
+}
+
+/// Creates a Tendencies object with the given number of vertical levels whose
+/// column views are held by the given storage.
+inline Tendencies create_tendencies(const int num_levels,
+                                    ColumnStorage &storage) {
+  return create_prognostics(num_levels, storage);
+}
+
+/// Creates an Atmosphere object with the given number of vertical levels and
+/// planetary boundary layer height, whose column views are created by
+/// create_column_view(n), which returns a zeroed ColumnView of n values that
+/// outlives the Atmosphere.
+template <typename CreateColumnView>
+haero::Atmosphere create_atmosphere(const int num_levels, const Real pblh,
+                                    CreateColumnView &&create_column_view) {
+  const auto v = [&]() { return create_column_view(num_levels); };
+  return haero::Atmosphere(num_levels, v(), v(), v(), v(), v(), v(), v(), v(),
+                           v(), v(), pblh);
+}
+
+/// Creates an Atmosphere object with the given number of vertical levels and
+/// planetary boundary layer height, whose (zeroed) column views are held by
+/// the given storage.
+inline haero::Atmosphere create_atmosphere(const int num_levels,
+                                           ColumnStorage &storage,
+                                           const Real pblh = 0.0) {
+  return create_atmosphere(num_levels, pblh, [&](const int n) {
+    return storage.column_view(n);
+  });
+}
+
+/// Creates a Diagnostics object with the given number of vertical levels in
+/// which only the views in the given groups of diagnostic fields are allocated
+/// (e.g. fields_accessed<NucleationProcess, CalcSizeProcess>()), and zeroed.
+/// Column views (including the storage of the convective tracer arrays) are
+/// created by create_column_view(n), which returns a ColumnView of n values
+/// that outlives the Diagnostics; the other views are allocated here. The
+/// views of each group are listed in the table of for_each_diagnostic.
+template <typename CreateColumnView>
+Diagnostics create_diagnostics(const int num_levels, const FieldSet fields,
+                               CreateColumnView &&create_column_view) {
+  Diagnostics d(num_levels);
+  for_each_diagnostic(num_levels, [&](const DiagnosticField &info,
+                                      const auto &get) {
+    if (!(fields & info.group))
+      return;
+    auto &v = get(d);
+    using View = std::decay_t<decltype(v)>;
+    if constexpr (std::is_same_v<View, ColumnView>) {
+      v = create_column_view(info.extent0);
+      Kokkos::deep_copy(v, 0.0);
+    } else if constexpr (std::is_same_v<View, Diagnostics::ColumnTracerView>) {
+      const ColumnView storage =
+          create_column_view(info.extent0 * info.extent1);
+      Kokkos::deep_copy(storage, 0.0);
+      v = View(storage.data(), info.extent0, info.extent1);
+    } else if constexpr (View::rank == 1) {
+      v = View(info.name, info.extent0);
+    } else {
+      v = View(info.name, info.extent0, info.extent1);
+    }
+  });
+  return d;
+}
+
+/// Creates a Diagnostics object with the given number of vertical levels and
+/// the views in the given groups of diagnostic fields (all of them by
+/// default), whose column views are held by the given storage.
+inline Diagnostics
+create_diagnostics(const int num_levels, ColumnStorage &storage,
+                   const FieldSet fields = diagnostic_fields) {
+  return create_diagnostics(num_levels, fields, [&](const int n) {
+    return storage.column_view(n);
+  });
+}
+
+} // namespace mam4
+
+#endif
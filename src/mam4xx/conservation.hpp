@@ -0,0 +1,290 @@
+// mam4xx: Copyright (c) 2022,
+// Battelle Memorial Institute and
+// National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef MAM4XX_CONSERVATION_HPP
+#define MAM4XX_CONSERVATION_HPP
+
+#include <mam4xx/aero_config.hpp>
+#include <mam4xx/aero_modes.hpp>
+#include <mam4xx/process_scheduler.hpp>
+
+#include <haero/atmosphere.hpp>
+#include <haero/constants.hpp>
+#include <haero/haero.hpp>
+#include <haero/math.hpp>
+#include <haero/surface.hpp>
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/// The mam4::conservation namespace contains an optional audit of the mass and
+/// number conserved by MAM4 processes, which compares column totals before and
+/// after a process computes its tendencies.
+namespace mam4::conservation {
+
+/// Number of column totals tracked by the audit: the mass of each aerosol
+/// species (summed over modes, interstitial and cloud-borne), the number of
+/// each mode (interstitial and cloud-borne), and the mass of each gas
+constexpr int num_totals = AeroConfig::num_aerosol_ids() +
+                           AeroConfig::num_modes() + AeroConfig::num_gas_ids();
+
+/// Returns the index of the column total of the given aerosol species
+KOKKOS_INLINE_FUNCTION
+constexpr int aerosol_total(const AeroId aero_id) {
+  return static_cast<int>(aero_id);
+}
+
+/// Returns the index of the column total of the number of the given mode
+KOKKOS_INLINE_FUNCTION
+constexpr int number_total(const ModeIndex mode) {
+  return AeroConfig::num_aerosol_ids() + static_cast<int>(mode);
+}
+
+/// Returns the index of the column total of the given gas
+KOKKOS_INLINE_FUNCTION
+constexpr int gas_total(const GasId gas) {
+  return AeroConfig::num_aerosol_ids() + AeroConfig::num_modes() +
+         static_cast<int>(gas);
+}
+
+/// Returns the name of the i-th column total (for reports)
+inline std::string total_name(const int i) {
+  if (i < AeroConfig::num_aerosol_ids())
+    return aero_id_str(static_cast<AeroId>(i));
+  if (i < AeroConfig::num_aerosol_ids() + AeroConfig::num_modes())
+    return mode_str(static_cast<ModeIndex>(i - AeroConfig::num_aerosol_ids())) +
+           "_number";
+  return gas_id_str(static_cast<GasId>(i - AeroConfig::num_aerosol_ids() -
+                                       AeroConfig::num_modes()));
+}
+
+/// Column totals of a MAM4 state: the mixing ratios integrated over the
+/// column with the air mass of each level (pdel/g) [kg/m2 or #/m2], indexed as
+/// above. All totals are accumulated together by one team reduction.
+struct ColumnTotals {
+  Real values[num_totals];
+
+  KOKKOS_INLINE_FUNCTION
+  ColumnTotals() {
+    for (int i = 0; i < num_totals; ++i)
+      values[i] = 0;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  ColumnTotals &operator+=(const ColumnTotals &rhs) {
+    for (int i = 0; i < num_totals; ++i)
+      values[i] += rhs.values[i];
+    return *this;
+  }
+};
+
+} // namespace mam4::conservation
+
+namespace Kokkos {
+// identity for the sum of column totals in team reductions
+template <> struct reduction_identity<mam4::conservation::ColumnTotals> {
+  KOKKOS_FORCEINLINE_FUNCTION
+  static mam4::conservation::ColumnTotals sum() {
+    return mam4::conservation::ColumnTotals();
+  }
+};
+} // namespace Kokkos
+
+namespace mam4::conservation {
+
+namespace detail {
+
+// computes the column totals of progs + dt * tends (or of progs alone if
+// with_tends is false) in a single reduction over the levels of the column
+KOKKOS_INLINE_FUNCTION
+void column_totals(const ThreadTeam &team, const haero::Atmosphere &atm,
+                   const Prognostics &progs, const Tendencies &tends,
+                   const Real dt, const bool with_tends,
+                   ColumnTotals &totals) {
+  const int nk = progs.num_levels();
+  const Real rgrav = 1.0 / haero::Constants::gravity;
+  Kokkos::parallel_reduce(
+      Kokkos::TeamThreadRange(team, nk),
+      [&](const int k, ColumnTotals &sums) {
+        // air mass of the level [kg/m2]
+        const Real air_mass = atm.hydrostatic_dp(k) * rgrav;
+        for (int m = 0; m < AeroConfig::num_modes(); ++m) {
+          Real n = progs.n_mode_i[m](k) + progs.n_mode_c[m](k);
+          if (with_tends)
+            n += dt * (tends.n_mode_i[m](k) + tends.n_mode_c[m](k));
+          sums.values[number_total(static_cast<ModeIndex>(m))] += air_mass * n;
+          for (int s = 0; s < num_species_mode(m); ++s) {
+            Real q = progs.q_aero_i[m][s](k) + progs.q_aero_c[m][s](k);
+            if (with_tends)
+              q += dt * (tends.q_aero_i[m][s](k) + tends.q_aero_c[m][s](k));
+            sums.values[aerosol_total(mode_aero_species(m, s))] +=
+                air_mass * q;
+          }
+        }
+        for (int g = 0; g < AeroConfig::num_gas_ids(); ++g) {
+          Real q = progs.q_gas[g](k);
+          if (with_tends)
+            q += dt * tends.q_gas[g](k);
+          sums.values[gas_total(static_cast<GasId>(g))] += air_mass * q;
+        }
+      },
+      Kokkos::Sum<ColumnTotals>(totals));
+}
+
+} // namespace detail
+
+/// Computes the column totals of the given state using the given team.
+KOKKOS_INLINE_FUNCTION
+void column_totals(const ThreadTeam &team, const haero::Atmosphere &atm,
+                   const Prognostics &progs, ColumnTotals &totals) {
+  detail::column_totals(team, atm, progs, progs, 0, false, totals);
+}
+
+/// Computes the column totals of the given state after the given tendencies
+/// are applied over the time step dt, using the given team.
+KOKKOS_INLINE_FUNCTION
+void column_totals(const ThreadTeam &team, const haero::Atmosphere &atm,
+                   const Prognostics &progs, const Tendencies &tends,
+                   const Real dt, ColumnTotals &totals) {
+  detail::column_totals(team, atm, progs, tends, dt, true, totals);
+}
+
+/// Groups of column totals that an audited process is expected to conserve
+enum Quantities : unsigned {
+  aerosol_mass = 1u << 0,   // mass of each aerosol species
+  aerosol_number = 1u << 1, // number of each mode
+  gas_mass = 1u << 2,       // mass of each gas
+};
+
+/// Options for auditing the conservation of a process. Auditing is off unless
+/// a tolerance is given.
+struct AuditOptions {
+  /// Largest relative change of a conserved column total over a time step
+  /// that isn't reported (auditing is disabled if it's negative)
+  Real tolerance = -1;
+  /// Groups of column totals conserved by the process (see Quantities)
+  unsigned conserved = aerosol_mass;
+
+  /// Returns true iff auditing is enabled
+  bool enabled() const { return tolerance >= 0; }
+
+  /// Returns true iff the i-th column total is conserved
+  bool conserves(const int i) const {
+    if (i < AeroConfig::num_aerosol_ids())
+      return conserved & aerosol_mass;
+    if (i < AeroConfig::num_aerosol_ids() + AeroConfig::num_modes())
+      return conserved & aerosol_number;
+    return conserved & gas_mass;
+  }
+
+  /// Returns options read from the environment: MAM4XX_AUDIT_TOLERANCE
+  /// enables auditing with the given tolerance (e.g. "1e-12"), for the
+  /// column totals in the given groups.
+  static AuditOptions from_environment(const unsigned conserved) {
+    AuditOptions options;
+    options.conserved = conserved;
+    if (const char *tolerance = std::getenv("MAM4XX_AUDIT_TOLERANCE"))
+      options.tolerance = std::stod(tolerance);
+    return options;
+  }
+};
+
+/// A change of a conserved column total beyond the audit's tolerance
+struct Drift {
+  int column; // index of the column
+  int total;  // index of the column total
+  Real before, after;
+
+  /// Returns the change relative to the larger of the two totals
+  Real relative() const {
+    const Real scale = haero::max(haero::abs(before), haero::abs(after));
+    return (scale > 0) ? haero::abs(after - before) / scale : 0;
+  }
+
+  /// Returns a description of the drift for reports
+  std::string str() const {
+    std::ostringstream s;
+    s << "column " << column << ": " << total_name(total) << " changed from "
+      << before << " to " << after << " (relative drift " << relative()
+      << ")";
+    return s.str();
+  }
+};
+
+/// Runs the given process (or ProcessScheduler) on the given columns in a
+/// single kernel launch, as io::compute_tendencies does. If the given audit is
+/// enabled, the kernel also computes the column totals of each column before
+/// the process runs and after its tendencies are applied, and the conserved
+/// totals that change by more than the audit's tolerance are returned. For a
+/// process that updates the prognostics in place (see PrognosticUpdate), the
+/// totals after it runs are those of the prognostics alone. When the audit is
+/// disabled, nothing else is done and no drift is returned.
+template <typename Process>
+std::vector<Drift>
+compute_tendencies(const AuditOptions &audit, const Process &process,
+                   const int ncol, const Real t, const Real dt,
+                   const DeviceType::view_1d<haero::Atmosphere> &atm,
+                   const DeviceType::view_1d<haero::Surface> &sfc,
+                   const DeviceType::view_1d<Prognostics> &progs,
+                   const DeviceType::view_1d<Diagnostics> &diags,
+                   const DeviceType::view_1d<Tendencies> &tends) {
+  if (!audit.enabled()) {
+    Kokkos::parallel_for(
+        "mam4::conservation::compute_tendencies",
+        haero::ThreadTeamPolicy(ncol, Kokkos::AUTO),
+        KOKKOS_LAMBDA(const ThreadTeam &team) {
+          const int icol = team.league_rank();
+          process.compute_tendencies(team, t, dt, atm(icol), sfc(icol),
+                                     progs(icol), diags(icol), tends(icol));
+        });
+    return {};
+  }
+
+  DeviceType::view_1d<ColumnTotals> before("totals before", ncol);
+  DeviceType::view_1d<ColumnTotals> after("totals after", ncol);
+  Kokkos::parallel_for(
+      "mam4::conservation::compute_tendencies (audited)",
+      haero::ThreadTeamPolicy(ncol, Kokkos::AUTO),
+      KOKKOS_LAMBDA(const ThreadTeam &team) {
+        const int icol = team.league_rank();
+        ColumnTotals totals_before, totals_after;
+        column_totals(team, atm(icol), progs(icol), totals_before);
+        team.team_barrier();
+        process.compute_tendencies(team, t, dt, atm(icol), sfc(icol),
+                                   progs(icol), diags(icol), tends(icol));
+        team.team_barrier();
+        if constexpr (ProcessPrognosticUpdate<Process>::value() ==
+                      PrognosticUpdate::in_place)
+          column_totals(team, atm(icol), progs(icol), totals_after);
+        else
+          column_totals(team, atm(icol), progs(icol), tends(icol), dt,
+                        totals_after);
+        Kokkos::single(Kokkos::PerTeam(team), [&]() {
+          before(icol) = totals_before;
+          after(icol) = totals_after;
+        });
+      });
+
+  const auto h_before =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), before);
+  const auto h_after =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), after);
+  std::vector<Drift> drifts;
+  for (int icol = 0; icol < ncol; ++icol) {
+    for (int i = 0; i < num_totals; ++i) {
+      const Drift drift = {icol, i, h_before(icol).values[i],
+                           h_after(icol).values[i]};
+      if (audit.conserves(i) && drift.relative() > audit.tolerance)
+        drifts.push_back(drift);
+    }
+  }
+  return drifts;
+}
+
+} // namespace mam4::conservation
+
+#endif
@@ -515,6 +515,31 @@ public:
     return voltonumblo_amode[i];
   }
 
+  // Compact list of the indices of the species transported by convection, in
+  // ascending order: the interstitial aerosols and gases are followed by the
+  // cloudborne aerosols paired with them (at the index + gas_pcnst, see
+  // convproc::assign_la_lc). The species loops of the transport run over the
+  // list instead of testing the flags of all pcnst_extd species.
+  struct SpeciesLists {
+    int num_extd = 0;         // number of transported species
+    int num_interstitial = 0; // number of those below gas_pcnst
+    int extd[pcnst_extd] = {};
+
+    // sets the lists from the flags of the first n species, skipping the
+    // first one (the indexing started at 2 for Fortran, so 1 for C++)
+    KOKKOS_INLINE_FUNCTION
+    void set(const bool doconvproc_extd[], const int n) {
+      num_extd = num_interstitial = 0;
+      for (int icnst = 1; icnst < n; ++icnst) {
+        if (doconvproc_extd[icnst]) {
+          extd[num_extd++] = icnst;
+          if (icnst < gas_pcnst)
+            ++num_interstitial;
+        }
+      }
+    }
+  };
+
   enum Col1DViewInd {
     q = 0,
     mu,
@@ -555,10 +580,36 @@ private:
 
   Kokkos::View<Real *> scratch1Dviews[NumScratch];
 
+  // species transported with the configured species classes
+  SpeciesLists species_lists_;
+
+  // sets species_lists_ from the configuration (defined below)
+  void set_species_lists();
+
 public:
   // name -- unique name of the process implemented by this class
   const char *name() const { return "MAM4 convproc"; }
 
+  // memory_footprint -- bytes of device memory held by this process
+  std::size_t memory_footprint() const {
+    std::size_t bytes = 0;
+    for (const auto &v : scratch1Dviews)
+      bytes += utils::view_footprint(v);
+    return bytes;
+  }
+
+  // field_access -- groups of fields read and written by compute_tendencies
+  KOKKOS_INLINE_FUNCTION
+  static constexpr FieldAccess field_access() {
+    return {field::convection, field::convection | field::level_work_arrays};
+  }
+
+  // prognostic_update -- compute_tendencies only sets tendencies
+  KOKKOS_INLINE_FUNCTION
+  static constexpr PrognosticUpdate prognostic_update() {
+    return PrognosticUpdate::tendencies_only;
+  }
+
   // init -- initializes the implementation with MAM4's configuration and with
   // a process-specific configuration.
   void init(const AeroConfig &aero_config,
@@ -566,8 +617,8 @@ public:
     // Set nucleation-specific config parameters.
     config_ = convproc_config;
     Kokkos::resize(scratch1Dviews[q], config_.nlev * gas_pcnst);
-    Kokkos::resize(scratch1Dviews[mu], config_.nlev);
-    Kokkos::resize(scratch1Dviews[md], config_.nlev);
+    Kokkos::resize(scratch1Dviews[mu], 1 + config_.nlev);
+    Kokkos::resize(scratch1Dviews[md], 1 + config_.nlev);
     Kokkos::resize(scratch1Dviews[eudp], config_.nlev);
     Kokkos::resize(scratch1Dviews[dudp], config_.nlev);
     Kokkos::resize(scratch1Dviews[eddp], config_.nlev);
@@ -600,6 +651,7 @@ public:
     Kokkos::resize(scratch1Dviews[dqdt], config_.nlev * ConvProc::gas_pcnst);
     Kokkos::resize(scratch1Dviews[qnew], config_.nlev * ConvProc::gas_pcnst);
     Kokkos::resize(scratch1Dviews[dlfdp], config_.nlev);
+    set_species_lists();
   } // end(init)
 
   KOKKOS_INLINE_FUNCTION
@@ -608,13 +660,81 @@ public:
                           const Prognostics &prognostics,
                           const Diagnostics &diagnostics,
                           const Tendencies &tendencies) const;
+
+  // compute_tendencies -- the AeroProcess interface, which passes the surface
+  // state (unused by convective processing) along with the atmospheric state
+  KOKKOS_INLINE_FUNCTION
+  void compute_tendencies(const AeroConfig &config, const ThreadTeam &team,
+                          Real t, Real dt, const Atmosphere &atmosphere,
+                          const Surface &surface,
+                          const Prognostics &prognostics,
+                          const Diagnostics &diagnostics,
+                          const Tendencies &tendencies) const {
+    compute_tendencies(config, team, t, dt, atmosphere, prognostics,
+                       diagnostics, tendencies);
+  }
 };
 
 namespace convproc {
+// The (level, species) work arrays are laid out as configured (see
+// convproc_species_major): species-major keeps the column of each species
+// contiguous for the vertical sweeps of the updraft and downdraft.
+using WorkLayout = std::conditional_t<convproc_species_major,
+                                      Kokkos::LayoutLeft, Kokkos::LayoutRight>;
 using Const_Kokkos_2D_View =
-    Kokkos::View<const Real * [ConvProc::pcnst_extd], Kokkos::MemoryUnmanaged>;
-using Kokkos_2D_View =
-    Kokkos::View<Real * [ConvProc::pcnst_extd], Kokkos::MemoryUnmanaged>;
+    Kokkos::View<const Real * [ConvProc::pcnst_extd], WorkLayout,
+                 Kokkos::MemoryUnmanaged>;
+using Kokkos_2D_View = Kokkos::View<Real * [ConvProc::pcnst_extd], WorkLayout,
+                                    Kokkos::MemoryUnmanaged>;
+
+// The convective transport runs on the threads of a team: the vertical sweeps
+// of each species are independent, so they are spread over the team, and the
+// remaining column work is done once per team. The functions below take
+// either a ThreadTeam or a SerialTeam, which runs everything on the calling
+// thread (as the functions called without a team do).
+struct SerialTeam {};
+
+// waits for all the threads of the team
+KOKKOS_INLINE_FUNCTION
+void team_barrier(const SerialTeam &) {}
+KOKKOS_INLINE_FUNCTION
+void team_barrier(const ThreadTeam &team) { team.team_barrier(); }
+
+// calls f(i) for begin <= i < end, spread over the threads of the team
+template <typename Func>
+KOKKOS_INLINE_FUNCTION void team_for(const SerialTeam &, const int begin,
+                                     const int end, const Func &f) {
+  for (int i = begin; i < end; ++i)
+    f(i);
+}
+template <typename Func>
+KOKKOS_INLINE_FUNCTION void team_for(const ThreadTeam &team, const int begin,
+                                     const int end, const Func &f) {
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(team, begin, end), f);
+}
+
+// calls f() on one thread of the team
+template <typename Func>
+KOKKOS_INLINE_FUNCTION void team_single(const SerialTeam &, const Func &f) {
+  f();
+}
+template <typename Func>
+KOKKOS_INLINE_FUNCTION void team_single(const ThreadTeam &team, const Func &f) {
+  Kokkos::single(Kokkos::PerTeam(team), f);
+}
+
+// calls f(value) on one thread of the team and broadcasts the resulting value
+// to all its threads
+template <typename Func, typename Value>
+KOKKOS_INLINE_FUNCTION void team_single(const SerialTeam &, const Func &f,
+                                        Value &value) {
+  f(value);
+}
+template <typename Func, typename Value>
+KOKKOS_INLINE_FUNCTION void team_single(const ThreadTeam &team, const Func &f,
+                                        Value &value) {
+  Kokkos::single(Kokkos::PerTeam(team), f, value);
+}
 
 KOKKOS_INLINE_FUNCTION
 void assign_la_lc(const int imode, const int ispec, int &la, int &lc) {
@@ -723,10 +843,9 @@ KOKKOS_INLINE_FUNCTION
 void update_tendency_final(
     const int ntsub,   // IN  number of sub timesteps
     const int jtsub,   // IN  index of sub timesteps from the outer loop
-    const int ncnst,   // IN  number of tracers to transport
     const Real dt,     // IN delta t (model time increment) [s]
     const ConstSubView dcondt, // IN grid-average TMR tendency for current column  [kg/kg/s]
-    const bool doconvproc[], // IN  flag for doing convective transport
+    const ConvProc::SpeciesLists &species, // IN  transported species
     SubView dqdt, // INOUT Tracer tendency array
     SubView q_i)  // INOUT  q(icol,kk,icnst) at current icol
 {
@@ -751,19 +870,27 @@ void update_tendency_final(
   const Real dtsub = dt * xinv_ntsub;
 
   // scatter overall tendency back to full array
-  // The indexing started at 2 for Fortran, so 1 for C++
-  for (int icnst = 1; icnst < ncnst; ++icnst) {
-    if (doconvproc[icnst]) {
-      // scatter overall dqdt tendency back
-      const Real dqdt_i = dcondt[icnst];
-      dqdt[icnst] += dqdt_i * xinv_ntsub;
-      // update the q_i for the next interation of the jtsub loop
-      if (jtsub < ntsub) {
-        q_i[icnst] = haero::max((q_i[icnst] + dqdt_i * dtsub), 0.0);
-      }
+  for (int i = 0; i < species.num_interstitial; ++i) {
+    const int icnst = species.extd[i];
+    // scatter overall dqdt tendency back
+    const Real dqdt_i = dcondt[icnst];
+    dqdt[icnst] += dqdt_i * xinv_ntsub;
+    // update the q_i for the next interation of the jtsub loop
+    if (jtsub < ntsub) {
+      q_i[icnst] = haero::max((q_i[icnst] + dqdt_i * dtsub), 0.0);
     }
   }
 }
+
+template <typename SubView, typename ConstSubView>
+KOKKOS_INLINE_FUNCTION void
+update_tendency_final(const int ntsub, const int jtsub, const int ncnst,
+                      const Real dt, const ConstSubView dcondt,
+                      const bool doconvproc[], SubView dqdt, SubView q_i) {
+  ConvProc::SpeciesLists species;
+  species.set(doconvproc, ncnst);
+  update_tendency_final(ntsub, jtsub, dt, dcondt, species, dqdt, q_i);
+}
 // =========================================================================================
 // clang-format off
 // nlev = number of atmospheric levels: 0 <= ktop <= kbot_prevap <= nvel
@@ -974,8 +1101,8 @@ void ma_precpevap(const Real dpdry, const Real evapc, const Real pr_flux,
 template <typename SubView, typename ConstSubView>
 KOKKOS_INLINE_FUNCTION void
 ma_precpprod(const Real rprd, const Real dpdry,
-             const bool doconvproc_extd[ConvProc::pcnst_extd],
-             const Real x_ratio, const int species_class[ConvProc::gas_pcnst],
+             const ConvProc::SpeciesLists &species, const Real x_ratio,
+             const int species_class[ConvProc::gas_pcnst],
              const int mmtoo_prevap_resusp[ConvProc::gas_pcnst], Real &pr_flux,
              Real &pr_flux_tmp, Real &pr_flux_base, ColumnView wd_flux,
              ConstSubView dcondt_wetdep, SubView dcondt, SubView dcondt_prevap,
@@ -988,7 +1115,7 @@ ma_precpprod(const Real rprd, const Real dpdry,
   in  rprd  -  conv precip production  rate (at a certain level) [kg/kg/s]
   in  dcondt_wetdep[pcnst_extd] - portion of TMR tendency due to wet removal [kg/kg/s]
   in  dpdry      - pressure thickness of level [mb]
-  in  doconvproc_extd[pcnst_extd]  - indicates which species to process
+  in  species - transported species
   in  x_ratio    - ratio of adjusted and old fraction of precipitation-borne aerosol 
                    flux that is NOT resuspended, calculated in step 1
   in  species_class(:) specify what kind of species it is. defined as
@@ -1019,56 +1146,68 @@ ma_precpprod(const Real rprd, const Real dpdry,
   pr_flux =
       utils::min_max_bound(0.0, pr_flux_base, pr_flux_tmp + pr_flux_local);
 
-  // The indexing started at 2 for Fortran, so 1 for C++
-  for (int icnst = 1; icnst < ConvProc::pcnst_extd; ++icnst) {
-
-    if (doconvproc_extd[icnst]) {
-      // wet deposition flux from the aerosol resuspension
-      // wd_flux_tmp (updated) =
-      //            (wd_flux coming into the layer) - (resuspension ! decrement)
-      // wd_flux_tmp - updated wet deposition flux [(kg/kg/s)*mb]
-      const Real wd_flux_tmp = haero::max(0.0, wd_flux[icnst] * x_ratio);
-
-      // change to wet deposition flux from evaporation [(kg/kg/s)*mb]
-      const Real del_wd_flux_evap =
-          haero::max(0.0, wd_flux[icnst] - wd_flux_tmp);
-      // wet deposition flux from the aerosol scavenging
-      // wd_flux (updated) = (wd_flux after resuspension) - (scavenging !
-      // increment)
-
-      // local wet deposition flux [(kg/kg/s)*mb]
-      const Real wd_flux_local = haero::max(0.0, -dcondt_wetdep[icnst] * dpdry);
-      wd_flux[icnst] = haero::max(0.0, wd_flux_tmp + wd_flux_local);
-
-      // dcondt due to wet deposition flux change [kg/kg/s]
-      const Real dcondt_wdflux = del_wd_flux_evap / dpdry;
-
-      // for interstitial icnst2=icnst;  for activated icnst2=icnst-pcnst
-      const int icnst2 = icnst % ConvProc::gas_pcnst;
-
-      // not sure what this mean exactly. Only do it for aerosol mass species
-      // (mmtoo>0).  mmtoo<=0 represents aerosol number species
-      const int mmtoo = mmtoo_prevap_resusp[icnst2];
-      if (species_class[icnst2] == ConvProc::species_class::aerosol) {
-        if (mmtoo >= 0) {
-          // add the precip-evap (resuspension) to the history-tendency of the
-          // current species
-          dcondt_prevap_hist[icnst] += dcondt_wdflux;
-          // add the precip-evap (resuspension) to the actual tendencies of
-          // appropriate coarse-mode species
-          dcondt_prevap[mmtoo] += dcondt_wdflux;
-          dcondt[mmtoo] += dcondt_wdflux;
-        }
-      } else {
-        // do this for trace gases (although currently modal_aero_convproc does
-        // not treat trace gases)
+  for (int i = 0; i < species.num_extd; ++i) {
+    const int icnst = species.extd[i];
+    // wet deposition flux from the aerosol resuspension
+    // wd_flux_tmp (updated) =
+    //            (wd_flux coming into the layer) - (resuspension ! decrement)
+    // wd_flux_tmp - updated wet deposition flux [(kg/kg/s)*mb]
+    const Real wd_flux_tmp = haero::max(0.0, wd_flux[icnst] * x_ratio);
+
+    // change to wet deposition flux from evaporation [(kg/kg/s)*mb]
+    const Real del_wd_flux_evap = haero::max(0.0, wd_flux[icnst] - wd_flux_tmp);
+    // wet deposition flux from the aerosol scavenging
+    // wd_flux (updated) = (wd_flux after resuspension) - (scavenging !
+    // increment)
+
+    // local wet deposition flux [(kg/kg/s)*mb]
+    const Real wd_flux_local = haero::max(0.0, -dcondt_wetdep[icnst] * dpdry);
+    wd_flux[icnst] = haero::max(0.0, wd_flux_tmp + wd_flux_local);
+
+    // dcondt due to wet deposition flux change [kg/kg/s]
+    const Real dcondt_wdflux = del_wd_flux_evap / dpdry;
+
+    // for interstitial icnst2=icnst;  for activated icnst2=icnst-pcnst
+    const int icnst2 = icnst % ConvProc::gas_pcnst;
+
+    // not sure what this mean exactly. Only do it for aerosol mass species
+    // (mmtoo>0).  mmtoo<=0 represents aerosol number species
+    const int mmtoo = mmtoo_prevap_resusp[icnst2];
+    if (species_class[icnst2] == ConvProc::species_class::aerosol) {
+      if (mmtoo >= 0) {
+        // add the precip-evap (resuspension) to the history-tendency of the
+        // current species
         dcondt_prevap_hist[icnst] += dcondt_wdflux;
-        dcondt_prevap[icnst] += dcondt_wdflux;
-        dcondt[icnst] += dcondt_wdflux;
+        // add the precip-evap (resuspension) to the actual tendencies of
+        // appropriate coarse-mode species
+        dcondt_prevap[mmtoo] += dcondt_wdflux;
+        dcondt[mmtoo] += dcondt_wdflux;
       }
+    } else {
+      // do this for trace gases (although currently modal_aero_convproc does
+      // not treat trace gases)
+      dcondt_prevap_hist[icnst] += dcondt_wdflux;
+      dcondt_prevap[icnst] += dcondt_wdflux;
+      dcondt[icnst] += dcondt_wdflux;
     }
   }
 }
+
+template <typename SubView, typename ConstSubView>
+KOKKOS_INLINE_FUNCTION void
+ma_precpprod(const Real rprd, const Real dpdry,
+             const bool doconvproc_extd[ConvProc::pcnst_extd],
+             const Real x_ratio, const int species_class[ConvProc::gas_pcnst],
+             const int mmtoo_prevap_resusp[ConvProc::gas_pcnst], Real &pr_flux,
+             Real &pr_flux_tmp, Real &pr_flux_base, ColumnView wd_flux,
+             ConstSubView dcondt_wetdep, SubView dcondt, SubView dcondt_prevap,
+             SubView dcondt_prevap_hist) {
+  ConvProc::SpeciesLists species;
+  species.set(doconvproc_extd, ConvProc::pcnst_extd);
+  ma_precpprod(rprd, dpdry, species, x_ratio, species_class,
+               mmtoo_prevap_resusp, pr_flux, pr_flux_tmp, pr_flux_base, wd_flux,
+               dcondt_wetdep, dcondt, dcondt_prevap, dcondt_prevap_hist);
+}
 // =========================================================================================
 KOKKOS_INLINE_FUNCTION
 void ma_precpevap_convproc(const int ktop, const int nlev,
@@ -1076,7 +1215,7 @@ void ma_precpevap_convproc(const int ktop, const int nlev,
                            const Real rprd[/* nlev */],
                            const Real evapc[/* nlev */],
                            const Real dpdry[/* nlev */],
-                           const bool doconvproc_extd[ConvProc::pcnst_extd],
+                           const ConvProc::SpeciesLists &species,
                            const int species_class[ConvProc::gas_pcnst],
                            const int mmtoo_prevap_resusp[ConvProc::gas_pcnst],
                            ColumnView wd_flux, Kokkos_2D_View dcondt_prevap,
@@ -1123,7 +1262,7 @@ void ma_precpevap_convproc(const int ktop, const int nlev,
     in    :: rprd   conv precip production  rate (gathered) [kg/kg/s]
     in    :: evapc  conv precip evaporation rate (gathered) [kg/kg/s]
     in    :: dpdry  pressure thickness of leve;
-    in    :: doconvproc_extd[pcnst_extd]   indicates which species to process
+    in    :: species   transported species
     in    :: species_class[gas_pcnst]   specify what kind of species it is. defined at physconst.F90
                                    undefined  = 0
                                    cldphysics = 1
@@ -1192,30 +1331,50 @@ void ma_precpevap_convproc(const int ktop, const int nlev,
     auto dcondt_prevap_sub = Kokkos::subview(dcondt_prevap, kk, Kokkos::ALL());
     auto dcondt_prevap_hist_sub =
         Kokkos::subview(dcondt_prevap_hist, kk, Kokkos::ALL());
-    ma_precpprod(rprd[kk], dpdry[kk], doconvproc_extd, x_ratio, species_class,
+    ma_precpprod(rprd[kk], dpdry[kk], species, x_ratio, species_class,
                  mmtoo_prevap_resusp, pr_flux, pr_flux_tmp, pr_flux_base,
                  wd_flux, dcondt_wetdep_sub, dcondt_sub, dcondt_prevap_sub,
                  dcondt_prevap_hist_sub);
   }
 }
 
-// =========================================================================================
-// TODO: initialize_dcondt uses multiple levels for computation but ONLY
-// sets a SINGLE level on output for the loop over ktop to kbot.  So, it should
-// be possible to input kk and then call in parallel from ktop to kbot.
 KOKKOS_INLINE_FUNCTION
-void initialize_dcondt(const bool doconvproc_extd[ConvProc::pcnst_extd],
-                       const int iflux_method, const int ktop, const int kbot,
-                       const int nlev, const Real dpdry[/* nlev */],
-                       const Real fa_u[/* nlev */], const Real mu[/* nlev+1 */],
-                       const Real md[/* nlev+1 */], Const_Kokkos_2D_View chat,
-                       Const_Kokkos_2D_View gath, Const_Kokkos_2D_View conu,
-                       Const_Kokkos_2D_View cond,
-                       Const_Kokkos_2D_View dconudt_activa,
-                       Const_Kokkos_2D_View dconudt_wetdep,
-                       const Real dudp[/* nlev */], const Real dddp[/* nlev */],
-                       const Real eudp[/* nlev */], const Real eddp[/* nlev */],
-                       Kokkos_2D_View dcondt) {
+void ma_precpevap_convproc(const int ktop, const int nlev,
+                           Const_Kokkos_2D_View dcondt_wetdep,
+                           const Real rprd[/* nlev */],
+                           const Real evapc[/* nlev */],
+                           const Real dpdry[/* nlev */],
+                           const bool doconvproc_extd[ConvProc::pcnst_extd],
+                           const int species_class[ConvProc::gas_pcnst],
+                           const int mmtoo_prevap_resusp[ConvProc::gas_pcnst],
+                           ColumnView wd_flux, Kokkos_2D_View dcondt_prevap,
+                           Kokkos_2D_View dcondt_prevap_hist,
+                           Kokkos_2D_View dcondt) {
+  ConvProc::SpeciesLists species;
+  species.set(doconvproc_extd, ConvProc::pcnst_extd);
+  ma_precpevap_convproc(ktop, nlev, dcondt_wetdep, rprd, evapc, dpdry, species,
+                        species_class, mmtoo_prevap_resusp, wd_flux,
+                        dcondt_prevap, dcondt_prevap_hist, dcondt);
+}
+
+// =========================================================================================
+// initialize_dcondt uses multiple levels for computation but ONLY sets a SINGLE
+// level of a species on output, so the species are spread over the threads of
+// the given team, each sweeping the levels from ktop to kbot.
+template <typename Team>
+KOKKOS_INLINE_FUNCTION void
+initialize_dcondt(const Team &team, const ConvProc::SpeciesLists &species,
+                  const int iflux_method, const int ktop, const int kbot,
+                  const int nlev, const Real dpdry[/* nlev */],
+                  const Real fa_u[/* nlev */], const Real mu[/* nlev+1 */],
+                  const Real md[/* nlev+1 */], Const_Kokkos_2D_View chat,
+                  Const_Kokkos_2D_View gath, Const_Kokkos_2D_View conu,
+                  Const_Kokkos_2D_View cond,
+                  Const_Kokkos_2D_View dconudt_activa,
+                  Const_Kokkos_2D_View dconudt_wetdep,
+                  const Real dudp[/* nlev */], const Real dddp[/* nlev */],
+                  const Real eudp[/* nlev */], const Real eddp[/* nlev */],
+                  Kokkos_2D_View dcondt) {
   // clang-format off
   // -----------------------------------------------------------------------
   //  initialize dondt and update with aerosol activation and wetdeposition
@@ -1225,7 +1384,7 @@ void initialize_dcondt(const bool doconvproc_extd[ConvProc::pcnst_extd],
   // -----------------------------------------------------------------------
 
   /* cloudborne aerosol, so the arrays are dimensioned with pcnst_extd = pcnst*2
-   in :: doconvproc_extd[pcnst_extd] ! flag for doing convective transport
+   in :: species                  ! transported species
    in :: iflux_method             ! 1=as in convtran (deep), 2=uwsh
    in :: ktop                     ! top level index
    in :: kbot                     ! bottom level index
@@ -1247,76 +1406,96 @@ void initialize_dcondt(const bool doconvproc_extd[ConvProc::pcnst_extd],
   */
   // clang-format on
   // initialize variables
-  for (int i = 0; i < nlev; ++i)
-    for (int j = 0; j < ConvProc::pcnst_extd; ++j)
-      dcondt(i, j) = 0.;
+  team_for(team, 0, ConvProc::pcnst_extd, [&](const int icnst) {
+    for (int kk = 0; kk < nlev; ++kk)
+      dcondt(kk, icnst) = 0.;
+  });
+  team_barrier(team);
 
-  // loop from ktop to kbot
-  for (int kk = ktop; kk < kbot; ++kk) {
-    const int kp1 = kk + 1;
-    const int kp1x = haero::min(kp1, nlev - 1);
-    const int km1x = haero::max(kk - 1, 0);
-    const Real fa_u_dp = fa_u[kk] * dpdry[kk];
-    // The indexing started at 2 for Fortran, so 1 for C++
-    for (int icnst = 1; icnst < ConvProc::pcnst_extd; ++icnst) {
-      if (doconvproc_extd[icnst]) {
-        // compute fluxes as in convtran, and also source/sink terms
-        // (version 3 limit fluxes outside convection to mass in appropriate
-        // layer (these limiters are probably only safe for positive definite
-        // quantitities (it assumes that mu and md already satify a courant
-        // number limit of 1)
-        Real fluxin = 0, fluxout = 0;
-        if (iflux_method != 2) {
-          fluxin = mu[kp1] * conu(kp1, icnst) +
-                   mu[kk] * haero::min(chat(kk, icnst), gath(km1x, icnst)) -
-                   (md[kk] * cond(kk, icnst) +
-                    md[kp1] * haero::min(chat(kp1, icnst), gath(kp1x, icnst)));
-          fluxout = mu[kk] * conu(kk, icnst) +
-                    mu[kp1] * haero::min(chat(kp1, icnst), gath(kk, icnst)) -
-                    (md[kp1] * cond(kp1, icnst) +
-                     md[kk] * haero::min(chat(kk, icnst), gath(kk, icnst)));
+  team_for(team, 0, species.num_extd, [&](const int i) {
+    const int icnst = species.extd[i];
+    // loop from ktop to kbot
+    for (int kk = ktop; kk < kbot; ++kk) {
+      const int kp1 = kk + 1;
+      const int kp1x = haero::min(kp1, nlev - 1);
+      const int km1x = haero::max(kk - 1, 0);
+      const Real fa_u_dp = fa_u[kk] * dpdry[kk];
+      // compute fluxes as in convtran, and also source/sink terms
+      // (version 3 limit fluxes outside convection to mass in appropriate
+      // layer (these limiters are probably only safe for positive definite
+      // quantitities (it assumes that mu and md already satify a courant
+      // number limit of 1)
+      Real fluxin = 0, fluxout = 0;
+      if (iflux_method != 2) {
+        fluxin = mu[kp1] * conu(kp1, icnst) +
+                 mu[kk] * haero::min(chat(kk, icnst), gath(km1x, icnst)) -
+                 (md[kk] * cond(kk, icnst) +
+                  md[kp1] * haero::min(chat(kp1, icnst), gath(kp1x, icnst)));
+        fluxout = mu[kk] * conu(kk, icnst) +
+                  mu[kp1] * haero::min(chat(kp1, icnst), gath(kk, icnst)) -
+                  (md[kp1] * cond(kp1, icnst) +
+                   md[kk] * haero::min(chat(kk, icnst), gath(kk, icnst)));
+      } else {
+        // new method -- simple upstream method for the env subsidence
+        // tmpa = net env mass flux (positive up) at top of layer k
+        fluxin = mu[kp1] * conu(kp1, icnst) - md[kk] * cond(kk, icnst);
+        fluxout = mu[kk] * conu(kk, icnst) - md[kp1] * cond(kp1, icnst);
+        Real tmpa = -(mu[kk] + md[kk]);
+        if (tmpa <= 0.0) {
+          fluxin -= tmpa * gath(km1x, icnst);
+        } else {
+          fluxout += tmpa * gath(kk, icnst);
+        }
+        // tmpa = net env mass flux (positive up) at base of layer k
+        tmpa = -(mu[kp1] + md[kp1]);
+        if (tmpa >= 0.0) {
+          fluxin += tmpa * gath(kp1x, icnst);
         } else {
-          // new method -- simple upstream method for the env subsidence
-          // tmpa = net env mass flux (positive up) at top of layer k
-          fluxin = mu[kp1] * conu(kp1, icnst) - md[kk] * cond(kk, icnst);
-          fluxout = mu[kk] * conu(kk, icnst) - md[kp1] * cond(kp1, icnst);
-          Real tmpa = -(mu[kk] + md[kk]);
-          if (tmpa <= 0.0) {
-            fluxin -= tmpa * gath(km1x, icnst);
-          } else {
-            fluxout += tmpa * gath(kk, icnst);
-          }
-          // tmpa = net env mass flux (positive up) at base of layer k
-          tmpa = -(mu[kp1] + md[kp1]);
-          if (tmpa >= 0.0) {
-            fluxin += tmpa * gath(kp1x, icnst);
-          } else {
-            fluxout -= tmpa * gath(kk, icnst);
-          }
+          fluxout -= tmpa * gath(kk, icnst);
         }
-        //  net flux [kg/kg/s * mb]
-        const Real netflux = fluxin - fluxout;
-
-        // note for C++ refactoring:
-        // I was trying to separate dconudt_activa and dconudt_wetdep out
-        // into a subroutine, but for some reason it doesn't give consistent
-        // dcondt values. have to leave them here.   Shuaiqi Tang, 2022
-        const Real netsrce =
-            fa_u_dp * (dconudt_activa(kk, icnst) + dconudt_wetdep(kk, icnst));
-        dcondt(kk, icnst) = (netflux + netsrce) / dpdry[kk];
       }
+      //  net flux [kg/kg/s * mb]
+      const Real netflux = fluxin - fluxout;
+
+      // note for C++ refactoring:
+      // I was trying to separate dconudt_activa and dconudt_wetdep out
+      // into a subroutine, but for some reason it doesn't give consistent
+      // dcondt values. have to leave them here.   Shuaiqi Tang, 2022
+      const Real netsrce =
+          fa_u_dp * (dconudt_activa(kk, icnst) + dconudt_wetdep(kk, icnst));
+      dcondt(kk, icnst) = (netflux + netsrce) / dpdry[kk];
     }
-  }
+  });
+}
+
+KOKKOS_INLINE_FUNCTION
+void initialize_dcondt(const bool doconvproc_extd[ConvProc::pcnst_extd],
+                       const int iflux_method, const int ktop, const int kbot,
+                       const int nlev, const Real dpdry[/* nlev */],
+                       const Real fa_u[/* nlev */], const Real mu[/* nlev+1 */],
+                       const Real md[/* nlev+1 */], Const_Kokkos_2D_View chat,
+                       Const_Kokkos_2D_View gath, Const_Kokkos_2D_View conu,
+                       Const_Kokkos_2D_View cond,
+                       Const_Kokkos_2D_View dconudt_activa,
+                       Const_Kokkos_2D_View dconudt_wetdep,
+                       const Real dudp[/* nlev */], const Real dddp[/* nlev */],
+                       const Real eudp[/* nlev */], const Real eddp[/* nlev */],
+                       Kokkos_2D_View dcondt) {
+  ConvProc::SpeciesLists species;
+  species.set(doconvproc_extd, ConvProc::pcnst_extd);
+  initialize_dcondt(SerialTeam(), species, iflux_method, ktop, kbot, nlev,
+                    dpdry, fa_u, mu, md, chat, gath, conu, cond, dconudt_activa,
+                    dconudt_wetdep, dudp, dddp, eudp, eddp, dcondt);
 }
 // =========================================================================================
-// TODO: compute_downdraft_mixing_ratio uses multiple levels for computation but
-// ONLY sets a SINGLE level on output for the loop over ktop to kbot.  So, it
-// should be possible to input kk and then call in parallel from ktop to kbot.
+// compute_downdraft_mixing_ratio is a recurrence from cloudtop to cloudbase
+// that is independent for each species, so the species are spread over the
+// threads of the given team, each sweeping the levels from ktop to kbot.
 // It is a bit confusing that the level set is kk+1 so it would be better to
 // rewrite as kkp1=>kk and kk=>kk-1 and iterate from ktop+1 to kbot inclusive.
-KOKKOS_INLINE_FUNCTION
-void compute_downdraft_mixing_ratio(
-    const bool doconvproc_extd[ConvProc::pcnst_extd], const int ktop,
+template <typename Team>
+KOKKOS_INLINE_FUNCTION void compute_downdraft_mixing_ratio(
+    const Team &team, const ConvProc::SpeciesLists &species, const int ktop,
     const int kbot, const Real md_i[/* nlev+1 */], const Real eddp[/* nlev */],
     Const_Kokkos_2D_View gath, Kokkos_2D_View cond) {
   // clang-format off
@@ -1327,7 +1506,7 @@ void compute_downdraft_mixing_ratio(
   // ---------------------------------------------------------------------
 
   /* cloudborne aerosol, so the arrays are dimensioned with pcnst_extd = pcnst*2
-   in doconvproc_extd[pcnst_extd] ! flag for doing convective transport
+   in species                  ! transported species
    in ktop                     ! top level index
    in kbot                     ! bottom level index
    in md_i[nlev+1]              ! md at current i (note nlev+1 dimension) [mb/s]
@@ -1340,21 +1519,31 @@ void compute_downdraft_mixing_ratio(
   //  BAD_CONSTANT - used for both compute_downdraft_mixing_ratio and
   //  compute_massflux
   const Real mbsth = 1.e-15;
-  for (int kk = ktop; kk < kbot; ++kk) {
-    const int kp1 = kk + 1;
-    // md_m_eddp = downdraft massflux at kp1, without detrainment between k,kp1
-    const Real md_m_eddp = md_i[kk] - eddp[kk];
-    if (md_m_eddp < -mbsth) {
-      // The indexing started at 2 for Fortran, so 1 for C++
-      for (int icnst = 1; icnst < ConvProc::pcnst_extd; ++icnst) {
-        if (doconvproc_extd[icnst]) {
-          cond(kp1, icnst) =
-              (md_i[kk] * cond(kk, icnst) - eddp[kk] * gath(kk, icnst)) /
-              md_m_eddp;
-        }
+  team_for(team, 0, species.num_extd, [&](const int i) {
+    const int icnst = species.extd[i];
+    for (int kk = ktop; kk < kbot; ++kk) {
+      const int kp1 = kk + 1;
+      // md_m_eddp = downdraft massflux at kp1, without detrainment between
+      // k,kp1
+      const Real md_m_eddp = md_i[kk] - eddp[kk];
+      if (md_m_eddp < -mbsth) {
+        cond(kp1, icnst) =
+            (md_i[kk] * cond(kk, icnst) - eddp[kk] * gath(kk, icnst)) /
+            md_m_eddp;
       }
     }
-  }
+  });
+}
+
+KOKKOS_INLINE_FUNCTION
+void compute_downdraft_mixing_ratio(
+    const bool doconvproc_extd[ConvProc::pcnst_extd], const int ktop,
+    const int kbot, const Real md_i[/* nlev+1 */], const Real eddp[/* nlev */],
+    Const_Kokkos_2D_View gath, Kokkos_2D_View cond) {
+  ConvProc::SpeciesLists species;
+  species.set(doconvproc_extd, ConvProc::pcnst_extd);
+  compute_downdraft_mixing_ratio(SerialTeam(), species, ktop, kbot, md_i, eddp,
+                                 gath, cond);
 }
 // ==================================================================================
 template <typename SubView>
@@ -1561,6 +1750,31 @@ void compute_massflux(const int nlev, const int ktop, const int kbot,
   }
 }
 // ======================================================================================
+// Narrows the layers from ktop to kbot to those with a nonzero updraft or
+// downdraft mass flux at either of their interfaces, or with nonzero
+// entrainment or detrainment. The transport makes no change in the other
+// layers, so the vertical sweeps can skip them. The range is empty
+// (ktop == kbot) if all of these vanish.
+KOKKOS_INLINE_FUNCTION
+void mass_flux_layers(const Real mu[/* nlev+1 */], const Real md[/* nlev+1 */],
+                      const Real du[/* nlev */], const Real eu[/* nlev */],
+                      const Real ed[/* nlev */], int &ktop, int &kbot) {
+  int kfirst = kbot, klast = ktop - 1;
+  for (int kk = ktop; kk < kbot; ++kk) {
+    if (mu[kk] != 0 || mu[kk + 1] != 0 || md[kk] != 0 || md[kk + 1] != 0 ||
+        du[kk] != 0 || eu[kk] != 0 || ed[kk] != 0) {
+      kfirst = haero::min(kfirst, kk);
+      klast = kk;
+    }
+  }
+  if (kfirst <= klast) {
+    ktop = kfirst;
+    kbot = klast + 1;
+  } else {
+    ktop = kbot;
+  }
+}
+// ======================================================================================
 // Because the local variable courantmax is over the whole column, this can not
 // be called in parallel.  Could pass courantmax back as an array and then
 // max-reduc over it.
@@ -1867,12 +2081,23 @@ update_qnew_ptend(const bool dotend[ConvProc::gas_pcnst],
   }
 }
 // ======================================================================================
+// Returns true iff the tendency of any species is to be applied.
+KOKKOS_INLINE_FUNCTION
+bool any_tendency(const bool dotend[ConvProc::gas_pcnst]) {
+  for (int ll = 0; ll < ConvProc::gas_pcnst; ++ll)
+    if (dotend[ll])
+      return true;
+  return false;
+}
+// ======================================================================================
 // This can be parallelized over kk. All the "nlev" dimensioned arrays could be subscripted 
-// with kk and passed as scalars or 1D arrays.
-template <typename SubView>
+// with kk and passed as scalars or 1D arrays. The species are spread over the
+// threads of the given team.
+template <typename Team, typename SubView>
 KOKKOS_INLINE_FUNCTION
 void compute_wetdep_tend(
-  const bool doconvproc_extd[ConvProc::pcnst_extd],
+  const Team &team,
+  const ConvProc::SpeciesLists &species,
   const Real dt,   
   const Real dt_u,   
   const Real dp,   
@@ -1912,7 +2137,7 @@ void compute_wetdep_tend(
   // -----------------------------------------------------------------------
   /*
    cloudborne aerosol, so the arrays are dimensioned with pcnst_extd = pcnst*2
-   in :: doconvproc_extd[pcnst_extd] ! flag for doing convective transport
+   in :: species              ! transported species
    in :: dt                   ! Model timestep [s]
    in :: dt_u                 ! lagrangian transport time in the updraft[s]
    in :: dp                  ! dp [mb]
@@ -1938,16 +2163,27 @@ void compute_wetdep_tend(
   }
   if (cdt > 0.0) {
     const Real expcdtm1 = haero::exp(-cdt) - 1;
-    // The indexing started at 2 for Fortran, so 1 for C++
-    for (int icnst = 1; icnst < ConvProc::pcnst_extd; ++icnst) {
-      if (doconvproc_extd[icnst]) {
-        dconudt_wetdep[icnst] = conu[icnst] * aqfrac[icnst] * expcdtm1;
-        conu[icnst] += dconudt_wetdep[icnst];
-        dconudt_wetdep[icnst] /= dt_u;
-      }
-    }
+    team_for(team, 0, species.num_extd, [&](const int i) {
+      const int icnst = species.extd[i];
+      dconudt_wetdep[icnst] = conu[icnst] * aqfrac[icnst] * expcdtm1;
+      conu[icnst] += dconudt_wetdep[icnst];
+      dconudt_wetdep[icnst] /= dt_u;
+    });
   }
 }
+
+template <typename SubView>
+KOKKOS_INLINE_FUNCTION void
+compute_wetdep_tend(const bool doconvproc_extd[ConvProc::pcnst_extd],
+                    const Real dt, const Real dt_u, const Real dp,
+                    const Real cldfrac_i, const Real mu_p_eudp,
+                    const Real aqfrac[ConvProc::pcnst_extd], const Real icwmr,
+                    const Real rprd, SubView conu, SubView dconudt_wetdep) {
+  ConvProc::SpeciesLists species;
+  species.set(doconvproc_extd, ConvProc::pcnst_extd);
+  compute_wetdep_tend(SerialTeam(), species, dt, dt_u, dp, cldfrac_i, mu_p_eudp,
+                      aqfrac, icwmr, rprd, conu, dconudt_wetdep);
+}
 // ======================================================================================
 KOKKOS_INLINE_FUNCTION
 void assign_dotend(const int species_class[ConvProc::gas_pcnst],
@@ -1977,6 +2213,21 @@ void assign_dotend(const int species_class[ConvProc::gas_pcnst],
   }
 }
 
+// =========================================================================================
+// Sets the lists of the species transported with the given species classes
+// (see assign_dotend and set_cloudborne_vars).
+KOKKOS_INLINE_FUNCTION
+void set_species_lists(const int species_class[ConvProc::gas_pcnst],
+                       const bool convproc_do_aer, const bool convproc_do_gas,
+                       ConvProc::SpeciesLists &species) {
+  bool doconvproc[ConvProc::gas_pcnst];
+  assign_dotend(species_class, convproc_do_aer, convproc_do_gas, doconvproc);
+  Real aqfrac[ConvProc::pcnst_extd];
+  bool doconvproc_extd[ConvProc::pcnst_extd];
+  set_cloudborne_vars(doconvproc, aqfrac, doconvproc_extd);
+  species.set(doconvproc_extd, ConvProc::pcnst_extd);
+}
+
 // ======================================================================================
 // This function just uses kk==kactfirst so can be called in parallel over kk.
 template <typename SubView>
@@ -2189,11 +2440,24 @@ KOKKOS_INLINE_FUNCTION void compute_activation_tend(
   }
 }
 // ======================================================================================
+// Levels of the updraft with aerosol activation, shared by the threads of a
+// team (see compute_activation_tend)
+struct ActivationLevels {
+  int kactcnt;   // Counter for no. of levels having activation
+  int kactfirst; // Lowest layer with activation (= cloudbase)
+  Real wcldbase; // w at first cloudy layer [m/s]
+  int kcldbase;  // level of cloud base
+};
+// ======================================================================================
 // The loop over kk in this function can not be done in parallel as it it a recursive
-// calculation of conu from one level to the next.
+// calculation of conu from one level to the next. Entrainment and wet removal are
+// spread over the species on the threads of the given team at each level, while
+// activation, which couples the species of a level, is done by one thread.
+template <typename Team>
 KOKKOS_INLINE_FUNCTION
 void compute_updraft_mixing_ratio(
-  const bool doconvproc_extd[ConvProc::pcnst_extd],
+  const Team &team,
+  const ConvProc::SpeciesLists &species,
   const int nlev,
   const int ktop,   
   const int kbot,   
@@ -2232,7 +2496,7 @@ void compute_updraft_mixing_ratio(
   // -----------------------------------------------------------------------
   /*
     cloudborne aerosol, so the arrays are dimensioned with pcnst_extd = pcnst*2
-  in :: doconvproc_extd[pcnst_extd] ! flag for doing convective transport
+  in :: species              ! transported species
   in :: ktop                 ! top level index
   in :: kbot                 ! bottom level index
   in :: iconvtype            ! 1=deep, 2=uw shallow
@@ -2268,16 +2532,15 @@ void compute_updraft_mixing_ratio(
   //  BAD_CONSTANT - used for both need a reference for this value
   const Real cldfrac_cut = 0.005;
 
-  // Counter for no. of levels having activation
-  int kactcnt = 0;
-
-  // Lowest layer with activation (= cloudbase)
-  int kactfirst = 1;
+  // no levels with activation yet, lowest layer with activation at 1
+  ActivationLevels levels = {0, 1, xx_wcldbase, xx_kcldbase};
 
   const int pcnst_extd = ConvProc::pcnst_extd;
-  for (int i = 0; i < nlev + 1; ++i)
+  team_for(team, 0, nlev + 1, [&](const int i) {
     for (int j = 0; j < pcnst_extd; ++j)
       dconudt_wetdep(i, j) = dconudt_activa(i, j) = 0.0;
+  });
+  team_barrier(team);
 
   for (int kk = kbot - 1; ktop <= kk; --kk) {
 
@@ -2289,15 +2552,13 @@ void compute_updraft_mixing_ratio(
 
     const int kp1 = kk + 1;
 
-    // Initialized so that it has a value if the following "if" check yeilds
-    // false
-    fa_u[kk] = 0;
-
     // mu_p_eudp = updraft massflux at k, without detrainment between kp1,k
     // [mb/s]
     const Real mu_p_eudp = mu[kp1] + eudp[kk];
 
-    if (mu_p_eudp > mbsth) {
+    if (mu_p_eudp <= mbsth) {
+      team_single(team, [&]() { fa_u[kk] = 0; });
+    } else {
       // if (mu_p_eudp <= mbsth) the updraft mass flux is negligible
       // at base and top of current layer,
       // so current layer is a "gap" between two unconnected updrafts,
@@ -2307,16 +2568,15 @@ void compute_updraft_mixing_ratio(
       //  f_ent = fraction of updraft massflux that was entrained
       //  across this layer == eudp/mu_p_eudp [fraction]
       const Real f_ent = utils::min_max_bound(0.0, 1.0, eudp[kk] / mu_p_eudp);
-      // The indexing started at 2 for Fortran, so 1 for C++
       // NOTE: conu[kp1] was calculated in the call to compute_wetdep_tend
       // in the last trip through the loop.  The loop iterations over kk
       // are not independent!
-      for (int icnst = 1; icnst < pcnst_extd; ++icnst) {
-        if (doconvproc_extd[icnst]) {
-          conu(kk, icnst) =
-              (1.0 - f_ent) * conu(kp1, icnst) + f_ent * gath(kk, icnst);
-        }
-      }
+      team_for(team, 0, species.num_extd, [&](const int i) {
+        const int icnst = species.extd[i];
+        conu(kk, icnst) =
+            (1.0 - f_ent) * conu(kp1, icnst) + f_ent * gath(kk, icnst);
+      });
+      team_barrier(team);
 
       // estimate updraft velocity (wup)
       // mean updraft vertical velocity at current level updraft [m/s]
@@ -2339,10 +2599,21 @@ void compute_updraft_mixing_ratio(
       auto dconudt_activa_sub =
           Kokkos::subview(dconudt_activa, kk, Kokkos::ALL());
       auto conu_sub = Kokkos::subview(conu, kk, Kokkos::ALL());
-      compute_activation_tend(f_ent, cldfrac_i, rhoair[kk], mu[kk], mu[kk + 1],
-                              dt_u, wup_kk, icwmr[kk], temperature[kk], kk,
-                              kactcnt, kactfirst, conu_sub, dconudt_activa_sub,
-                              xx_wcldbase, xx_kcldbase);
+      team_single(
+          team,
+          [&](ActivationLevels &lev) {
+            compute_activation_tend(f_ent, cldfrac_i, rhoair[kk], mu[kk],
+                                    mu[kk + 1], dt_u, wup_kk, icwmr[kk],
+                                    temperature[kk], kk, lev.kactcnt,
+                                    lev.kactfirst, conu_sub,
+                                    dconudt_activa_sub, lev.wcldbase,
+                                    lev.kcldbase);
+            // compute updraft fractional area; for update fluxes use
+            // *** these must obey  dt_u(k)*mu_p_eudp = dpdry(k)*fa_u(k)
+            fa_u[kk] = dt_u * (mu_p_eudp / dpdry[kk]);
+          },
+          levels);
+      team_barrier(team);
 
       // wet removal
       // NOTE: conu is input/output in this function!  So this call will effect
@@ -2350,20 +2621,53 @@ void compute_updraft_mixing_ratio(
       // over levels. This loop can NOT be parallelized over kk!
       auto dconudt_wetdep_sub =
           Kokkos::subview(dconudt_wetdep, kk, Kokkos::ALL());
-      compute_wetdep_tend(doconvproc_extd, dt, dt_u, dp[kk], cldfrac_i,
+      compute_wetdep_tend(team, species, dt, dt_u, dp[kk], cldfrac_i,
                           mu_p_eudp, aqfrac, icwmr[kk], rprd[kk], conu_sub,
                           dconudt_wetdep_sub);
-
-      // compute updraft fractional area; for update fluxes use
-      // *** these must obey  dt_u(k)*mu_p_eudp = dpdry(k)*fa_u(k)
-      fa_u[kk] = dt_u * (mu_p_eudp / dpdry[kk]);
+      team_barrier(team);
     } // "(mu_p_eudp > mbsth)"
   }   // "kk = kbot-1; ktop <= kk; --kk"
+  team_barrier(team);
+  xx_wcldbase = levels.wcldbase;
+  xx_kcldbase = levels.kcldbase;
+}
+
+KOKKOS_INLINE_FUNCTION
+void compute_updraft_mixing_ratio(
+    const bool doconvproc_extd[ConvProc::pcnst_extd], const int nlev,
+    const int ktop, const int kbot, const int iconvtype, const Real dt,
+    const Real dp[/* nlev */], const Real dpdry[/* nlev */],
+    const Real cldfrac[/* nlev */], const Real rhoair[/* nlev */],
+    const Real zmagl[/* nlev */], const Real dz, const Real mu[/* nlev+1 */],
+    const Real eudp[/* nlev */], Const_Kokkos_2D_View gath,
+    const Real temperature[/* nlev */],
+    const Real aqfrac[ConvProc::pcnst_extd], const Real icwmr[/* nlev */],
+    const Real rprd[/* nlev */], Real fa_u[/* nlev */],
+    Kokkos_2D_View dconudt_wetdep, Kokkos_2D_View dconudt_activa,
+    Kokkos_2D_View conu, Real &xx_wcldbase, int &xx_kcldbase) {
+  ConvProc::SpeciesLists species;
+  species.set(doconvproc_extd, ConvProc::pcnst_extd);
+  compute_updraft_mixing_ratio(
+      SerialTeam(), species, nlev, ktop, kbot, iconvtype, dt, dp, dpdry,
+      cldfrac, rhoair, zmagl, dz, mu, eudp, gath, temperature, aqfrac, icwmr,
+      rprd, fa_u, dconudt_wetdep, dconudt_activa, conu, xx_wcldbase,
+      xx_kcldbase);
 }
 // ======================================================================================
-template <typename SubView, typename ConstSubView>
+// Column properties of the mass fluxes, shared by the threads of a team
+struct MassFluxInfo {
+  Real mfup_max; // column maximum updraft mass flux [mb/s]
+  int ntsub;     // number of sub timesteps
+  int ktop_mf;   // top level index of the layers with mass fluxes
+  int kbot_mf;   // bottom level index of the layers with mass fluxes
+};
+// ======================================================================================
+// The species sweeps of the transport are spread over the threads of the given
+// team, and the remaining column work is done by one of them.
+template <typename Team, typename SubView, typename ConstSubView>
 KOKKOS_INLINE_FUNCTION void
-ma_convproc_tend(const Kokkos::View<Real *>
+ma_convproc_tend(const Team &team,
+                 const Kokkos::View<Real *>
                      scratch1Dviews[ConvProc::Col1DViewInd::NumScratch],
                  const int nlev, const ConvProc::convtype convtype,
                  const Real dt, const Real temperature[/* nlev */],
@@ -2375,6 +2679,7 @@ ma_convproc_tend(const Kokkos::View<Real *>
                  const Real cldfrac[/* nlev */], const Real icwmr[/* nlev */],
                  const Real rprd[/* nlev */], const Real evapc[/* nlev */],
                  SubView dqdt, const bool doconvproc[/* ConvProc::gas_pcnst */],
+                 const ConvProc::SpeciesLists &species,
                  Real qsrflx[/* ConvProc::gas_pcnst */][nsrflx],
                  const int species_class[/* ConvProc::gas_pcnst */],
                  Real &xx_mfup_max, Real &xx_wcldbase, int &xx_kcldbase) {
@@ -2453,6 +2758,8 @@ ma_convproc_tend(const Kokkos::View<Real *>
 
    out:: dqdt[nlev][ConvProc::gas_pcnst]  ! Tracer tendency array [kg/kg/s]
    in :: doconvproc[ConvProc::gas_pcnst] ! flag for doing convective transport
+   in :: species     ! the species flagged in doconvproc, with their cloudborne
+                     ! partners
    out:: qsrflx[pcnst][nsrflx]
          ! process-specific column tracer tendencies [kg/m2/s]
          !  1 = activation   of interstial to conv-cloudborne
@@ -2506,65 +2813,49 @@ ma_convproc_tend(const Kokkos::View<Real *>
   //  chat(nlev+1,pcnst_extd)   ! mix ratio in env at interfaces  [kg/kg]
   //  cond(nlev+1,pcnst_extd)   ! mix ratio in downdraft at interfaces [kg/kg]
   //  conu(nlev+1,pcnst_extd)   ! mix ratio in updraft at interfaces [kg/kg]
-  Kokkos_2D_View gath =
-      Kokkos::View<Real *[pcnst_extd], Kokkos::MemoryUnmanaged>(
-          scratch1Dviews[ConvProc::Col1DViewInd::gath].data(), nlev,
-          pcnst_extd);
-  Kokkos_2D_View chat =
-      Kokkos::View<Real *[pcnst_extd], Kokkos::MemoryUnmanaged>(
-          scratch1Dviews[ConvProc::Col1DViewInd::chat].data(), nlev + 1,
-          pcnst_extd);
-  Kokkos_2D_View cond =
-      Kokkos::View<Real *[pcnst_extd], Kokkos::MemoryUnmanaged>(
-          scratch1Dviews[ConvProc::Col1DViewInd::cond].data(), nlev + 1,
-          pcnst_extd);
-  Kokkos_2D_View conu =
-      Kokkos::View<Real *[pcnst_extd], Kokkos::MemoryUnmanaged>(
-          scratch1Dviews[ConvProc::Col1DViewInd::conu].data(), nlev + 1,
-          pcnst_extd);
+  Kokkos_2D_View gath(scratch1Dviews[ConvProc::Col1DViewInd::gath].data(),
+                      nlev, pcnst_extd);
+  Kokkos_2D_View chat(scratch1Dviews[ConvProc::Col1DViewInd::chat].data(),
+                      nlev + 1, pcnst_extd);
+  Kokkos_2D_View cond(scratch1Dviews[ConvProc::Col1DViewInd::cond].data(),
+                      nlev + 1, pcnst_extd);
+  Kokkos_2D_View conu(scratch1Dviews[ConvProc::Col1DViewInd::conu].data(),
+                      nlev + 1, pcnst_extd);
 
   // dconudt_activa(nlev+1,pcnst_extd) ! d(conu)/dt by activation [kg/kg/s]
   // dconudt_wetdep(nlev+1,pcnst_extd) ! d(conu)/dt by wet removal [kg/kg/s]
-  Kokkos_2D_View dconudt_activa =
-      Kokkos::View<Real *[pcnst_extd], Kokkos::MemoryUnmanaged>(
-          scratch1Dviews[ConvProc::Col1DViewInd::dconudt_activa].data(),
-          nlev + 1, pcnst_extd);
-  Kokkos_2D_View dconudt_wetdep =
-      Kokkos::View<Real *[pcnst_extd], Kokkos::MemoryUnmanaged>(
-          scratch1Dviews[ConvProc::Col1DViewInd::dconudt_wetdep].data(),
-          nlev + 1, pcnst_extd);
+  Kokkos_2D_View dconudt_activa(
+      scratch1Dviews[ConvProc::Col1DViewInd::dconudt_activa].data(), nlev + 1,
+      pcnst_extd);
+  Kokkos_2D_View dconudt_wetdep(
+      scratch1Dviews[ConvProc::Col1DViewInd::dconudt_wetdep].data(), nlev + 1,
+      pcnst_extd);
 
   // fa_u(nlev)           ! fractional area of in the updraft [fraction]
   Kokkos::View<Real *> fa_u = scratch1Dviews[ConvProc::Col1DViewInd::fa_u];
 
   // dcondt(nlev,pcnst_extd)  ! grid-average TMR tendency for current column
   // [kg/kg/s]
-  Kokkos_2D_View dcondt =
-      Kokkos::View<Real *[pcnst_extd], Kokkos::MemoryUnmanaged>(
-          scratch1Dviews[ConvProc::Col1DViewInd::dcondt].data(), nlev,
-          pcnst_extd);
+  Kokkos_2D_View dcondt(scratch1Dviews[ConvProc::Col1DViewInd::dcondt].data(),
+                        nlev, pcnst_extd);
 
   // dcondt_wetdep(nlev,pcnst_extd) ! portion of dcondt from wet deposition
   // [kg/kg/s] dcondt_prevap(nlev, pcnst_extd) ! portion of dcondt from precip
   // evaporation [kg/kg/s] dcondt_prevap_hist(nlev, pcnst_extd) ! similar but
   // used for history output [kg/kg/s] dcondt_resusp(nlev, pcnst_extd) ! portion
   // of dcondt from resuspension [kg/kg/s]
-  Kokkos_2D_View dcondt_wetdep =
-      Kokkos::View<Real *[pcnst_extd], Kokkos::MemoryUnmanaged>(
-          scratch1Dviews[ConvProc::Col1DViewInd::dcondt_wetdep].data(), nlev,
-          pcnst_extd);
-  Kokkos_2D_View dcondt_prevap =
-      Kokkos::View<Real *[pcnst_extd], Kokkos::MemoryUnmanaged>(
-          scratch1Dviews[ConvProc::Col1DViewInd::dcondt_prevap].data(), nlev,
-          pcnst_extd);
-  Kokkos_2D_View dcondt_prevap_hist =
-      Kokkos::View<Real *[pcnst_extd], Kokkos::MemoryUnmanaged>(
-          scratch1Dviews[ConvProc::Col1DViewInd::dcondt_prevap_hist].data(),
-          nlev, pcnst_extd);
-  Kokkos_2D_View dcondt_resusp =
-      Kokkos::View<Real *[pcnst_extd], Kokkos::MemoryUnmanaged>(
-          scratch1Dviews[ConvProc::Col1DViewInd::dcondt_resusp].data(), nlev,
-          pcnst_extd);
+  Kokkos_2D_View dcondt_wetdep(
+      scratch1Dviews[ConvProc::Col1DViewInd::dcondt_wetdep].data(), nlev,
+      pcnst_extd);
+  Kokkos_2D_View dcondt_prevap(
+      scratch1Dviews[ConvProc::Col1DViewInd::dcondt_prevap].data(), nlev,
+      pcnst_extd);
+  Kokkos_2D_View dcondt_prevap_hist(
+      scratch1Dviews[ConvProc::Col1DViewInd::dcondt_prevap_hist].data(), nlev,
+      pcnst_extd);
+  Kokkos_2D_View dcondt_resusp(
+      scratch1Dviews[ConvProc::Col1DViewInd::dcondt_resusp].data(), nlev,
+      pcnst_extd);
 
   // sumactiva(pcnst_extd)    ! sum (over layers) of dp*dconudt_activa [kg/kg/s]
   // sumaqchem(pcnst_extd)    ! sum (over layers) of dp*dconudt_aqchem [kg/kg/s]
@@ -2589,9 +2880,6 @@ ma_convproc_tend(const Kokkos::View<Real *>
   //  q(nlev,pcnst)      ! q(k,m) at current i [kg/kg]
   auto q = Kokkos::View<Real **, Kokkos::MemoryUnmanaged>(
       scratch1Dviews[ConvProc::Col1DViewInd::q].data(), nlev, pcnst);
-  for (int i = 0; i < nlev; ++i)
-    for (int j = 0; j < pcnst; ++j)
-      q(i, j) = qnew(i, j);
 
   // precip-borne aerosol
   //    dcondt_wetdep is kgaero/kgair/s
@@ -2611,9 +2899,6 @@ ma_convproc_tend(const Kokkos::View<Real *>
   for (int i = 0; i < pcnst; ++i)
     for (int j = 0; j < nsrflx; ++j)
       qsrflx[i][j] = 0;
-  for (int i = 0; i < nlev; ++i)
-    for (int j = 0; j < pcnst; ++j)
-      dqdt(i, j) = 0;
   xx_mfup_max = 0;
   xx_wcldbase = 0;
   xx_kcldbase = 0;
@@ -2625,31 +2910,56 @@ ma_convproc_tend(const Kokkos::View<Real *>
   //  inititialize aqfrac to 1.0 for activated aerosol species, 0.0 otherwise
   set_cloudborne_vars(doconvproc, aqfrac, doconvproc_extd);
 
-  // Load some variables in current column for further subroutine use
-  for (int kk = 0; kk < nlev; ++kk)
-    rhoair[kk] = pmid[kk] / (rair * temperature[kk]);
-
   //  load tracer mixing ratio array, which will be updated at the end of each
   //  jtsub interation
-
-  // calculate dry mass fluxes at cloud layer
-  compute_massflux(nlev, ktop, kbot, dpdry, du, eu, ed, mu.data(), md.data(),
-                   xx_mfup_max);
-
-  //  compute entraintment*dp and detraintment*dp and calculate ntsub
-  int ntsub = 0;
-  compute_ent_det_dp(nlev, ktop, kbot, dt, dpdry, mu.data(), md.data(), du, eu,
-                     ed, ntsub, eudp.data(), dudp.data(), eddp.data(),
-                     dddp.data());
-
-  // calculate height of layer interface above ground
-  compute_midlev_height(nlev, dpdry, rhoair.data(), zmagl.data());
+  // Load some variables in current column for further subroutine use
+  team_for(team, 0, nlev, [&](const int kk) {
+    for (int j = 0; j < pcnst; ++j) {
+      q(kk, j) = qnew(kk, j);
+      dqdt(kk, j) = 0;
+    }
+    rhoair[kk] = pmid[kk] / (rair * temperature[kk]);
+    // only set in the layers with mass fluxes
+    fa_u[kk] = 0;
+  });
+  team_barrier(team);
+
+  MassFluxInfo fluxes = {xx_mfup_max, 0, ktop, kbot};
+  team_single(
+      team,
+      [&](MassFluxInfo &info) {
+        // calculate dry mass fluxes at cloud layer
+        compute_massflux(nlev, ktop, kbot, dpdry, du, eu, ed, mu.data(),
+                         md.data(), info.mfup_max);
+        mass_flux_layers(mu.data(), md.data(), du, eu, ed, info.ktop_mf,
+                         info.kbot_mf);
+
+        //  compute entraintment*dp and detraintment*dp and calculate ntsub
+        compute_ent_det_dp(nlev, info.ktop_mf, info.kbot_mf, dt, dpdry,
+                           mu.data(), md.data(), du, eu, ed, info.ntsub,
+                           eudp.data(), dudp.data(), eddp.data(), dddp.data());
+
+        // calculate height of layer interface above ground
+        compute_midlev_height(nlev, dpdry, rhoair.data(), zmagl.data());
+      },
+      fluxes);
+  team_barrier(team);
+  xx_mfup_max = fluxes.mfup_max;
+  const int ntsub = fluxes.ntsub;
+  // the updraft, downdraft and flux sweeps only cover the layers with mass
+  // fluxes, while precip evaporation and resuspension cover the levels from
+  // ktop down to the surface
+  const int ktop_mf = fluxes.ktop_mf;
+  const int kbot_mf = fluxes.kbot_mf;
 
   for (int jtsub = 0; jtsub < ntsub; ++jtsub) {
 
     // initialize some tracer mixing ratio arrays
-    initialize_tmr_array(nlev, iconvtype, doconvproc_extd, q, gath, chat, conu,
-                         cond);
+    team_single(team, [&]() {
+      initialize_tmr_array(nlev, iconvtype, doconvproc_extd, q, gath, chat,
+                           conu, cond);
+    });
+    team_barrier(team);
 
     // Compute updraft mixing ratios from cloudbase to cloudtop
     // ---------------------------------------------------------------------------
@@ -2660,43 +2970,48 @@ ma_convproc_tend(const Kokkos::View<Real *>
     const Real dz = dpdry[0] * hund_ovr_g / rhoair[0];
 
     compute_updraft_mixing_ratio(
-        doconvproc_extd, nlev, ktop, kbot, iconvtype, dt, dp, dpdry, cldfrac,
-        rhoair.data(), zmagl.data(), dz, mu.data(), eudp.data(), gath,
+        team, species, nlev, ktop_mf, kbot_mf, iconvtype, dt, dp, dpdry,
+        cldfrac, rhoair.data(), zmagl.data(), dz, mu.data(), eudp.data(), gath,
         temperature, aqfrac, icwmr, rprd, fa_u.data(), dconudt_wetdep,
         dconudt_activa, conu, xx_wcldbase, xx_kcldbase);
 
     // Compute downdraft mixing ratios from cloudtop to cloudbase
-    compute_downdraft_mixing_ratio(doconvproc_extd, ktop, kbot, md.data(),
+    compute_downdraft_mixing_ratio(team, species, ktop_mf, kbot_mf, md.data(),
                                    eddp.data(), gath, cond);
+    team_barrier(team);
 
     // Now compute fluxes and tendencies
     // NOTE:  The approach used in convtran applies to inert tracers and
     //        must be modified to include source and sink terms
-    initialize_dcondt(doconvproc_extd, iflux_method, ktop, kbot, nlev, dpdry,
-                      fa_u.data(), mu.data(), md.data(), chat, gath, conu, cond,
-                      dconudt_activa, dconudt_wetdep, dudp.data(), dddp.data(),
-                      eudp.data(), eddp.data(), dcondt);
+    initialize_dcondt(team, species, iflux_method, ktop_mf, kbot_mf, nlev,
+                      dpdry, fa_u.data(), mu.data(), md.data(), chat, gath,
+                      conu, cond, dconudt_activa, dconudt_wetdep, dudp.data(),
+                      dddp.data(), eudp.data(), eddp.data(), dcondt);
 
     // compute dcondt_wetdep for next subroutine
-    for (int i = 0; i < nlev; ++i)
-      for (int j = 0; j < pcnst_extd; ++j)
-        dcondt_wetdep(i, j) = 0.0;
-    for (int kk = ktop; kk < kbot; ++kk) {
-      // simply cancelling dpdry causes BFB test fail
-      const Real fa_u_dp = fa_u[kk] * dpdry[kk];
-      // The indexing started at 2 for Fortran, so 1 for C++
-      for (int icnst = 1; icnst < pcnst_extd; ++icnst) {
-        if (doconvproc_extd[icnst]) {
-          dcondt_wetdep(kk, icnst) =
-              fa_u_dp * dconudt_wetdep(kk, icnst) / dpdry[kk];
-        }
+    team_for(team, 0, pcnst_extd, [&](const int icnst) {
+      for (int kk = 0; kk < nlev; ++kk)
+        dcondt_wetdep(kk, icnst) = 0.0;
+    });
+    team_barrier(team);
+    team_for(team, 0, species.num_extd, [&](const int i) {
+      const int icnst = species.extd[i];
+      for (int kk = ktop_mf; kk < kbot_mf; ++kk) {
+        // simply cancelling dpdry causes BFB test fail
+        const Real fa_u_dp = fa_u[kk] * dpdry[kk];
+        dcondt_wetdep(kk, icnst) =
+            fa_u_dp * dconudt_wetdep(kk, icnst) / dpdry[kk];
       }
-    }
+    });
+    team_barrier(team);
 
     // calculate effects of precipitation evaporation
-    ma_precpevap_convproc(ktop, nlev, dcondt_wetdep, rprd, evapc, dpdry,
-                          doconvproc_extd, species_class, mmtoo_prevap_resusp,
-                          wd_flux, dcondt_prevap, dcondt_prevap_hist, dcondt);
+    team_single(team, [&]() {
+      ma_precpevap_convproc(ktop, nlev, dcondt_wetdep, rprd, evapc, dpdry,
+                            species, species_class, mmtoo_prevap_resusp,
+                            wd_flux, dcondt_prevap, dcondt_prevap_hist, dcondt);
+    });
+    team_barrier(team);
 
     //  make adjustments to dcondt for activated & unactivated aerosol species
     //     pairs to account any (or total) resuspension of convective-cloudborne
@@ -2715,16 +3030,21 @@ ma_convproc_tend(const Kokkos::View<Real *>
     //       kbot_prevap = kbot
     //  apply this minor fix when doing resuspend to coarse mode
     const int kbot_prevap = nlev;
-    for (int kk = ktop; kk < kbot_prevap; ++kk)
+    team_for(team, ktop, kbot_prevap, [&](const int kk) {
       ma_resuspend_convproc(Kokkos::subview(dcondt, kk, Kokkos::ALL()),
                             Kokkos::subview(dcondt_resusp, kk, Kokkos::ALL()));
+    });
+    team_barrier(team);
 
     // calculate new column-tendency variables
-    compute_column_tendency(
-        doconvproc_extd, ktop, kbot_prevap, dpdry, dcondt_resusp, dcondt_prevap,
-        dcondt_prevap_hist, dconudt_activa, dconudt_wetdep, fa_u.data(),
-        sumactiva.data(), sumaqchem.data(), sumwetdep.data(), sumresusp.data(),
-        sumprevap.data(), sumprevap_hist.data());
+    team_single(team, [&]() {
+      compute_column_tendency(
+          doconvproc_extd, ktop, kbot_prevap, dpdry, dcondt_resusp,
+          dcondt_prevap, dcondt_prevap_hist, dconudt_activa, dconudt_wetdep,
+          fa_u.data(), sumactiva.data(), sumaqchem.data(), sumwetdep.data(),
+          sumresusp.data(), sumprevap.data(), sumprevap_hist.data());
+    });
+    team_barrier(team);
 
     // NOTE: update_tendency_final Fortran =
     //   update_tendency_diagnostics C++ + update_tendency_final C++
@@ -2736,18 +3056,49 @@ ma_convproc_tend(const Kokkos::View<Real *>
                                 sumresusp.data(), sumprevap.data(),
                                 sumprevap_hist.data(), qsrflx);
     // update tendencies
-    for (int kk = ktop; kk < kbot_prevap; ++kk) {
-      update_tendency_final(
-          ntsub, jtsub, pcnst, dt, Kokkos::subview(dcondt, kk, Kokkos::ALL()),
-          doconvproc, Kokkos::subview(dqdt, kk, Kokkos::ALL()),
-          Kokkos::subview(q, kk, Kokkos::ALL()));
-    }
+    team_for(team, ktop, kbot_prevap, [&](const int kk) {
+      update_tendency_final(ntsub, jtsub, dt,
+                            Kokkos::subview(dcondt, kk, Kokkos::ALL()), species,
+                            Kokkos::subview(dqdt, kk, Kokkos::ALL()),
+                            Kokkos::subview(q, kk, Kokkos::ALL()));
+    });
+    team_barrier(team);
   } // of the main "for jtsub = 0, ntsub" loop
 }
 
-// =========================================================================================
 template <typename SubView, typename ConstSubView>
+KOKKOS_INLINE_FUNCTION void
+ma_convproc_tend(const Kokkos::View<Real *>
+                     scratch1Dviews[ConvProc::Col1DViewInd::NumScratch],
+                 const int nlev, const ConvProc::convtype convtype,
+                 const Real dt, const Real temperature[/* nlev */],
+                 const Real pmid[/* nlev */], ConstSubView qnew,
+                 const Real du[/* nlev */], const Real eu[/* nlev */],
+                 const Real ed[/* nlev */], const Real dp[/* nlev */],
+                 const Real dpdry[/* nlev */], const int ktop, const int kbot,
+                 const int mmtoo_prevap_resusp[/* ConvProc::gas_pcnst */],
+                 const Real cldfrac[/* nlev */], const Real icwmr[/* nlev */],
+                 const Real rprd[/* nlev */], const Real evapc[/* nlev */],
+                 SubView dqdt, const bool doconvproc[/* ConvProc::gas_pcnst */],
+                 Real qsrflx[/* ConvProc::gas_pcnst */][nsrflx],
+                 const int species_class[/* ConvProc::gas_pcnst */],
+                 Real &xx_mfup_max, Real &xx_wcldbase, int &xx_kcldbase) {
+  Real aqfrac[ConvProc::pcnst_extd];
+  bool doconvproc_extd[ConvProc::pcnst_extd];
+  set_cloudborne_vars(doconvproc, aqfrac, doconvproc_extd);
+  ConvProc::SpeciesLists species;
+  species.set(doconvproc_extd, ConvProc::pcnst_extd);
+  ma_convproc_tend(SerialTeam(), scratch1Dviews, nlev, convtype, dt,
+                   temperature, pmid, qnew, du, eu, ed, dp, dpdry, ktop, kbot,
+                   mmtoo_prevap_resusp, cldfrac, icwmr, rprd, evapc, dqdt,
+                   doconvproc, species, qsrflx, species_class, xx_mfup_max,
+                   xx_wcldbase, xx_kcldbase);
+}
+
+// =========================================================================================
+template <typename Team, typename SubView, typename ConstSubView>
 KOKKOS_INLINE_FUNCTION void ma_convproc_dp_intr(
+    const Team &team,
     const Kokkos::View<Real *>
         scratch1Dviews[ConvProc::Col1DViewInd::NumScratch],
     const int nlev, const Real temperature[/* nlev */],
@@ -2758,6 +3109,7 @@ KOKKOS_INLINE_FUNCTION void ma_convproc_dp_intr(
     const Real ed[/* nlev */], const Real dp[/* nlev */], const int ktop,
     const int kbot, ConstSubView qnew,
     const int species_class[/* ConvProc::gas_pcnst */],
+    const ConvProc::SpeciesLists &species,
     const int mmtoo_prevap_resusp[/* ConvProc::gas_pcnst */], SubView dqdt,
     Real qsrflx[/* ConvProc::gas_pcnst */][nsrflx],
     bool dotend[ConvProc::gas_pcnst]) {
@@ -2804,6 +3156,8 @@ KOKKOS_INLINE_FUNCTION void ma_convproc_dp_intr(
    in    :: ktop              ! Index of cloud top
    in    :: kbot              ! Index of cloud bottom
    in    :: species_class[:]  ! species index
+   in    :: species           ! species transported with species_class, as
+                              ! set by set_species_lists for aerosols only
    in    :: mmtoo_prevap_resusp values are:
              >=0 for aerosol mass species with    coarse mode counterpart
              -2 for aerosol mass species WITHOUT coarse mode counterpart
@@ -2847,15 +3201,40 @@ KOKKOS_INLINE_FUNCTION void ma_convproc_dp_intr(
   //
   // clang-format on
 
-  ma_convproc_tend(scratch1Dviews, nlev, ConvProc::Deep, dt, temperature, pmid,
-                   qnew, du, eu, ed, dp, dpdry, ktop, kbot, mmtoo_prevap_resusp,
-                   cldfrac, icwmr, rprddp, evapcdp, dqdt, dotend, qsrflx,
-                   species_class, xx_mfup_max, xx_wcldbase, xx_kcldbase);
+  ma_convproc_tend(team, scratch1Dviews, nlev, ConvProc::Deep, dt, temperature,
+                   pmid, qnew, du, eu, ed, dp, dpdry, ktop, kbot,
+                   mmtoo_prevap_resusp, cldfrac, icwmr, rprddp, evapcdp, dqdt,
+                   dotend, species, qsrflx, species_class, xx_mfup_max,
+                   xx_wcldbase, xx_kcldbase);
 }
 
-// =========================================================================================
 template <typename SubView, typename ConstSubView>
+KOKKOS_INLINE_FUNCTION void ma_convproc_dp_intr(
+    const Kokkos::View<Real *>
+        scratch1Dviews[ConvProc::Col1DViewInd::NumScratch],
+    const int nlev, const Real temperature[/* nlev */],
+    const Real pmid[/* nlev */], const Real dpdry[/* nlev */], const Real dt,
+    const Real cldfrac[/* nlev */], const Real icwmr[/* nlev */],
+    const Real rprddp[/* nlev */], const Real evapcdp[/* nlev */],
+    const Real du[/* nlev */], const Real eu[/* nlev */],
+    const Real ed[/* nlev */], const Real dp[/* nlev */], const int ktop,
+    const int kbot, ConstSubView qnew,
+    const int species_class[/* ConvProc::gas_pcnst */],
+    const int mmtoo_prevap_resusp[/* ConvProc::gas_pcnst */], SubView dqdt,
+    Real qsrflx[/* ConvProc::gas_pcnst */][nsrflx],
+    bool dotend[ConvProc::gas_pcnst]) {
+  ConvProc::SpeciesLists species;
+  set_species_lists(species_class, true, false, species);
+  ma_convproc_dp_intr(SerialTeam(), scratch1Dviews, nlev, temperature, pmid,
+                      dpdry, dt, cldfrac, icwmr, rprddp, evapcdp, du, eu, ed,
+                      dp, ktop, kbot, qnew, species_class, species,
+                      mmtoo_prevap_resusp, dqdt, qsrflx, dotend);
+}
+
+// =========================================================================================
+template <typename Team, typename SubView, typename ConstSubView>
 KOKKOS_INLINE_FUNCTION void ma_convproc_sh_intr(
+    const Team &team,
     const int nlev, const Real temperature[/* nlev */],
     const Real pmid[/* nlev */], const Real dpdry[/* nlev */],
     const Real pdel[/* nlev */], const Real dt, const Real cldfrac[/* nlev */],
@@ -2910,9 +3289,10 @@ KOKKOS_INLINE_FUNCTION void ma_convproc_sh_intr(
   // Therefore, we remove the calculation of the following variables and simply
   // set them in default values for C++ porting.   - Shuaiqi Tang 2023.2.25
   // =========================================================================================
-  for (int i = 0; i < nlev; ++i)
+  team_for(team, 0, nlev, [&](const int i) {
     for (int j = 0; j < ConvProc::gas_pcnst; ++j)
       dqdt(i, j) = 0;
+  });
 
   for (int i = 0; i < ConvProc::gas_pcnst; ++i)
     for (int j = 0; j < nsrflx; ++j)
@@ -2921,13 +3301,64 @@ KOKKOS_INLINE_FUNCTION void ma_convproc_sh_intr(
     dotend[i] = false;
 }
 
+template <typename SubView, typename ConstSubView>
+KOKKOS_INLINE_FUNCTION void ma_convproc_sh_intr(
+    const int nlev, const Real temperature[/* nlev */],
+    const Real pmid[/* nlev */], const Real dpdry[/* nlev */],
+    const Real pdel[/* nlev */], const Real dt, const Real cldfrac[/* nlev */],
+    const Real icwmr[/* nlev */], const Real rprddp[/* nlev */],
+    const Real evapcdp[/* nlev */], ConstSubView qnew,
+    const int species_class[/* ConvProc::gas_pcnst */], SubView dqdt,
+    Real qsrflx[/* ConvProc::gas_pcnst */][nsrflx],
+    bool dotend[ConvProc::gas_pcnst]) {
+  ma_convproc_sh_intr(SerialTeam(), nlev, temperature, pmid, dpdry, pdel, dt,
+                      cldfrac, icwmr, rprddp, evapcdp, qnew, species_class,
+                      dqdt, qsrflx, dotend);
+}
+
 // =========================================================================================
+// Returns true iff the deep convection of the column has mass fluxes, which
+// are integrated from the given entrainment and detrainment rates. Otherwise
+// the deep convective transport makes no change in the column.
+KOKKOS_INLINE_FUNCTION
+bool has_deep_convection(const ThreadTeam &team, const int nlev,
+                         const Real eu[/* nlev */], const Real du[/* nlev */],
+                         const Real ed[/* nlev */]) {
+  int num_active = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::TeamThreadRange(team, nlev),
+      [&](const int kk, int &n) {
+        if (eu[kk] != 0 || du[kk] != 0 || ed[kk] != 0)
+          ++n;
+      },
+      num_active);
+  return num_active > 0;
+}
+// =========================================================================================
+// Returns true iff the column has shallow convective clouds.
+KOKKOS_INLINE_FUNCTION
+bool has_shallow_convection(const ThreadTeam &team, const int nlev,
+                            const Real sh_frac[/* nlev */]) {
+  int num_active = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::TeamThreadRange(team, nlev),
+      [&](const int kk, int &n) {
+        if (sh_frac[kk] != 0)
+          ++n;
+      },
+      num_active);
+  return num_active > 0;
+}
+// =========================================================================================
+// The deep and shallow passes are skipped if do_deep and do_shallow are false,
+// respectively (see has_deep_convection and has_shallow_convection).
 KOKKOS_INLINE_FUNCTION
 void ma_convproc_intr(
     const ThreadTeam &team,
     const Kokkos::View<Real *>
         scratch1Dviews[ConvProc::Col1DViewInd::NumScratch],
-    const bool convproc_do_aer, const bool convproc_do_gas, const int nlev,
+    const bool convproc_do_aer, const bool convproc_do_gas,
+    const bool do_deep, const bool do_shallow, const int nlev,
     const Real temperature[/* nlev */], const Real pmid[/* nlev */],
     const Real dpdry[/* nlev */], const Real pdel[/* nlev */], const Real dt,
     const Real dp_frac[/* nlev */], const Real icwmrdp[/* nlev */],
@@ -2939,6 +3370,7 @@ void ma_convproc_intr(
     const Real eu[/* nlev */], const Real ed[/* nlev */],
     const Real dp[/* nlev */], const int ktop, const int kbot,
     const int species_class[ConvProc::gas_pcnst],
+    const ConvProc::SpeciesLists &species,
     const int mmtoo_prevap_resusp[ConvProc::gas_pcnst],
     const Diagnostics::ColumnTracerView state_q,
     Diagnostics::ColumnTracerView ptend_q, bool ptend_lq[ConvProc::gas_pcnst],
@@ -3014,19 +3446,19 @@ void ma_convproc_intr(
   auto dlfdp = Kokkos::View<Real *, Kokkos::MemoryUnmanaged>(
       scratch1Dviews[ConvProc::Col1DViewInd::dlfdp].data(), nlev);
 
-  for (int j = 0; j < nlev; ++j)
-    for (int i = 0; i < ConvProc::gas_pcnst; ++i)
-      dqdt(j, i) = ptend_q(j, i);
-
   // qnew will update in the subroutines but not update back to state%q
   auto qnew = Diagnostics::ColumnTracerView(
       scratch1Dviews[ConvProc::Col1DViewInd::qnew].data(), nlev,
       ConvProc::gas_pcnst);
   EKAT_KERNEL_ASSERT(state_q.extent(0) == nlev);
   EKAT_KERNEL_ASSERT(state_q.extent(1) <= ConvProc::gas_pcnst);
-  for (int i = 0; i < nlev; ++i)
-    for (int j = 0; j < ConvProc::gas_pcnst; ++j)
+  team_for(team, 0, nlev, [&](const int i) {
+    for (int j = 0; j < ConvProc::gas_pcnst; ++j) {
+      dqdt(i, j) = ptend_q(i, j);
       qnew(i, j) = state_q(i, j);
+    }
+  });
+  team_barrier(team);
 
   // if do tendency
   bool dotend[ConvProc::gas_pcnst];
@@ -3040,32 +3472,41 @@ void ma_convproc_intr(
   // The following loop can be done in parallel even though ptend_lq is
   // overwritten each time I think it is OK since it is overwritten the same
   // from each thread.
-  for (int kk = 0; kk < nlev; ++kk)
+  team_for(team, 0, nlev, [&](const int kk) {
     update_qnew_ptend(dotend, false, Kokkos::subview(dqdt, kk, Kokkos::ALL()),
                       dt, ptend_lq, Kokkos::subview(ptend_q, kk, Kokkos::ALL()),
                       Kokkos::subview(qnew, kk, Kokkos::ALL()));
+  });
+  team_barrier(team);
+
+  if (!convproc_do_aer && !convproc_do_gas)
+    return;
 
-  if (convproc_do_aer || convproc_do_gas) {
+  Real qsrflx[ConvProc::gas_pcnst][nsrflx] = {};
+  if (do_deep) {
     //
     // do deep conv processing
     //
-    Real qsrflx[ConvProc::gas_pcnst][nsrflx] = {};
-    for (int j = 0; j < nlev; ++j)
+    team_for(team, 0, nlev, [&](const int j) {
       for (int i = 0; i < ConvProc::gas_pcnst; ++i)
         dqdt(j, i) = 0;
-    for (int j = 0; j < nlev; ++j)
       dlfdp[j] = haero::max((dlf[j] - dlfsh[j]), 0.0);
-    ma_convproc_dp_intr(scratch1Dviews, nlev, temperature, pmid, dpdry, dt,
-                        dp_frac, icwmrdp, rprddp, evapcdp, du, eu, ed, dp, ktop,
-                        kbot, qnew, species_class, mmtoo_prevap_resusp, dqdt,
-                        qsrflx, dotend);
+    });
+    team_barrier(team);
+    ma_convproc_dp_intr(team, scratch1Dviews, nlev, temperature, pmid, dpdry,
+                        dt, dp_frac, icwmrdp, rprddp, evapcdp, du, eu, ed, dp,
+                        ktop, kbot, qnew, species_class, species,
+                        mmtoo_prevap_resusp, dqdt, qsrflx, dotend);
+    team_barrier(team);
     // apply deep conv processing tendency and prepare for shallow conv
     // processing
-    for (int kk = 0; kk < nlev; ++kk)
+    team_for(team, 0, nlev, [&](const int kk) {
       update_qnew_ptend(dotend, true, Kokkos::subview(dqdt, kk, Kokkos::ALL()),
                         dt, ptend_lq,
                         Kokkos::subview(ptend_q, kk, Kokkos::ALL()),
                         Kokkos::subview(qnew, kk, Kokkos::ALL()));
+    });
+    team_barrier(team);
     // update variables for output
     for (int icnst = 0; icnst < ConvProc::gas_pcnst; ++icnst) {
       // this used for surface coupling:
@@ -3076,25 +3517,29 @@ void ma_convproc_intr(
           species_class[icnst] == ConvProc::species_class::aerosol)
         aerdepwetis[icnst] += qsrflx[icnst][4] + qsrflx[icnst][5];
     }
+  }
+  if (do_shallow) {
     //
     // do shallow conv processing
     //
-    for (int j = 0; j < nlev; ++j)
-      for (int i = 0; i < ConvProc::gas_pcnst; ++i)
-        dqdt(j, i) = 0;
-    for (int j = 0; j < nsrflx; ++j)
-      for (int i = 0; i < ConvProc::gas_pcnst; ++i)
-        qsrflx[i][j] = 0;
-    ma_convproc_sh_intr(nlev, temperature, pmid, dpdry, pdel, dt, sh_frac,
-                        icwmrsh, rprdsh, evapcsh, qnew, species_class, dqdt,
-                        qsrflx, dotend);
+    // The shallow pass reads qnew after the deep tendency is applied, so the
+    // two passes can't run concurrently. Its port has no mass fluxes, though
+    // (see ma_convproc_sh_intr): it flags no species, and then there is
+    // nothing to apply.
+    ma_convproc_sh_intr(team, nlev, temperature, pmid, dpdry, pdel, dt,
+                        sh_frac, icwmrsh, rprdsh, evapcsh, qnew, species_class,
+                        dqdt, qsrflx, dotend);
+    team_barrier(team);
+    if (!any_tendency(dotend))
+      return;
 
     // apply shallow conv processing tendency
-    for (int kk = 0; kk < nlev; ++kk)
+    team_for(team, 0, nlev, [&](const int kk) {
       update_qnew_ptend(dotend, true, Kokkos::subview(dqdt, kk, Kokkos::ALL()),
                         dt, ptend_lq,
                         Kokkos::subview(ptend_q, kk, Kokkos::ALL()),
                         Kokkos::subview(qnew, kk, Kokkos::ALL()));
+    });
     // update variables for output
     for (int icnst = 0; icnst < ConvProc::gas_pcnst; ++icnst) {
       // this used for surface coupling
@@ -3105,15 +3550,14 @@ void ma_convproc_intr(
           species_class[icnst] == ConvProc::species_class::aerosol)
         aerdepwetis[icnst] += qsrflx[icnst][4] + qsrflx[icnst][5];
     }
-  } // (convproc_do_aer || convproc_do_gas)
+  }
 }
 } // namespace convproc
 
-// TODO: The ThreadTeam passed to compute_tendencies is not currently used
-// as there are some low-level function that can not be parallel over the
-// column due to the integration like algorithms.  But there are some
-// functions that could be parallel over the column and these need to
-// be teased out and run with the team.
+// The ThreadTeam passed to compute_tendencies spreads the vertical sweeps of
+// the transported species over its threads (see ma_convproc_tend). Some
+// low-level functions can not be parallel over the column due to their
+// integration like algorithms, and these are run on one thread of the team.
 KOKKOS_INLINE_FUNCTION
 void ConvProc::compute_tendencies(const AeroConfig &config,
                                   const ThreadTeam &team, Real t, Real dt,
@@ -3187,12 +3631,30 @@ void ConvProc::compute_tendencies(const AeroConfig &config,
   bool ptend_lq[ConvProc::gas_pcnst] = {};
   // Aerosol wet deposition (interstitial) [kg/m2/s]
   Real aerdepwetis[ConvProc::gas_pcnst] = {};
+
+  // Columns without deep or shallow convection skip the respective pass.
+  const bool do_deep = convproc::has_deep_convection(team, nlev, eu, du, ed);
+  const bool do_shallow = convproc::has_shallow_convection(team, nlev, sh_frac);
+  if (!do_deep)
+    utils::add_to_counter(team, diagnostics.num_skipped_columns,
+                          Diagnostics::convproc_deep_skipped_columns, 1);
+  if (!do_shallow)
+    utils::add_to_counter(team, diagnostics.num_skipped_columns,
+                          Diagnostics::convproc_shallow_skipped_columns, 1);
+
   convproc::ma_convproc_intr(
-      team, scratch1Dviews, convproc_do_aer, convproc_do_gas, nlev, temperature,
-      pmid, dpdry, pdel, dt, dp_frac, icwmrdp, rprddp, evapcdp, sh_frac,
-      icwmrsh, rprdsh, evapcsh, dlftot, dlfsh, sh_e_ed_ratio, du, eu, ed, dp,
-      ktop, kbot, species_class, mmtoo_prevap_resusp, state_q, ptend_q,
-      ptend_lq, aerdepwetis);
+      team, scratch1Dviews, convproc_do_aer, convproc_do_gas, do_deep,
+      do_shallow, nlev, temperature, pmid, dpdry, pdel, dt, dp_frac, icwmrdp,
+      rprddp, evapcdp, sh_frac, icwmrsh, rprdsh, evapcsh, dlftot, dlfsh,
+      sh_e_ed_ratio, du, eu, ed, dp, ktop, kbot, species_class, species_lists_,
+      mmtoo_prevap_resusp, state_q, ptend_q, ptend_lq, aerdepwetis);
+}
+
+inline void ConvProc::set_species_lists() {
+  // the deep convection transports aerosols but not trace gases (see
+  // convproc::ma_convproc_dp_intr), and the shallow convection nothing
+  convproc::set_species_lists(config_.species_class, true, false,
+                              species_lists_);
 }
 } // namespace mam4
 #endif
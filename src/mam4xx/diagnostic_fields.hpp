@@ -0,0 +1,256 @@
+// mam4xx: Copyright (c) 2022,
+// Battelle Memorial Institute and
+// National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef MAM4XX_DIAGNOSTIC_FIELDS_HPP
+#define MAM4XX_DIAGNOSTIC_FIELDS_HPP
+
+#include <mam4xx/aero_config.hpp>
+#include <mam4xx/convproc.hpp>
+#include <mam4xx/drydep.hpp>
+
+#include <string>
+#include <utility>
+
+namespace mam4 {
+
+/// Description of a view of Diagnostics in the table of for_each_diagnostic
+struct DiagnosticField {
+  /// name of the view, unique within Diagnostics
+  std::string name;
+  /// group of fields in which the view is allocated (see Field)
+  Field group;
+  /// true if the view holds state, false for work arrays, which aren't
+  /// checkpointed or captured
+  bool state;
+  /// extents of the view (extent1 is 0 for rank-1 views)
+  int extent0, extent1;
+};
+
+namespace detail {
+
+// accessor of the view of Diagnostics given by a pointer to data member
+template <typename View> struct Member {
+  View Diagnostics::*ptr;
+  View &operator()(Diagnostics &d) const { return d.*ptr; }
+  const View &operator()(const Diagnostics &d) const { return d.*ptr; }
+};
+
+// accessor of the view of the given mode in a per-mode array of views of
+// Diagnostics
+template <typename View> struct ModeMember {
+  View (Diagnostics::*ptr)[AeroConfig::num_modes()];
+  int mode;
+  View &operator()(Diagnostics &d) const { return (d.*ptr)[mode]; }
+  const View &operator()(const Diagnostics &d) const {
+    return (d.*ptr)[mode];
+  }
+};
+
+} // namespace detail
+
+/// Calls f(field, get) for every view of Diagnostics on the given number of
+/// vertical levels, with field its DiagnosticField and get an accessor such
+/// that get(diags) returns a reference to the view in diags. This table is
+/// the one list of the diagnostic fields: it determines which views
+/// create_diagnostics allocates for each group of fields, which views
+/// checkpoints and captures hold (see io::for_each_field), and the memory
+/// footprints of Diagnostics, so a new view of Diagnostics is added here.
+template <typename F> void for_each_diagnostic(const int num_levels, F f) {
+  using detail::Member;
+  using detail::ModeMember;
+  using D = Diagnostics;
+  using CV = ColumnView;
+  using TV = Diagnostics::ColumnTracerView;
+  const int nlev = num_levels;
+  const int nmodes = AeroConfig::num_modes();
+  const int ntracers = ConvProc::gas_pcnst;
+  const auto column = [&](const std::string &name, const Field group,
+                          CV D::*ptr) {
+    f(DiagnosticField{name, group, true, nlev, 0}, Member<CV>{ptr});
+  };
+
+  // particle sizes and activation fractions of the modes
+  for (int m = 0; m < nmodes; ++m) {
+    const std::string mode = "/" + std::to_string(m);
+    const auto mode_column = [&](const std::string &name, const Field group,
+                                 CV(D::*ptr)[AeroConfig::num_modes()]) {
+      f(DiagnosticField{name + mode, group, true, nlev, 0},
+        ModeMember<CV>{ptr, m});
+    };
+    mode_column("hygroscopicity", field::particle_size, &D::hygroscopicity);
+    mode_column("dry_geometric_mean_diameter_total", field::particle_size,
+                &D::dry_geometric_mean_diameter_total);
+    mode_column("dry_geometric_mean_diameter_i", field::particle_size,
+                &D::dry_geometric_mean_diameter_i);
+    mode_column("dry_geometric_mean_diameter_c", field::particle_size,
+                &D::dry_geometric_mean_diameter_c);
+    mode_column("wet_geometric_mean_diameter_i", field::particle_size,
+                &D::wet_geometric_mean_diameter_i);
+    mode_column("wet_geometric_mean_diameter_c", field::particle_size,
+                &D::wet_geometric_mean_diameter_c);
+    mode_column("wet_density", field::particle_size, &D::wet_density);
+    mode_column("activation_fraction", field::cloud_state,
+                &D::activation_fraction);
+  }
+
+  // gas-aerosol exchange
+  column("uptkrate_h2so4", field::gas_aerosol_exchange, &D::uptkrate_h2so4);
+  column("g0_soa_out", field::gas_aerosol_exchange, &D::g0_soa_out);
+  f(DiagnosticField{"num_substeps", field::gas_aerosol_exchange, true, nlev,
+                    0},
+    Member<DeviceType::view_1d<int>>{&D::num_substeps});
+  f(DiagnosticField{"num_substeps_histogram", field::gas_aerosol_exchange,
+                    true, D::num_substeps_histogram_bins, 0},
+    Member<DeviceType::view_1d<int>>{&D::num_substeps_histogram});
+
+  // cloud state
+  f(DiagnosticField{"is_cloudy", field::cloud_state, true, nlev, 0},
+    Member<DeviceType::view_1d<bool>>{&D::is_cloudy});
+  column("stratiform_cloud_fraction", field::cloud_state,
+         &D::stratiform_cloud_fraction);
+
+  // work arrays and counters shared by processes
+  f(DiagnosticField{"active_levels", field::level_work_arrays, false, nlev,
+                    0},
+    Member<DeviceType::view_1d<int>>{&D::active_levels});
+  f(DiagnosticField{"num_skipped_levels", field::level_work_arrays, true,
+                    D::num_skipped_level_counters, 0},
+    Member<DeviceType::view_1d<int>>{&D::num_skipped_levels});
+  f(DiagnosticField{"num_skipped_columns", field::level_work_arrays, true,
+                    D::num_skipped_column_counters, 0},
+    Member<DeviceType::view_1d<int>>{&D::num_skipped_columns});
+  f(DiagnosticField{"calcsize_input_hash", field::level_work_arrays, false,
+                    nlev, 0},
+    Member<DeviceType::view_1d<std::uint64_t>>{&D::calcsize_input_hash});
+  f(DiagnosticField{"calcsize_diameters", field::level_work_arrays, false,
+                    nlev, 2 * nmodes},
+    Member<DeviceType::view_2d<Real>>{&D::calcsize_diameters});
+
+  // ice nucleation
+  column("icenuc_num_hetfrz", field::ice_nucleation, &D::icenuc_num_hetfrz);
+  column("icenuc_num_immfrz", field::ice_nucleation, &D::icenuc_num_immfrz);
+  column("icenuc_num_depnuc", field::ice_nucleation, &D::icenuc_num_depnuc);
+  column("icenuc_num_meydep", field::ice_nucleation, &D::icenuc_num_meydep);
+  column("num_act_aerosol_ice_nucle_hom", field::ice_nucleation,
+         &D::num_act_aerosol_ice_nucle_hom);
+  column("num_act_aerosol_ice_nucle", field::ice_nucleation,
+         &D::num_act_aerosol_ice_nucle);
+
+  // heterogeneous freezing
+  const std::pair<const char *, CV D::*> hetfrz_columns[] = {
+      {"hetfrz_immersion_nucleation_tend",
+       &D::hetfrz_immersion_nucleation_tend},
+      {"hetfrz_contact_nucleation_tend", &D::hetfrz_contact_nucleation_tend},
+      {"hetfrz_depostion_nucleation_tend",
+       &D::hetfrz_depostion_nucleation_tend},
+      {"bc_num", &D::bc_num},
+      {"dst1_num", &D::dst1_num},
+      {"dst3_num", &D::dst3_num},
+      {"bcc_num", &D::bcc_num},
+      {"dst1c_num", &D::dst1c_num},
+      {"dst3c_num", &D::dst3c_num},
+      {"bcuc_num", &D::bcuc_num},
+      {"dst1uc_num", &D::dst1uc_num},
+      {"dst3uc_num", &D::dst3uc_num},
+      {"bc_a1_num", &D::bc_a1_num},
+      {"dst_a1_num", &D::dst_a1_num},
+      {"dst_a3_num", &D::dst_a3_num},
+      {"bc_c1_num", &D::bc_c1_num},
+      {"dst_c1_num", &D::dst_c1_num},
+      {"dst_c3_num", &D::dst_c3_num},
+      {"fn_bc_c1_num", &D::fn_bc_c1_num},
+      {"fn_dst_c1_num", &D::fn_dst_c1_num},
+      {"fn_dst_c3_num", &D::fn_dst_c3_num},
+      {"na500", &D::na500},
+      {"totna500", &D::totna500},
+      {"freqimm", &D::freqimm},
+      {"freqcnt", &D::freqcnt},
+      {"freqdep", &D::freqdep},
+      {"freqmix", &D::freqmix},
+      {"dstfrezimm", &D::dstfrezimm},
+      {"dstfrezcnt", &D::dstfrezcnt},
+      {"dstfrezdep", &D::dstfrezdep},
+      {"bcfrezimm", &D::bcfrezimm},
+      {"bcfrezcnt", &D::bcfrezcnt},
+      {"bcfrezdep", &D::bcfrezdep},
+      {"nimix_imm", &D::nimix_imm},
+      {"nimix_cnt", &D::nimix_cnt},
+      {"nimix_dep", &D::nimix_dep},
+      {"dstnidep", &D::dstnidep},
+      {"dstnicnt", &D::dstnicnt},
+      {"dstniimm", &D::dstniimm},
+      {"bcnidep", &D::bcnidep},
+      {"bcnicnt", &D::bcnicnt},
+      {"bcniimm", &D::bcniimm},
+      {"numice10s", &D::numice10s},
+      {"numimm10sdst", &D::numimm10sdst},
+      {"numimm10sbc", &D::numimm10sbc}};
+  for (const auto &c : hetfrz_columns)
+    column(c.first, field::heterogeneous_freezing, c.second);
+
+  // convective inputs and outputs
+  const std::pair<const char *, CV D::*> convection_columns[] = {
+      {"hydrostatic_dry_dp", &D::hydrostatic_dry_dp},
+      {"deep_convective_cloud_fraction", &D::deep_convective_cloud_fraction},
+      {"shallow_convective_cloud_fraction",
+       &D::shallow_convective_cloud_fraction},
+      {"deep_convective_cloud_condensate",
+       &D::deep_convective_cloud_condensate},
+      {"shallow_convective_cloud_condensate",
+       &D::shallow_convective_cloud_condensate},
+      {"deep_convective_precipitation_production",
+       &D::deep_convective_precipitation_production},
+      {"shallow_convective_precipitation_production",
+       &D::shallow_convective_precipitation_production},
+      {"evaporation_of_falling_precipitation",
+       &D::evaporation_of_falling_precipitation},
+      {"deep_convective_precipitation_evaporation",
+       &D::deep_convective_precipitation_evaporation},
+      {"shallow_convective_precipitation_evaporation",
+       &D::shallow_convective_precipitation_evaporation},
+      {"total_convective_detrainment", &D::total_convective_detrainment},
+      {"shallow_convective_detrainment", &D::shallow_convective_detrainment},
+      {"shallow_convective_ratio", &D::shallow_convective_ratio},
+      {"mass_entrain_rate_into_updraft", &D::mass_entrain_rate_into_updraft},
+      {"mass_entrain_rate_into_downdraft",
+       &D::mass_entrain_rate_into_downdraft},
+      {"mass_detrain_rate_from_updraft", &D::mass_detrain_rate_from_updraft},
+      {"delta_pressure", &D::delta_pressure}};
+  for (const auto &c : convection_columns)
+    column(c.first, field::convection, c.second);
+  f(DiagnosticField{"tracer_mixing_ratio", field::convection, true, nlev,
+                    ntracers},
+    Member<TV>{&D::tracer_mixing_ratio});
+  f(DiagnosticField{"d_tracer_mixing_ratio_dt", field::convection, true, nlev,
+                    ntracers},
+    Member<TV>{&D::d_tracer_mixing_ratio_dt});
+
+  // wet deposition
+  column("aerosol_wet_deposition_interstitial", field::wet_deposition,
+         &D::aerosol_wet_deposition_interstitial);
+  column("aerosol_wet_deposition_cloud_water", field::wet_deposition,
+         &D::aerosol_wet_deposition_cloud_water);
+
+  // dry deposition
+  using RV = DeviceType::view_1d<Real>;
+  f(DiagnosticField{"fraction_landuse", field::dry_deposition, true,
+                    DryDep::n_land_type, 0},
+    Member<RV>{&D::fraction_landuse});
+  f(DiagnosticField{"aerodynamic_resistance", field::dry_deposition, true, 1,
+                    0},
+    Member<RV>{&D::aerodynamic_resistance});
+  f(DiagnosticField{"friction_velocity", field::dry_deposition, true, 1, 0},
+    Member<RV>{&D::friction_velocity});
+  f(DiagnosticField{"dry_deposition_flux_i", field::dry_deposition, true,
+                    nmodes, AeroConfig::num_aerosol_ids() + 1},
+    Member<DeviceType::view_2d<Real>>{&D::dry_deposition_flux_i});
+  f(DiagnosticField{"dry_deposition_flux_c", field::dry_deposition, true,
+                    nmodes, AeroConfig::num_aerosol_ids() + 1},
+    Member<DeviceType::view_2d<Real>>{&D::dry_deposition_flux_c});
+}
+
+} // namespace mam4
+
+#endif
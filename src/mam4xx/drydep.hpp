@@ -7,13 +7,37 @@
 #define MAM4XX_DRYDEP_HPP
 
 #include <haero/atmosphere.hpp>
+#include <haero/math.hpp>
 #include <mam4xx/aero_config.hpp>
+#include <mam4xx/aero_modes.hpp>
 
 namespace mam4 {
 
+/// @class DryDep
+/// This class implements MAM4's dry deposition and gravitational settling
+/// (sedimentation) of interstitial and cloud-borne aerosols. Its structure is
+/// defined by the usage of the impl_ member in the AeroProcess class in
+/// ../aero_process.hpp.
+///
+/// Settling velocities are computed for the number (moment 0) and mass
+/// (moment 3) of each mode, and the deposition velocity at the surface follows
+/// the resistance model of Zhang et al. (2001) over the land-use types of the
+/// column (see drydep::particle_deposition_velocity). Unlike the explicit
+/// flux-form settling in the Fortran code, the mixing ratios are advanced with
+/// an implicit upwind step (see drydep::implicit_settling_update), which is
+/// stable and positive for any time step, so no CFL-limited substeps are
+/// needed.
 class DryDep {
 
 public:
+  // number of land-use types in the surface resistance model
+  static constexpr int n_land_type = 11;
+
+  // number of sets of tracers sharing a settling velocity: number and mass of
+  // each mode's interstitial aerosols, and number and mass of all cloud-borne
+  // aerosols (which settle with cloud droplets)
+  static constexpr int num_velocity_groups = 2 * AeroConfig::num_modes() + 2;
+
   struct Config {
 
     Config(){};
@@ -21,6 +45,16 @@ public:
     Config(const Config &) = default;
     ~Config() = default;
     Config &operator=(const Config &) = default;
+
+    // particle radius upper limit for the moments of the size distribution
+    // [m] (BAD CONSTANT)
+    Real radius_max = 50.0e-6;
+
+    // properties of the cloud droplets with which cloud-borne aerosols settle
+    // (BAD CONSTANTS)
+    Real cloud_droplet_radius = 5.0e-6; // [m]
+    Real cloud_droplet_density = 1.0e3; // [kg/m3]
+    Real cloud_droplet_std_dev = 1.46;  // [-]
   };
 
 private:
@@ -30,6 +64,24 @@ public:
   // name -- unique name of the process implemented by this class
   const char *name() const { return "MAM4 dry deposition"; }
 
+  // memory_footprint -- bytes of device memory held by this process
+  std::size_t memory_footprint() const { return 0; }
+
+  // field_access -- groups of fields read and written by compute_tendencies
+  KOKKOS_INLINE_FUNCTION
+  static constexpr FieldAccess field_access() {
+    return {field::interstitial_aerosols | field::cloudborne_aerosols |
+                field::particle_size | field::dry_deposition,
+            field::interstitial_aerosols | field::cloudborne_aerosols |
+                field::dry_deposition};
+  }
+
+  // prognostic_update -- compute_tendencies only sets tendencies
+  KOKKOS_INLINE_FUNCTION
+  static constexpr PrognosticUpdate prognostic_update() {
+    return PrognosticUpdate::tendencies_only;
+  }
+
   // init -- initializes the implementation with MAM4's configuration
   void init(const AeroConfig &aero_config,
             const Config &process_config = Config());
@@ -39,7 +91,8 @@ public:
   // valid, false if not
   KOKKOS_INLINE_FUNCTION
   bool validate(const AeroConfig &config, const ThreadTeam &team,
-                const Atmosphere &atm, const Prognostics &progs) const;
+                const Atmosphere &atm, const Surface &sfc,
+                const Prognostics &progs) const;
 
   // compute_tendencies -- computes tendencies and updates diagnostics
   // NOTE: that both diags and tends are const below--this means their views
@@ -47,7 +100,8 @@ public:
   KOKKOS_INLINE_FUNCTION
   void compute_tendencies(const AeroConfig &config, const ThreadTeam &team,
                           Real t, Real dt, const Atmosphere &atm,
-                          const Prognostics &progs, const Diagnostics &diags,
+                          const Surface &sfc, const Prognostics &progs,
+                          const Diagnostics &diags,
                           const Tendencies &tends) const;
 };
 
@@ -154,8 +208,271 @@ Real gravit_settling_velocity(const Real particle_radius,
   return gravit_settling_velocity * dispersion;
 }
 
+//==============================================================================
+// Land-use-dependent parameters of the surface resistance model of
+// Zhang et al. (2001), DOI: 10.1016/S1352-2310(00)00326-5, Table 3
+// (BAD CONSTANTS)
+//==============================================================================
+// exponent of the Schmidt number in the Brownian collection efficiency
+KOKKOS_INLINE_FUNCTION
+Real landuse_gamma(const int lt) {
+  constexpr Real gamma[DryDep::n_land_type] = {
+      0.56, 0.54, 0.54, 0.56, 0.56, 0.56, 0.50, 0.54, 0.54, 0.54, 0.54};
+  return gamma[lt];
+}
+
+// parameter of the impaction collection efficiency
+KOKKOS_INLINE_FUNCTION
+Real landuse_alpha(const int lt) {
+  constexpr Real alpha[DryDep::n_land_type] = {
+      1.50, 1.20, 1.20, 0.80, 1.00, 0.80, 100.00, 50.00, 2.00, 1.20, 50.00};
+  return alpha[lt];
+}
+
+// characteristic radius of the collectors [m] (negative for surfaces without
+// vegetation)
+KOKKOS_INLINE_FUNCTION
+Real landuse_radius_collector(const int lt) {
+  constexpr Real radius_collector[DryDep::n_land_type] = {
+      10.00e-03, 3.50e-03,  3.50e-03, 5.10e-03, 2.00e-03, 5.00e-03,
+      -1.00e+00, -1.00e+00, 10.00e-03, 3.50e-03, -1.00e+00};
+  return radius_collector[lt];
+}
+
+// whether the surface is wet (all particles that reach it stick to it)
+KOKKOS_INLINE_FUNCTION
+bool landuse_is_wet(const int lt) {
+  constexpr bool is_wet[DryDep::n_land_type] = {false, false, false, false,
+                                                 false, false, true,  false,
+                                                 true,  false, false};
+  return is_wet[lt];
+}
+
+//==============================================================================
+// Calculate the deposition velocity [m s-1] of a particle population at the
+// surface: the gravitational settling velocity plus the turbulent deposition
+// velocity through the aerodynamic and quasi-laminar (surface) resistances,
+// weighted by the fractions of the land-use types.
+// See Zhang L. et al. (2001), DOI: 10.1016/S1352-2310(00)00326-5, Eqs. 1-7.
+//==============================================================================
+KOKKOS_INLINE_FUNCTION
+Real particle_deposition_velocity(
+    const Real temp, const Real pres, const Real particle_radius,
+    const Real particle_density, const Real particle_sig,
+    const Real fraction_landuse[DryDep::n_land_type],
+    const Real aerodynamic_resistance, const Real friction_velocity) {
+  const Real vsc_dyn_atm = air_dynamic_viscosity(temp);
+  const Real vsc_knm_atm = air_kinematic_viscosity(temp, pres);
+  const Real slp_crc =
+      slip_correction_factor(vsc_dyn_atm, pres, temp, particle_radius);
+  const Real vlc_grv = gravit_settling_velocity(
+      particle_radius, particle_density, slp_crc, vsc_dyn_atm, particle_sig);
+  const Real shm_nbr = schmidt_number(temp, pres, particle_radius, vsc_dyn_atm,
+                                      vsc_knm_atm);
+
+  Real vlc_dry = 0.0;
+  for (int lt = 0; lt < DryDep::n_land_type; ++lt) {
+    const Real lnd_frc = fraction_landuse[lt];
+    if (lnd_frc == 0.0)
+      continue;
+
+    // collection efficiencies by Brownian diffusion, interception and
+    // impaction
+    const Real brownian = haero::pow(shm_nbr, -landuse_gamma(lt));
+    const Real radius_collector = landuse_radius_collector(lt);
+    Real interception = 0.0, stk_nbr = 0.0;
+    if (radius_collector > 0.0) {
+      // vegetated surface
+      stk_nbr = vlc_grv * friction_velocity /
+                (Constants::gravity * radius_collector);
+      interception = 2.0 * haero::square(particle_radius / radius_collector);
+    } else {
+      // smooth surface
+      stk_nbr = vlc_grv * friction_velocity * friction_velocity /
+                (Constants::gravity * vsc_knm_atm);
+    }
+    const Real impaction =
+        haero::square(stk_nbr / (landuse_alpha(lt) + stk_nbr));
+
+    // fraction of the particles that stick to the surface (BAD CONSTANT)
+    const Real stickfrac =
+        landuse_is_wet(lt)
+            ? 1.0
+            : haero::max(1.0e-10, haero::exp(-haero::sqrt(stk_nbr)));
+
+    // turbulent deposition velocity through the aerodynamic resistance and
+    // the quasi-laminar resistance [s m-1] (none without turbulence)
+    Real vlc_trb = 0.0;
+    if (friction_velocity > 0.0) {
+      const Real rss_lmn =
+          1.0 / (3.0 * friction_velocity * stickfrac *
+                 (brownian + interception + impaction));
+      const Real rss_trb = aerodynamic_resistance + rss_lmn +
+                           aerodynamic_resistance * rss_lmn * vlc_grv;
+      vlc_trb = 1.0 / rss_trb;
+    }
+    vlc_dry += lnd_frc * (vlc_trb + vlc_grv);
+  }
+  return vlc_dry;
+}
+
+//==============================================================================
+// Advance the mixing ratio q [X/kg air] of a tracer in level k by one implicit
+// (backward Euler) upwind step of gravitational settling:
+//
+//   (q_new - q) * dp/g = dt * (rho_above v_above q_new_above - rho v q_new)
+//
+// where rho v is the mass flux of air [kg m-2 s-1] carrying the tracer down
+// out of the level with velocity v. Given the tracer entering from above over
+// the step, flux_in [X m-2], this returns q_new and sets flux_in to the tracer
+// leaving the level, for the level below (or, for the bottom level, the
+// surface deposition over the step). Sweeping the column top to bottom
+// conserves the tracer exactly and keeps it non-negative for any time step.
+//==============================================================================
+KOKKOS_INLINE_FUNCTION
+Real implicit_settling_update(const Real q, const Real air_mass,
+                              const Real air_mass_flux_dt, Real &flux_in) {
+  // air_mass          mass of air in the level per unit area, dp/g [kg m-2]
+  // air_mass_flux_dt  rho * v * dt [kg m-2]
+  const Real q_new = (q * air_mass + flux_in) / (air_mass + air_mass_flux_dt);
+  flux_in = air_mass_flux_dt * q_new;
+  return q_new;
+}
+
 } // namespace drydep
 
+// init -- initializes the implementation with MAM4's configuration
+inline void DryDep::init(const AeroConfig &aero_config,
+                         const Config &process_config) {
+  config_ = process_config;
+}
+
+// validate -- validates the given atmospheric state and prognostics against
+// assumptions made by this implementation, returning true if the states are
+// valid, false if not
+KOKKOS_INLINE_FUNCTION
+bool DryDep::validate(const AeroConfig &config, const ThreadTeam &team,
+                      const Atmosphere &atm, const Surface &sfc,
+                      const Prognostics &progs) const {
+  return atm.quantities_nonnegative(team) &&
+         progs.quantities_nonnegative(team);
+}
+
+// compute_tendencies -- computes tendencies and updates diagnostics
+// NOTE: that both diags and tends are const below--this means their views
+// NOTE: are fixed, but the data in those views is allowed to vary.
+KOKKOS_INLINE_FUNCTION
+void DryDep::compute_tendencies(const AeroConfig &config,
+                                const ThreadTeam &team, Real t, Real dt,
+                                const Atmosphere &atm, const Surface &sfc,
+                                const Prognostics &progs,
+                                const Diagnostics &diags,
+                                const Tendencies &tends) const {
+  static constexpr int num_modes = AeroConfig::num_modes();
+  // at most one number or all mass mixing ratios of all modes per group
+  static constexpr int max_tracers = num_modes * AeroConfig::num_aerosol_ids();
+  const int nk = atm.num_levels();
+
+  // surface properties of the column
+  Real fraction_landuse[n_land_type];
+  for (int lt = 0; lt < n_land_type; ++lt)
+    fraction_landuse[lt] = diags.fraction_landuse(lt);
+  const Real aerodynamic_resistance = diags.aerodynamic_resistance(0);
+  const Real friction_velocity = diags.friction_velocity(0);
+
+  // Each group of tracers sharing a settling velocity is swept down the
+  // column by one thread, computing the velocity once per level.
+  Kokkos::parallel_for(
+      Kokkos::TeamThreadRange(team, num_velocity_groups),
+      KOKKOS_CLASS_LAMBDA(int group) {
+        const bool cloudborne = group >= 2 * num_modes;
+        const int moment = (group % 2 == 0) ? 0 : 3;
+        const int mode_begin = cloudborne ? 0 : group / 2;
+        const int mode_end = cloudborne ? num_modes : mode_begin + 1;
+
+        Real flux_in[max_tracers] = {};
+        for (int k = 0; k < nk; ++k) {
+          const Real temp = atm.temperature(k);
+          const Real pres = atm.pressure(k);
+          const Real rho_air = pres / (Constants::r_gas_dry_air * temp);
+          const Real air_mass = atm.hydrostatic_dp(k) / Constants::gravity;
+
+          // radius [m], density [kg/m3] and geometric standard deviation of
+          // the settling particles
+          Real radius = 0.0, density = 0.0, sig = 0.0;
+          if (cloudborne) {
+            sig = config_.cloud_droplet_std_dev;
+            radius = drydep::radius_for_moment(
+                moment, sig, config_.cloud_droplet_radius, config_.radius_max);
+            density = config_.cloud_droplet_density;
+          } else {
+            sig = modes(mode_begin).mean_std_dev;
+            radius = drydep::radius_for_moment(
+                moment, sig,
+                0.5 * diags.wet_geometric_mean_diameter_i[mode_begin](k),
+                config_.radius_max);
+            density = diags.wet_density[mode_begin](k);
+          }
+
+          // settling velocity out of the level, including turbulent
+          // deposition at the surface [m/s]
+          Real vlc = 0.0;
+          if (radius > 0.0 && density > 0.0) {
+            if (k == nk - 1) {
+              vlc = drydep::particle_deposition_velocity(
+                  temp, pres, radius, density, sig, fraction_landuse,
+                  aerodynamic_resistance, friction_velocity);
+            } else {
+              const Real vsc_dyn_atm = drydep::air_dynamic_viscosity(temp);
+              const Real slp_crc = drydep::slip_correction_factor(
+                  vsc_dyn_atm, pres, temp, radius);
+              vlc = drydep::gravit_settling_velocity(radius, density, slp_crc,
+                                                     vsc_dyn_atm, sig);
+            }
+          }
+          const Real air_mass_flux_dt = rho_air * vlc * dt;
+
+          int i = 0;
+          for (int m = mode_begin; m < mode_end; ++m) {
+            if (moment == 0) {
+              const ColumnView q = cloudborne ? progs.n_mode_c[m]
+                                              : progs.n_mode_i[m];
+              const ColumnView dqdt = cloudborne ? tends.n_mode_c[m]
+                                                 : tends.n_mode_i[m];
+              const Real q_new = drydep::implicit_settling_update(
+                  q(k), air_mass, air_mass_flux_dt, flux_in[i++]);
+              dqdt(k) = (q_new - q(k)) / dt;
+            } else {
+              for (int s = 0; s < num_species_mode(m); ++s) {
+                const ColumnView q = cloudborne ? progs.q_aero_c[m][s]
+                                                : progs.q_aero_i[m][s];
+                const ColumnView dqdt = cloudborne ? tends.q_aero_c[m][s]
+                                                   : tends.q_aero_i[m][s];
+                const Real q_new = drydep::implicit_settling_update(
+                    q(k), air_mass, air_mass_flux_dt, flux_in[i++]);
+                dqdt(k) = (q_new - q(k)) / dt;
+              }
+            }
+          }
+        }
+
+        // surface deposition fluxes [#/m2/s] (number) and [kg/m2/s] (mass)
+        const auto flux = cloudborne ? diags.dry_deposition_flux_c
+                                     : diags.dry_deposition_flux_i;
+        if (flux.data() != nullptr) {
+          int i = 0;
+          for (int m = mode_begin; m < mode_end; ++m) {
+            if (moment == 0) {
+              flux(m, 0) = flux_in[i++] / dt;
+            } else {
+              for (int s = 0; s < num_species_mode(m); ++s)
+                flux(m, 1 + s) = flux_in[i++] / dt;
+            }
+          }
+        }
+      });
+}
+
 } // namespace mam4
 
 #endif
\ No newline at end of file
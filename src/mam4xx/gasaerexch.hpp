@@ -12,6 +12,7 @@
 #include <mam4xx/mam4_types.hpp>
 
 #include <Kokkos_Array.hpp>
+#include <ekat/ekat_assert.hpp>
 #include <haero/atmosphere.hpp>
 #include <haero/constants.hpp>
 #include <haero/haero.hpp>
@@ -105,6 +106,11 @@ public:
     ~Config() = default;
     Config &operator=(const Config &) = default;
     Real dtsub_soa_fixed = -1;
+    // If true, SOA gas-aerosol exchange is advanced with a single implicit step
+    // (see gasaerexch::mam_soaexch_implicit) instead of with adaptive (or
+    // fixed, see dtsub_soa_fixed) substeps. Diagnostics::num_substeps then
+    // holds the number of Newton iterations of the implicit solver.
+    bool soa_implicit = false;
     int ntot_soamode = 4;
 
     // Default Aging:
@@ -131,6 +137,25 @@ public:
   // name -- unique name of the process implemented by this class
   const char *name() const { return "MAM4 gas/aersol exchange"; }
 
+  // memory_footprint -- bytes of device memory held by this process
+  std::size_t memory_footprint() const { return 0; }
+
+  // field_access -- groups of fields read and written by compute_tendencies
+  KOKKOS_INLINE_FUNCTION
+  static constexpr FieldAccess field_access() {
+    return {field::interstitial_aerosols | field::gases | field::uptake_rates |
+                field::particle_size,
+            field::interstitial_aerosols | field::gases | field::uptake_rates |
+                field::gas_aerosol_exchange};
+  }
+
+  // prognostic_update -- compute_tendencies updates the prognostics in place,
+  // and the tendencies it sets only report the change
+  KOKKOS_INLINE_FUNCTION
+  static constexpr PrognosticUpdate prognostic_update() {
+    return PrognosticUpdate::in_place;
+  }
+
   // init -- initializes the implementation with MAM4's configuration
   void init(const AeroConfig &aero_config,
             const Config &process_config = Config());
@@ -180,11 +205,27 @@ private:
 
   bool l_gas_condense_to_mode[num_gas][num_mode] = {};
   int eqn_and_numerics_category[num_gas] = {};
-  Real modes_mean_std_dev[num_mode] = {};
+  // number of Gauss-Hermite quadrature points for the uptake rates and the
+  // log-normal factors of the modes, both fixed at init
+  int nghq_ = 2;
+  ModeLognormalFactors lnsg_terms_;
 };
 
 namespace gasaerexch {
 
+// Returns the bin of Diagnostics::num_substeps_histogram for the given number
+// of SOA substeps: bin 0 holds 1 substep and bin b > 0 holds
+// 2^(b-1) + 1, ..., 2^b substeps. The last bin also holds all larger counts.
+KOKKOS_INLINE_FUNCTION
+int substeps_histogram_bin(const int num_substeps) {
+  int bin = 0;
+  for (int n = 1; n < num_substeps &&
+                  bin < Diagnostics::num_substeps_histogram_bins - 1;
+       n *= 2)
+    ++bin;
+  return bin;
+}
+
 KOKKOS_INLINE_FUNCTION
 void mam_gasaerexch_1subarea_1gas_nonvolatile(
     const Real dt, const Real qgas_netprod_otrproc,
@@ -317,14 +358,148 @@ Real fuchs_sutugin(const Real &D_p, const Real &gasfreepath,
   return fuchs_sutugin;
 }
 
+// Gauss-Hermite quadrature rules of order NGHQ, used to integrate the gas
+// uptake rate over the log-normal size distribution of each mode (see
+// gas_aer_uptkrates_1box1gas). abscissae() and weights() are compile-time
+// constants, so the quadrature loops can be fully unrolled.
+template <int NGHQ> struct GaussHermite;
+
+template <> struct GaussHermite<1> {
+  KOKKOS_INLINE_FUNCTION
+  static constexpr Kokkos::Array<Real, 1> abscissae() { return {0.0}; }
+  KOKKOS_INLINE_FUNCTION
+  static constexpr Kokkos::Array<Real, 1> weights() {
+    return {1.7724538509055159}; // sqrt(pi)
+  }
+};
+
+template <> struct GaussHermite<2> {
+  KOKKOS_INLINE_FUNCTION
+  static constexpr Kokkos::Array<Real, 2> abscissae() {
+    return {-7.0710678118654746e-01, 7.0710678118654746e-01};
+  }
+  KOKKOS_INLINE_FUNCTION
+  static constexpr Kokkos::Array<Real, 2> weights() {
+    return {8.8622692545275794e-01, 8.8622692545275794e-01};
+  }
+};
+
+template <> struct GaussHermite<4> {
+  KOKKOS_INLINE_FUNCTION
+  static constexpr Kokkos::Array<Real, 4> abscissae() {
+    return {-1.6506801238858, -0.52464762327529, 0.52464762327529,
+            1.6506801238858};
+  }
+  KOKKOS_INLINE_FUNCTION
+  static constexpr Kokkos::Array<Real, 4> weights() {
+    return {0.081312835447245, 0.8049140900055, 0.8049140900055,
+            0.081312835447245};
+  }
+};
+
+template <> struct GaussHermite<8> {
+  KOKKOS_INLINE_FUNCTION
+  static constexpr Kokkos::Array<Real, 8> abscissae() {
+    return {-2.9306374202572440, -1.9816567566958429, -1.1571937124467802,
+            -0.3811869902073221, 0.3811869902073221,  1.1571937124467802,
+            1.9816567566958429,  2.9306374202572440};
+  }
+  KOKKOS_INLINE_FUNCTION
+  static constexpr Kokkos::Array<Real, 8> weights() {
+    return {1.9960407221136762e-4, 0.017077983007413475,
+            0.20780232581489188,   0.66114701255824129,
+            0.66114701255824129,   0.20780232581489188,
+            0.017077983007413475,  1.9960407221136762e-4};
+  }
+};
+
+template <> struct GaussHermite<10> {
+  KOKKOS_INLINE_FUNCTION
+  static constexpr Kokkos::Array<Real, 10> abscissae() {
+    return {-3.436159118837737603327,  -2.532731674232789796409,
+            -1.756683649299881773451,  -1.036610829789513654178,
+            -0.3429013272237046087892, 0.3429013272237046087892,
+            1.036610829789513654178,   1.756683649299881773451,
+            2.532731674232789796409,   3.436159118837737603327};
+  }
+  KOKKOS_INLINE_FUNCTION
+  static constexpr Kokkos::Array<Real, 10> weights() {
+    return {7.64043285523262062916e-6,  0.001343645746781232692202,
+            0.0338743944554810631362,   0.2401386110823146864165,
+            0.6108626337353257987836,   0.6108626337353257987836,
+            0.2401386110823146864165,   0.03387439445548106313616,
+            0.001343645746781232692202, 7.64043285523262062916E-6};
+  }
+};
+
+template <> struct GaussHermite<20> {
+  KOKKOS_INLINE_FUNCTION
+  static constexpr Kokkos::Array<Real, 20> abscissae() {
+    return {-5.3874808900112,  -4.6036824495507, -3.9447640401156,
+            -3.3478545673832,  -2.7888060584281, -2.2549740020893,
+            -1.7385377121166,  -1.2340762153953, -0.73747372854539,
+            -0.2453407083009,  0.2453407083009,  0.73747372854539,
+            1.2340762153953,   1.7385377121166,  2.2549740020893,
+            2.7888060584281,   3.3478545673832,  3.9447640401156,
+            4.6036824495507,   5.3874808900112};
+  }
+  KOKKOS_INLINE_FUNCTION
+  static constexpr Kokkos::Array<Real, 20> weights() {
+    return {2.229393645534e-13, 4.399340992273e-10, 1.086069370769e-7,
+            7.80255647853e-6,   2.283386360164e-4,  0.003243773342238,
+            0.024810520887464,  0.10901720602002,   0.28667550536283,
+            0.46224366960061,   0.46224366960061,   0.28667550536283,
+            0.10901720602002,   0.024810520887464,  0.003243773342238,
+            2.283386360164e-4,  7.80255647853e-6,   1.086069370769e-7,
+            4.399340992273e-10, 2.229393645534e-13};
+  }
+};
+
+// Returns true if gas_aer_uptkrates_1box1gas supports the given number of
+// Gauss-Hermite quadrature points.
+KOKKOS_INLINE_FUNCTION
+constexpr bool is_valid_quadrature_order(const int nghq) {
+  return nghq == 1 || nghq == 2 || nghq == 4 || nghq == 8 || nghq == 10 ||
+         nghq == 20;
+}
+
+// Sets the diameter ratios of lnsg_terms at the points of the Gauss-Hermite
+// quadrature rule with nghq points (see is_valid_quadrature_order).
 KOKKOS_INLINE_FUNCTION
-void gas_aer_uptkrates_1box1gas(
+void set_quadrature_points(const int nghq, ModeLognormalFactors &lnsg_terms) {
+  switch (nghq) {
+  case 1:
+    lnsg_terms.set_quadrature_abscissae(GaussHermite<1>::abscissae());
+    break;
+  case 2:
+    lnsg_terms.set_quadrature_abscissae(GaussHermite<2>::abscissae());
+    break;
+  case 4:
+    lnsg_terms.set_quadrature_abscissae(GaussHermite<4>::abscissae());
+    break;
+  case 8:
+    lnsg_terms.set_quadrature_abscissae(GaussHermite<8>::abscissae());
+    break;
+  case 10:
+    lnsg_terms.set_quadrature_abscissae(GaussHermite<10>::abscissae());
+    break;
+  case 20:
+    lnsg_terms.set_quadrature_abscissae(GaussHermite<20>::abscissae());
+    break;
+  default:
+    Kokkos::abort("Invalid integration order requested.");
+  }
+}
+
+template <int NGHQ>
+KOKKOS_INLINE_FUNCTION void gas_aer_uptkrates_1box1gas(
     const bool l_condense_to_mode[GasAerExch::num_mode], const Real temp,
     const Real pmid, const Real pstd, const Real mw_gas, const Real mw_air_gmol,
     const Real vol_molar_gas, const Real vol_molar_air, const Real accom,
     const Real r_universal_mJ, const Real pi, const Real beta_inp,
-    const int nghq, const Real dgncur_awet[GasAerExch::num_mode],
-    const Real lnsg[GasAerExch::num_mode], Real uptkaer[GasAerExch::num_mode]) {
+    const Real dgncur_awet[GasAerExch::num_mode],
+    const ModeLognormalFactors &lnsg_terms,
+    Real uptkaer[GasAerExch::num_mode]) {
   //----------------------------------------------------------------------
   //  Computes   uptake rate parameter uptkaer[0:num_mode] =
   //  uptkrate[0:num_mode]
@@ -344,14 +519,13 @@ void gas_aer_uptkrates_1box1gas(
   //          Kn = Knudsen number (which is a function of Dp)
   //          ac = accomodation coefficient (constant for each gas species)
   //----------------------------------------------------------------------
-  //  using Gauss-Hermite quadrature of order nghq=2
+  //  using Gauss-Hermite quadrature of order NGHQ
   //
   //      D_p = particle diameter (cm)
   //      x = ln(D_p)
   //      dN/dx = log-normal particle number density distribution
   //----------------------------------------------------------------------
   const Real tworootpi = 2 * haero::sqrt(pi);
-  const Real root2 = haero::sqrt(2.0);
   const Real one = 1.0;
   const Real two = 2.0;
 
@@ -360,64 +534,8 @@ void gas_aer_uptkrates_1box1gas(
   // real(wp), save :: xghq(nghq), wghq(nghq) ! quadrature abscissae and
   // weights data xghq / 0.70710678, -0.70710678 / data wghq / 0.88622693,
   // 0.88622693 /
-
-  // choose
-  // nghq-----------------------------------------------------------------
-  const Kokkos::Array<Real, 20> xghq_20 = {
-      -5.3874808900112,  -4.6036824495507, -3.9447640401156, -3.3478545673832,
-      -2.7888060584281,  -2.2549740020893, -1.7385377121166, -1.2340762153953,
-      -0.73747372854539, -0.2453407083009, 0.2453407083009,  0.73747372854539,
-      1.2340762153953,   1.7385377121166,  2.2549740020893,  2.7888060584281,
-      3.3478545673832,   3.9447640401156,  4.6036824495507,  5.3874808900112};
-  const Kokkos::Array<Real, 20> wghq_20 = {
-      2.229393645534e-13, 4.399340992273e-10, 1.086069370769e-7,
-      7.80255647853e-6,   2.283386360164e-4,  0.003243773342238,
-      0.024810520887464,  0.10901720602002,   0.28667550536283,
-      0.46224366960061,   0.46224366960061,   0.28667550536283,
-      0.10901720602002,   0.024810520887464,  0.003243773342238,
-      2.283386360164e-4,  7.80255647853e-6,   1.086069370769e-7,
-      4.399340992273e-10, 2.229393645534e-13};
-  const Kokkos::Array<Real, 10> xghq_10 = {
-      -3.436159118837737603327,  -2.532731674232789796409,
-      -1.756683649299881773451,  -1.036610829789513654178,
-      -0.3429013272237046087892, 0.3429013272237046087892,
-      1.036610829789513654178,   1.756683649299881773451,
-      2.532731674232789796409,   3.436159118837737603327};
-  const Kokkos::Array<Real, 10> wghq_10 = {
-      7.64043285523262062916e-6,  0.001343645746781232692202,
-      0.0338743944554810631362,   0.2401386110823146864165,
-      0.6108626337353257987836,   0.6108626337353257987836,
-      0.2401386110823146864165,   0.03387439445548106313616,
-      0.001343645746781232692202, 7.64043285523262062916E-6};
-  const Kokkos::Array<Real, 4> xghq_4 = {-1.6506801238858, -0.52464762327529,
-                                         0.52464762327529, 1.6506801238858};
-  const Kokkos::Array<Real, 4> wghq_4 = {0.081312835447245, 0.8049140900055,
-                                         0.8049140900055, 0.081312835447245};
-  const Kokkos::Array<Real, 2> xghq_2 = {-7.0710678118654746e-01,
-                                         7.0710678118654746e-01};
-  const Kokkos::Array<Real, 2> wghq_2 = {8.8622692545275794e-01,
-                                         8.8622692545275794e-01};
-  Real const *xghq = nullptr;
-  Real const *wghq = nullptr;
-  if (20 == nghq) {
-    xghq = xghq_20.data();
-    wghq = wghq_20.data();
-  } else if (10 == nghq) {
-    xghq = xghq_10.data();
-    wghq = wghq_10.data();
-  } else if (4 == nghq) {
-    xghq = xghq_4.data();
-    wghq = wghq_4.data();
-  } else if (2 == nghq) {
-    xghq = xghq_2.data();
-    wghq = wghq_2.data();
-  } else {
-    printf("nghq integration option is not available: %d, "
-           "valid are 20, 10, 4, and 2\n",
-           nghq);
-    Kokkos::abort("Invalid integration order requested.");
-  }
-  //-----------------------------------------------------------------------
+  constexpr Kokkos::Array<Real, NGHQ> xghq = GaussHermite<NGHQ>::abscissae();
+  constexpr Kokkos::Array<Real, NGHQ> wghq = GaussHermite<NGHQ>::weights();
 
   // pressure (atmospheres)
   const Real p_in_atm = pmid / pstd;
@@ -456,15 +574,19 @@ void gas_aer_uptkrates_1box1gas(
       beta = beta_inp;
     }
     const Real constant =
-        tworootpi *
-        haero::exp(beta * lndpgn + 0.5 * haero::pow(beta * lnsg[n], 2.0));
+        tworootpi * haero::exp(beta * lndpgn +
+                               0.5 * beta * beta * lnsg_terms.alnsg_sq[n]);
 
-    // sum over gauss-hermite quadrature points
+    // sum over gauss-hermite quadrature points, whose diameters are the
+    // center diameter scaled by the ratios of the mode if they are set
+    const Real lndp_center = lndpgn + beta * lnsg_terms.alnsg_sq[n];
+    const Real dp_center = haero::exp(lndp_center);
     Real sumghq = 0.0;
-    for (int iq = 0; iq < nghq; ++iq) {
-      const Real lndp =
-          lndpgn + beta * lnsg[n] * lnsg[n] + root2 * lnsg[n] * xghq[iq];
-      const Real D_p = haero::exp(lndp);
+    for (int iq = 0; iq < NGHQ; ++iq) {
+      const Real D_p =
+          (lnsg_terms.num_quadrature_points == NGHQ)
+              ? dp_center * lnsg_terms.quadrature_dp_ratio[n][iq]
+              : haero::exp(lndp_center + lnsg_terms.root2_alnsg[n] * xghq[iq]);
 
       const Real hh = fuchs_sutugin(D_p, gasfreepath, accomxp283, accomxp75);
       sumghq += wghq[iq] * D_p * hh / haero::pow(D_p, beta);
@@ -480,6 +602,67 @@ void gas_aer_uptkrates_1box1gas(
   }
 }
 
+// Runtime dispatch of gas_aer_uptkrates_1box1gas<NGHQ> over the supported
+// numbers of quadrature points nghq (see is_valid_quadrature_order).
+KOKKOS_INLINE_FUNCTION
+void gas_aer_uptkrates_1box1gas(
+    const bool l_condense_to_mode[GasAerExch::num_mode], const Real temp,
+    const Real pmid, const Real pstd, const Real mw_gas, const Real mw_air_gmol,
+    const Real vol_molar_gas, const Real vol_molar_air, const Real accom,
+    const Real r_universal_mJ, const Real pi, const Real beta_inp,
+    const int nghq, const Real dgncur_awet[GasAerExch::num_mode],
+    const ModeLognormalFactors &lnsg_terms,
+    Real uptkaer[GasAerExch::num_mode]) {
+#define MAM4_GAS_AER_UPTKRATES(N)                                              \
+  gas_aer_uptkrates_1box1gas<N>(l_condense_to_mode, temp, pmid, pstd, mw_gas,  \
+                                mw_air_gmol, vol_molar_gas, vol_molar_air,     \
+                                accom, r_universal_mJ, pi, beta_inp,           \
+                                dgncur_awet, lnsg_terms, uptkaer)
+  switch (nghq) {
+  case 1:
+    MAM4_GAS_AER_UPTKRATES(1);
+    break;
+  case 2:
+    MAM4_GAS_AER_UPTKRATES(2);
+    break;
+  case 4:
+    MAM4_GAS_AER_UPTKRATES(4);
+    break;
+  case 8:
+    MAM4_GAS_AER_UPTKRATES(8);
+    break;
+  case 10:
+    MAM4_GAS_AER_UPTKRATES(10);
+    break;
+  case 20:
+    MAM4_GAS_AER_UPTKRATES(20);
+    break;
+  default:
+    printf("nghq integration option is not available: %d, "
+           "valid are 20, 10, 8, 4, 2, and 1\n",
+           nghq);
+    Kokkos::abort("Invalid integration order requested.");
+  }
+#undef MAM4_GAS_AER_UPTKRATES
+}
+
+// As above, with the quadrature terms computed from the log of the geometric
+// standard deviation lnsg of each mode.
+KOKKOS_INLINE_FUNCTION
+void gas_aer_uptkrates_1box1gas(
+    const bool l_condense_to_mode[GasAerExch::num_mode], const Real temp,
+    const Real pmid, const Real pstd, const Real mw_gas, const Real mw_air_gmol,
+    const Real vol_molar_gas, const Real vol_molar_air, const Real accom,
+    const Real r_universal_mJ, const Real pi, const Real beta_inp,
+    const int nghq, const Real dgncur_awet[GasAerExch::num_mode],
+    const Real lnsg[GasAerExch::num_mode], Real uptkaer[GasAerExch::num_mode]) {
+  const ModeLognormalFactors lnsg_terms(lnsg);
+  gas_aer_uptkrates_1box1gas(l_condense_to_mode, temp, pmid, pstd, mw_gas,
+                             mw_air_gmol, vol_molar_gas, vol_molar_air, accom,
+                             r_universal_mJ, pi, beta_inp, nghq, dgncur_awet,
+                             lnsg_terms, uptkaer);
+}
+
 KOKKOS_INLINE_FUNCTION
 void mam_gasaerexch_1subarea(
     const int nghq,                               // in
@@ -495,6 +678,7 @@ void mam_gasaerexch_1subarea(
     const int eqn_and_numerics_category[GasAerExch::num_gas], // in
     const Real dt,                                            // in
     const Real dtsub_soa_fixed,                               // in
+    const bool soa_implicit,                                  // in
     const Real temp,                                          // in
     const Real pmid,                                          // in
     const Real aircon,                                        // in
@@ -505,7 +689,7 @@ void mam_gasaerexch_1subarea(
                  [GasAerExch::num_mode],                     // in/out
     Real qnum_cur[GasAerExch::num_mode],                     // in/out
     const Real dgn_awet[GasAerExch::num_mode],               // in
-    const Real alnsg_aer[GasAerExch::num_mode],              // in
+    const ModeLognormalFactors &lnsg_terms,                   // in
     const Real uptk_rate_factor[GasAerExch::num_gas],        // in
     Real uptkaer[GasAerExch::num_gas][GasAerExch::num_mode], // inout
     Real &uptkrate_h2so4,                                    // out
@@ -536,7 +720,7 @@ void mam_gasaerexch_1subarea(
     gasaerexch::gas_aer_uptkrates_1box1gas(
         l_condense_to_mode, temp, pmid, pstd, mw_h2so4_gmol, mw_air_gmol,
         vol_molar_h2so4, vol_molar_air, accom_coef_h2so4, r_universal_mJ, r_pi,
-        beta_inp, nghq, dgn_awet, alnsg_aer, uptkaer_ref);
+        beta_inp, nghq, dgn_awet, lnsg_terms, uptkaer_ref);
 
     // -------------------------------------------------------------
     // Unit conversion: uptkrate is for number = 1 #/m3, so mult. by
@@ -659,9 +843,9 @@ void mam_gasaerexch_1subarea(
   const int ntot_soaspec = 1;
   const GasId soaspec[ntot_soaspec] = {GasId::SOAG};
   mam_soaexch_1subarea(GasAerExch::npca, ntot_soamode, ntot_soaspec, soaspec,
-                       gas_to_aer, dt, dtsub_soa_fixed, pstd, r_universal_mJ,
-                       temp, pmid, uptkaer, qaer_poa, qgas_cur, qgas_avg,
-                       qaer_cur, niter, soa_out);
+                       gas_to_aer, dt, dtsub_soa_fixed, soa_implicit, pstd,
+                       r_universal_mJ, temp, pmid, uptkaer, qaer_poa, qgas_cur,
+                       qgas_avg, qaer_cur, niter, soa_out);
   niter_out = niter;
   g0_soa_out = soa_out;
 }
@@ -674,8 +858,8 @@ void gas_aerosol_uptake_rates_1box(
     const bool l_gas_condense_to_mode[GasAerExch::num_gas]
                                      [GasAerExch::num_mode],
     const int eqn_and_numerics_category[GasAerExch::num_gas],
-    const Real uptk_rate_factor[GasAerExch::num_gas],
-    const Real alnsg_aer[GasAerExch::num_mode]) {
+    const Real uptk_rate_factor[GasAerExch::num_gas], const int nghq,
+    const ModeLognormalFactors &lnsg_terms) {
 
   const Real r_universal = Constants::r_gas; // [J/(K mol)]
   const int num_gas = GasAerExch::num_gas;
@@ -701,9 +885,6 @@ void gas_aerosol_uptake_rates_1box(
   const Real aircon_kmol = pmid / (1000 * r_universal * temp);
   const int ngas = GasAerExch::num_gas_to_aer;
 
-  // set number of ghq points for direct ghq
-  const int nghq = 2; // aero_config.number_gauss_points_for_integration;
-
   // extract gas mixing ratios
   Real qgas_cur[num_gas], qgas_avg[num_gas], qaer_cur[num_aer][num_mode];
   for (int g = 0; g < num_gas; ++g) {
@@ -750,10 +931,11 @@ void gas_aerosol_uptake_rates_1box(
   mam_gasaerexch_1subarea(nghq, igas_h2so4, igas_nh3, ntot_soamode, gas_to_aer,
                           iaer_so4, iaer_pom, l_calc_gas_uptake_coeff,
                           l_gas_condense_to_mode, eqn_and_numerics_category, dt,
-                          dtsub_soa_fixed, temp, pmid, aircon_kmol, ngas,
-                          qgas_cur, qgas_avg, qgas_netprod_otrproc, qaer_cur,
-                          qnum_cur, dgn_awet, alnsg_aer, uptk_rate_factor,
-                          uptkaer, uptkrate_h2so4, niter_out, g0_soa_out);
+                          dtsub_soa_fixed, config.soa_implicit, temp, pmid,
+                          aircon_kmol, ngas, qgas_cur, qgas_avg,
+                          qgas_netprod_otrproc, qaer_cur, qnum_cur, dgn_awet,
+                          lnsg_terms, uptk_rate_factor, uptkaer, uptkrate_h2so4,
+                          niter_out, g0_soa_out);
 
   for (int i = 0; i < num_mode; ++i)
     tends.n_mode_i[i](k) = (qnum_cur[i] - qnum_sv1[i]) / dt;
@@ -781,6 +963,10 @@ void gas_aerosol_uptake_rates_1box(
   diags.g0_soa_out(k) = g0_soa_out;
   diags.uptkrate_h2so4(k) = uptkrate_h2so4;
   diags.num_substeps(k) = niter_out;
+  if (diags.num_substeps_histogram.data() != nullptr) {
+    Kokkos::atomic_add(
+        &diags.num_substeps_histogram(substeps_histogram_bin(niter_out)), 1);
+  }
 }
 
 } // namespace gasaerexch
@@ -791,8 +977,13 @@ inline void GasAerExch::init(const AeroConfig &aero_config,
 
   config_ = process_config;
 
-  for (int imode = 0; imode < num_mode; ++imode)
-    modes_mean_std_dev[imode] = modes(imode).mean_std_dev;
+  nghq_ = aero_config.number_gauss_points_for_integration;
+  EKAT_REQUIRE_MSG(gasaerexch::is_valid_quadrature_order(nghq_),
+                   "GasAerExch: unsupported number of Gauss-Hermite "
+                   "quadrature points: "
+                       << nghq_ << " (valid are 1, 2, 4, 8, 10 and 20)");
+  lnsg_terms_ = ModeLognormalFactors();
+  gasaerexch::set_quadrature_points(nghq_, lnsg_terms_);
 
   //-------------------------------------------------------------------
   // MAM currently uses a splitting method to deal with gas-aerosol
@@ -845,12 +1036,7 @@ void GasAerExch::compute_tendencies(const AeroConfig &config,
                                     const Prognostics &progs,
                                     const Diagnostics &diags,
                                     const Tendencies &tends) const {
-  // const int nghq = 2;  // set number of ghq points for direct ghq
   const int nk = atm.num_levels();
-  Real alnsg_aer[num_mode];
-  for (int k = 0; k < num_mode; ++k)
-    alnsg_aer[k] = std::log(modes_mean_std_dev[k]);
-
   Real uptk_rate[num_gas];
   for (int k = 0; k < num_gas; ++k)
     uptk_rate[k] = GasAerExch::uptk_rate_factor(k);
@@ -860,7 +1046,7 @@ void GasAerExch::compute_tendencies(const AeroConfig &config,
         gasaerexch::gas_aerosol_uptake_rates_1box(
             k, config, dt, atm, progs, diags, tends, config_,
             l_gas_condense_to_mode, eqn_and_numerics_category, uptk_rate,
-            alnsg_aer);
+            nghq_, lnsg_terms_);
       });
 }
 } // namespace mam4
@@ -197,6 +197,142 @@ Real soa_exch_substepsize(
 }
 //===============================================================================================
 
+//===============================================================================================
+// Semi-implicit update of the SOA gas and aerosol mixing ratios over one
+// (sub)step, given beta = step length * uptake-rate-coefficient. The nonlinear
+// equations are linearized about a "hybrid" estimate of the OOA in each mode,
+// and the resulting linear system is solved exactly.
+//===============================================================================================
+KOKKOS_INLINE_FUNCTION
+void soa_exch_linearized_update(
+    const int ntot_soamode,                           // in
+    const int ntot_soaspec,                           // in
+    const bool skip_soamode[AeroConfig::num_modes()], // in
+    const Real beta[][AeroConfig::num_modes()],       // in
+    const Real a_opoa[AeroConfig::num_modes()],       // in
+    const Real g0_soa[],                              // in
+    const Real tot_soa[],                             // in
+    Real g_soa[],                                     // inout
+    Real a_soa[][AeroConfig::num_modes()]) {          // inout
+  using haero::max;
+  static constexpr int max_mode = AeroConfig::num_modes();
+  const Real eps_aer = 1.0e-20; // epsilon to be used on denominator for
+                                // avoiding division by zero
+
+  // variable name "sat": sat(m,ll) = g0_soa(ll)/a_ooa_sum(m) =
+  // g_star(m,ll)/a_soa(m,ll) used by the numerical integration scheme -- it is
+  // not a saturation rato!
+  Real sat_hybrid[AeroConfig::num_gas_ids()][max_mode] = {};
+
+  // ------------------------------------------------------------------------------------------
+  //  Linearize the ODE of each SOA species in each mode
+  // ------------------------------------------------------------------------------------------
+  //  Because the equilibrium SOA mixing ratio (that takes into account the
+  //  solvent effect) depends on the SOA (aerosol) mixing ratio in each mode,
+  //  the time evolution equations for SOAs (aerosol) are nonlinear.
+  //  To numerically solve these nonlinear equations using a
+  //  semi-implicit-in-time scheme, we need to linearize the equations. The
+  //  nonlinear pre-factor in front of an SOA mixing ratio on the RHS of the
+  //  SOA mixing ratio equation is
+  //      uptake-rate-coefficient * g0_soa / mixing-ratio-of-OOA
+  //  Let us denote
+  //      sat = g0_soa / mixing-ratio-of-OOA
+  //  The code block below provides an approximate value of sat (saved in the
+  //  array sat_hybrid) to be used in the semi-implicit solve further down
+  //  below. We refer to this "sat" variable as a "hybrid" one because the
+  //  calculation below uses different expressions for SOA condensation and
+  //  evaporation. The difference is in the SOA (aerosol) mixing ratios used
+  //  for calculating the OOA mixing ratio in the denominaotor of sat.
+  // ------------------------------------------------------------------------------------------
+
+  // temporary SOA aerosol mixrat (mol/mol) used for linearization
+  Real a_soa_hybrid[AeroConfig::num_gas_ids()];
+  for (int n = 0; n < ntot_soamode; ++n) {
+    if (skip_soamode[n])
+      continue;
+
+    for (int ll = 0; ll < ntot_soaspec; ++ll) {
+
+      // First get an estimate of the equilibrium SOA mixing ratio (variable
+      // g_star_old) using the old SOA mixing ratio (variable a_soa)
+
+      // total ooa (=soa+opoa) in a mode, calculated using old SOA mixing
+      // ratio
+      Real a_ooa_sum_old = a_opoa[n];
+      for (int i = 0; i < ntot_soaspec; ++i)
+        a_ooa_sum_old += a_soa[i][n];
+      const Real sat_old = g0_soa[ll] / max(a_ooa_sum_old, eps_aer);
+
+      // soa gas mixrat that is in equilib with each aerosol mode (mol/mol)
+      // diagnosed using old gas and aerosol mixing ratios
+      const Real g_star_old = sat_old * a_soa[ll][n];
+
+      //  Using g_star_old and the current (old) g_soa to determine whether we
+      //  have
+      //   - supersaturation (meaning SOA will be condensing) or
+      //   - undersaturation (meaning SOA will be evaporating)
+
+      // SOA gas supersaturation mixrat (mol/mol at actual mw). < 0 means
+      // unsaturated
+      const Real g_soa_supersat = g_soa[ll] - g_star_old;
+
+      if (g_soa_supersat > 0.0) {
+        //  For modes where SOA is condensing, estimate an approximate "new"
+        //  a_soa(ll,n) using the Euler forward scheme in which both the SOA
+        //  gas mixing ratio and equilibrium mixing ratio are set to their
+        //  "old" values, i.e., the current g_soa and the above-calculated
+        //  g_star_old. Do this to get better estimate of "new" a_soa(ll,n)
+        //  and g_star(ll,n)
+
+        a_soa_hybrid[ll] = a_soa[ll][n] + beta[ll][n] * g_soa_supersat;
+
+      } else {
+        //  For modes where SOA is evaporating, simply use the "old" SOA
+        //  mixing ratio
+        a_soa_hybrid[ll] = a_soa[ll][n];
+      }
+    }
+
+    //  Now, calculate the total OOA in the mode using the a_soa_hybrid
+    //  calculated just now
+
+    // total ooa (=soa+opoa) in a mode, different for condensation/evaporation
+    // cases
+    Real a_ooa_sum_hybrid = a_opoa[n];
+    for (int i = 0; i < ntot_soaspec; ++i)
+      a_ooa_sum_hybrid += a_soa_hybrid[i];
+
+    //  With the newly calculated a_ooa_sum_hybrid, we can now calculate
+    //  the pre-factor in front of the SOA mixing ratio on the RHS of each SOA
+    //  equation, (i.e., variable sat_hybrid).
+
+    for (int ll = 0; ll < ntot_soaspec; ++ll)
+      sat_hybrid[ll][n] = g0_soa[ll] / max(a_ooa_sum_hybrid, eps_aer);
+  }
+  // ------------------------------------------------------------------------------------------
+  //  Implicit solve for the linearize equations
+  // ------------------------------------------------------------------------------------------
+  for (int ll = 0; ll < ntot_soaspec; ++ll) {
+    Real tmpa = 0.0;
+    Real tmpb = 0.0;
+    for (int n = 0; n < ntot_soamode; ++n) {
+      if (!skip_soamode[n]) {
+        tmpa += a_soa[ll][n] / (1.0 + beta[ll][n] * sat_hybrid[ll][n]);
+        tmpb += beta[ll][n] / (1.0 + beta[ll][n] * sat_hybrid[ll][n]);
+      }
+    }
+    g_soa[ll] = (tot_soa[ll] - tmpa) / (1.0 + tmpb);
+    g_soa[ll] = max(0.0, g_soa[ll]);
+    for (int n = 0; n < ntot_soamode; ++n) {
+      if (!skip_soamode[n]) {
+        a_soa[ll][n] = (a_soa[ll][n] + beta[ll][n] * g_soa[ll]) /
+                       (1.0 + beta[ll][n] * sat_hybrid[ll][n]);
+      }
+    }
+  }
+
+}
+
 //===============================================================================================
 // Time integration for the ODE set that describes the condensation/evaporation
 // of SOA
@@ -276,16 +412,8 @@ void mam_soaexch_advance_in_time(
   // dt_cur * uptake-rate-coefficient
   Real beta[AeroConfig::num_gas_ids()][max_mode] = {};
 
-  const Real eps_aer = 1.0e-20; // epsilon to be used on denominator for
-                                // avoiding division by zero
   const Real eps_dt = 1.0e-3;
 
-  // variable name "sat": sat(m,ll) = g0_soa(ll)/a_ooa_sum(m) =
-  // g_star(m,ll)/a_soa(m,ll) used by the numerical integration scheme -- it is
-  // not a saturation rato!
-
-  Real sat_hybrid[AeroConfig::num_gas_ids()][max_mode] = {};
-
   Real tot_soa[AeroConfig::num_gas_ids()] = {}; // g_soa + sum( a_soa(:) )
 
   // ----------------------------------------------------------------------
@@ -390,112 +518,8 @@ void mam_soaexch_advance_in_time(
       }
     }
 
-    // ------------------------------------------------------------------------------------------
-    //  Linearize the ODE of each SOA species in each mode
-    // ------------------------------------------------------------------------------------------
-    //  Because the equilibrium SOA mixing ratio (that takes into account the
-    //  solvent effect) depends on the SOA (aerosol) mixing ratio in each mode,
-    //  the time evolution equations for SOAs (aerosol) are nonlinear.
-    //  To numerically solve these nonlinear equations using a
-    //  semi-implicit-in-time scheme, we need to linearize the equations. The
-    //  nonlinear pre-factor in front of an SOA mixing ratio on the RHS of the
-    //  SOA mixing ratio equation is
-    //      uptake-rate-coefficient * g0_soa / mixing-ratio-of-OOA
-    //  Let us denote
-    //      sat = g0_soa / mixing-ratio-of-OOA
-    //  The code block below provides an approximate value of sat (saved in the
-    //  array sat_hybrid) to be used in the semi-implicit solve further down
-    //  below. We refer to this "sat" variable as a "hybrid" one because the
-    //  calculation below uses different expressions for SOA condensation and
-    //  evaporation. The difference is in the SOA (aerosol) mixing ratios used
-    //  for calculating the OOA mixing ratio in the denominaotor of sat.
-    // ------------------------------------------------------------------------------------------
-
-    // temporary SOA aerosol mixrat (mol/mol) used for linearization
-    Real a_soa_hybrid[AeroConfig::num_gas_ids()];
-    for (int n = 0; n < ntot_soamode; ++n) {
-      if (skip_soamode[n])
-        continue;
-
-      for (int ll = 0; ll < ntot_soaspec; ++ll) {
-
-        // First get an estimate of the equilibrium SOA mixing ratio (variable
-        // g_star_old) using the old SOA mixing ratio (variable a_soa)
-
-        // total ooa (=soa+opoa) in a mode, calculated using old SOA mixing
-        // ratio
-        Real a_ooa_sum_old = a_opoa[n];
-        for (int i = 0; i < ntot_soaspec; ++i)
-          a_ooa_sum_old += a_soa[i][n];
-        const Real sat_old = g0_soa[ll] / max(a_ooa_sum_old, eps_aer);
-
-        // soa gas mixrat that is in equilib with each aerosol mode (mol/mol)
-        // diagnosed using old gas and aerosol mixing ratios
-        const Real g_star_old = sat_old * a_soa[ll][n];
-
-        //  Using g_star_old and the current (old) g_soa to determine whether we
-        //  have
-        //   - supersaturation (meaning SOA will be condensing) or
-        //   - undersaturation (meaning SOA will be evaporating)
-
-        // SOA gas supersaturation mixrat (mol/mol at actual mw). < 0 means
-        // unsaturated
-        const Real g_soa_supersat = g_soa[ll] - g_star_old;
-
-        if (g_soa_supersat > 0.0) {
-          //  For modes where SOA is condensing, estimate an approximate "new"
-          //  a_soa(ll,n) using the Euler forward scheme in which both the SOA
-          //  gas mixing ratio and equilibrium mixing ratio are set to their
-          //  "old" values, i.e., the current g_soa and the above-calculated
-          //  g_star_old. Do this to get better estimate of "new" a_soa(ll,n)
-          //  and g_star(ll,n)
-
-          a_soa_hybrid[ll] = a_soa[ll][n] + beta[ll][n] * g_soa_supersat;
-
-        } else {
-          //  For modes where SOA is evaporating, simply use the "old" SOA
-          //  mixing ratio
-          a_soa_hybrid[ll] = a_soa[ll][n];
-        }
-      }
-
-      //  Now, calculate the total OOA in the mode using the a_soa_hybrid
-      //  calculated just now
-
-      // total ooa (=soa+opoa) in a mode, different for condensation/evaporation
-      // cases
-      Real a_ooa_sum_hybrid = a_opoa[n];
-      for (int i = 0; i < ntot_soaspec; ++i)
-        a_ooa_sum_hybrid += a_soa_hybrid[i];
-
-      //  With the newly calculated a_ooa_sum_hybrid, we can now calculate
-      //  the pre-factor in front of the SOA mixing ratio on the RHS of each SOA
-      //  equation, (i.e., variable sat_hybrid).
-
-      for (int ll = 0; ll < ntot_soaspec; ++ll)
-        sat_hybrid[ll][n] = g0_soa[ll] / max(a_ooa_sum_hybrid, eps_aer);
-    }
-    // ------------------------------------------------------------------------------------------
-    //  Implicit solve for the linearize equations
-    // ------------------------------------------------------------------------------------------
-    for (int ll = 0; ll < ntot_soaspec; ++ll) {
-      Real tmpa = 0.0;
-      Real tmpb = 0.0;
-      for (int n = 0; n < ntot_soamode; ++n) {
-        if (!skip_soamode[n]) {
-          tmpa += a_soa[ll][n] / (1.0 + beta[ll][n] * sat_hybrid[ll][n]);
-          tmpb += beta[ll][n] / (1.0 + beta[ll][n] * sat_hybrid[ll][n]);
-        }
-      }
-      g_soa[ll] = (tot_soa[ll] - tmpa) / (1.0 + tmpb);
-      g_soa[ll] = max(0.0, g_soa[ll]);
-      for (int n = 0; n < ntot_soamode; ++n) {
-        if (!skip_soamode[n]) {
-          a_soa[ll][n] = (a_soa[ll][n] + beta[ll][n] * g_soa[ll]) /
-                         (1.0 + beta[ll][n] * sat_hybrid[ll][n]);
-        }
-      }
-    }
+    soa_exch_linearized_update(ntot_soamode, ntot_soaspec, skip_soamode, beta,
+                               a_opoa, g0_soa, tot_soa, g_soa, a_soa);
 
     // ------------------------------------------------------------------------------------------
     //  Save mix ratios for soa species
@@ -531,6 +555,197 @@ void mam_soaexch_advance_in_time(
   }
 }
 
+//===============================================================================================
+// Backward Euler update of the SOA aerosol mixing ratio a in a single mode for
+// a given SOA gas mixing ratio g:
+//   a = a_old + beta * (g - g0_soa * a / (a_ooa_other + a)),
+// where a_ooa_other is the OOA in the mode that is not this SOA species. This
+// is a quadratic in a with exactly one non-negative root, which is returned
+// along with its derivative with respect to g (da_dg).
+//===============================================================================================
+KOKKOS_INLINE_FUNCTION
+Real soa_exch_implicit_mode_update(const Real a_old,       // in
+                                   const Real beta,        // in
+                                   const Real g0_soa,      // in
+                                   const Real a_ooa_other, // in
+                                   const Real g,           // in
+                                   Real &da_dg) {          // out
+  // a^2 + b a - c a_ooa_other = 0, with
+  const Real c = a_old + beta * g;
+  const Real b = a_ooa_other + beta * g0_soa - c;
+  const Real disc = haero::sqrt(b * b + 4.0 * c * a_ooa_other);
+  // use the form of the root that avoids cancellation
+  const Real a = (b > 0.0) ? 2.0 * c * a_ooa_other / (b + disc)
+                           : 0.5 * (disc - b);
+  da_dg = (disc > 0.0) ? beta * (a + a_ooa_other) / disc : beta;
+  return a;
+}
+
+//===============================================================================================
+// Unconditionally stable alternative to mam_soaexch_advance_in_time that
+// advances the SOA condensation/evaporation ODEs over the full time step with
+// a single backward Euler step, so that its cost does not grow with the
+// stiffness of the exchange (i.e. with uptkaer * dt_full).
+//
+// For each mode, soa_exch_implicit_mode_update gives the new aerosol mixing
+// ratio a_n(g) as a function of the new gas mixing ratio g. Since a_n(g) is
+// increasing in g, the new g is the unique root on [0, tot_soa] of
+//   F(g) = g + sum_n a_n(g) - tot_soa.
+// The linearized update used by mam_soaexch_advance_in_time (with a single
+// substep of length dt_full) provides the initial guess, which is corrected by
+// at most niter_max Newton iterations, safeguarded by bisection. The gas
+// mixing ratio is finally diagnosed from the aerosol mixing ratios so that
+// total SOA is conserved exactly.
+//
+// With more than one SOA species, the OOA from the other species is held at
+// its old value in each species' solve.
+//===============================================================================================
+KOKKOS_INLINE_FUNCTION
+void mam_soaexch_implicit(
+    const int ntot_soamode,    // in
+    const int ntot_soaspec,    // in
+    const GasId soaspec[],     // in len ntot_soaspec
+    const AeroId gas_to_aer[], // in
+    const Real dt_full,        // in
+    const int niter_max,       // in
+    const Real rel_tol,        // in
+    const Real uptkaer[AeroConfig::num_gas_ids()]
+                      [AeroConfig::num_modes()], // in
+    const Real g0_soa[],                         // in len ntot_soaspec
+    Real qgas_cur[AeroConfig::num_gas_ids()],    // inout
+    const Real a_opoa[AeroConfig::num_modes()],  // in
+    Real qaer_cur[AeroConfig::num_aerosol_ids()]
+                 [AeroConfig::num_modes()],   // inout
+    Real qgas_avg[AeroConfig::num_gas_ids()], // inout
+    int &niter)                               // out
+{
+  // clang-format off
+  // dt_full       Host model dt (s)
+  // niter_max     Maximum number of Newton iterations per SOA species
+  // rel_tol       Convergence tolerance for F(g), relative to total SOA
+  // niter         Total number of Newton iterations (over all SOA species)
+  // (see mam_soaexch_advance_in_time for the other arguments)
+  // clang-format on
+
+  using haero::max;
+  using haero::min;
+  static constexpr int max_mode = AeroConfig::num_modes();
+
+  Real a_soa[AeroConfig::num_gas_ids()][max_mode] = {};
+  Real a_soa_old[AeroConfig::num_gas_ids()][max_mode] = {};
+  Real g_soa[AeroConfig::num_gas_ids()] = {};
+  Real tot_soa[AeroConfig::num_gas_ids()] = {};
+  Real beta[AeroConfig::num_gas_ids()][max_mode] = {};
+  bool skip_soamode[max_mode] = {};
+
+  // modes with negligible transfer rates are not involved (as in
+  // mam_soaexch_advance_in_time)
+  for (int n = 0; n < max_mode; ++n)
+    skip_soamode[n] = true;
+  for (int n = 0; n < ntot_soamode; ++n) {
+    for (int ll = 0; ll < ntot_soaspec; ++ll) {
+      const int soa = static_cast<int>(soaspec[ll]);
+      if (uptkaer[soa][n] > 1.0e-15) {
+        beta[ll][n] = dt_full * uptkaer[soa][n];
+        skip_soamode[n] = false;
+      }
+    }
+  }
+
+  // load non-negative gas and aerosol mixing ratios and totals
+  for (int ll = 0; ll < ntot_soaspec; ++ll) {
+    const int soa = static_cast<int>(soaspec[ll]);
+    g_soa[ll] = max(qgas_cur[soa], 0.0);
+    tot_soa[ll] = g_soa[ll];
+  }
+  for (int n = 0; n < ntot_soamode; ++n) {
+    if (!skip_soamode[n]) {
+      for (int ll = 0; ll < ntot_soaspec; ++ll) {
+        const int soa =
+            static_cast<int>(gas_to_aer[static_cast<int>(soaspec[ll])]);
+        a_soa[ll][n] = max(qaer_cur[soa][n], 0.0);
+        a_soa_old[ll][n] = a_soa[ll][n];
+        tot_soa[ll] += a_soa[ll][n];
+      }
+    }
+  }
+  Real g_soa_old[AeroConfig::num_gas_ids()] = {};
+  for (int ll = 0; ll < ntot_soaspec; ++ll)
+    g_soa_old[ll] = g_soa[ll];
+
+  // initial guess: linearized update over the full time step
+  soa_exch_linearized_update(ntot_soamode, ntot_soaspec, skip_soamode, beta,
+                             a_opoa, g0_soa, tot_soa, g_soa, a_soa);
+
+  niter = 0;
+  for (int ll = 0; ll < ntot_soaspec; ++ll) {
+    // OOA in each mode other than this SOA species (held at old values)
+    Real a_ooa_other[max_mode] = {};
+    for (int n = 0; n < ntot_soamode; ++n) {
+      if (!skip_soamode[n]) {
+        a_ooa_other[n] = a_opoa[n];
+        for (int i = 0; i < ntot_soaspec; ++i)
+          if (i != ll)
+            a_ooa_other[n] += a_soa_old[i][n];
+      }
+    }
+
+    // safeguarded Newton iterations for F(g) = 0 on [g_lo, g_hi]
+    const Real tol = rel_tol * tot_soa[ll];
+    Real g_lo = 0.0, g_hi = tot_soa[ll];
+    Real g = min(max(g_soa[ll], g_lo), g_hi);
+    for (int iter = 0; iter < niter_max; ++iter) {
+      Real f = g - tot_soa[ll], df_dg = 1.0;
+      for (int n = 0; n < ntot_soamode; ++n) {
+        if (!skip_soamode[n]) {
+          Real da_dg;
+          f += soa_exch_implicit_mode_update(a_soa_old[ll][n], beta[ll][n],
+                                             g0_soa[ll], a_ooa_other[n], g,
+                                             da_dg);
+          df_dg += da_dg;
+        }
+      }
+      ++niter;
+      if (haero::abs(f) <= tol)
+        break;
+      if (f > 0.0)
+        g_hi = g;
+      else
+        g_lo = g;
+      g -= f / df_dg;
+      if (!(g > g_lo && g < g_hi))
+        g = 0.5 * (g_lo + g_hi);
+    }
+
+    // final aerosol mixing ratios, and gas diagnosed from total SOA
+    Real a_sum = 0.0;
+    for (int n = 0; n < ntot_soamode; ++n) {
+      if (!skip_soamode[n]) {
+        Real da_dg;
+        a_soa[ll][n] = soa_exch_implicit_mode_update(
+            a_soa_old[ll][n], beta[ll][n], g0_soa[ll], a_ooa_other[n], g,
+            da_dg);
+        a_sum += a_soa[ll][n];
+      }
+    }
+    g_soa[ll] = max(0.0, tot_soa[ll] - a_sum);
+  }
+
+  // save mixing ratios; the time average of the gas mixing ratio is
+  // diagnosed as in mam_soaexch_advance_in_time (for a single substep)
+  for (int ll = 0; ll < ntot_soaspec; ++ll) {
+    const int soa_aer =
+        static_cast<int>(gas_to_aer[static_cast<int>(soaspec[ll])]);
+    for (int n = 0; n < ntot_soamode; ++n) {
+      if (!skip_soamode[n])
+        qaer_cur[soa_aer][n] = a_soa[ll][n];
+    }
+    const int soa = static_cast<int>(soaspec[ll]);
+    qgas_cur[soa] = g_soa[ll];
+    qgas_avg[soa] = max(0.0, 0.5 * (g_soa_old[ll] + g_soa[ll]));
+  }
+}
+
 // --------------------------------------------------------------------
 // Calculate secondary organic aerosols, soa,
 // condensation/evaporation over time dt
@@ -543,6 +758,7 @@ void mam_soaexch_1subarea(const int mode_pca,          // in
                           const AeroId gas_to_aer[],   // in
                           const Real dt,               // in
                           const Real dt_sub_soa_fixed, // in
+                          const bool soa_implicit,     // in
                           const Real pstd,             // in
                           const Real r_universal,      // in
                           const Real temp,             // in
@@ -565,6 +781,8 @@ void mam_soaexch_1subarea(const int mode_pca,          // in
   // const AeroId gas_to_aer[GasAerExch::num_gas],
   // dt               time step size used by parent subroutine
   // dt_sub_soa_fixed fixed sub-step in s. A negative value  means using adaptive step sizes
+  // soa_implicit     if true, use the unconditionally stable solver mam_soaexch_implicit
+  //                  instead of sub-stepping (dt_sub_soa_fixed is then ignored)
   // pstd             standard atmosphere in Pa
   // r_universal      universal gas constant in J/K/mol
   // temp             temperature (K)
@@ -574,7 +792,7 @@ void mam_soaexch_1subarea(const int mode_pca,          // in
   // qgas_cur         current gas mixing ratio
   // qgas_avg
   // qaer_cur         current aerosol mass mix ratio (mol/mol)
-  // niter
+  // niter            number of substeps, or of Newton iterations if soa_implicit
   // g0_soa           ambient soa gas equilib mixrat (mol/mol at actual mw)
   // clang-format on
 
@@ -626,6 +844,18 @@ void mam_soaexch_1subarea(const int mode_pca,          // in
     for (int i = 0; i < ntot_poaspec; ++i)
       a_opoa[n] += opoa_frac[i][n] * qaer_poa[i][n];
   }
+  if (soa_implicit) {
+    // -----------------------------------------------------------
+    //  Time stepping -- a single implicit step of length dt
+    // -----------------------------------------------------------
+    const int niter_newton_max = 20;
+    const Real rel_tol = 1.0e-10;
+    mam_soaexch_implicit(ntot_soamode, ntot_soaspec, soaspec, gas_to_aer, dt,
+                         niter_newton_max, rel_tol, uptkaer, &g0_soa, qgas_cur,
+                         a_opoa, qaer_cur, qgas_avg, niter);
+    return;
+  }
+
   // -----------------------------------------------------------
   //  Time stepping -- uses multiple substeps to reach dtfull
   // -----------------------------------------------------------
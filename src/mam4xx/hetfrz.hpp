@@ -36,6 +36,23 @@ public:
   // name -- unique name of the process implemented by this class
   const char *name() const { return "MAM4 heterogeneous freezing"; }
 
+  // memory_footprint -- bytes of device memory held by this process
+  std::size_t memory_footprint() const { return 0; }
+
+  // field_access -- groups of fields read and written by compute_tendencies
+  KOKKOS_INLINE_FUNCTION
+  static constexpr FieldAccess field_access() {
+    return {field::interstitial_aerosols | field::cloudborne_aerosols |
+                field::cloud_state,
+            field::heterogeneous_freezing};
+  }
+
+  // prognostic_update -- compute_tendencies only sets tendencies
+  KOKKOS_INLINE_FUNCTION
+  static constexpr PrognosticUpdate prognostic_update() {
+    return PrognosticUpdate::tendencies_only;
+  }
+
   // init -- initializes the implementation with MAM4's configuration
   void init(const AeroConfig &aero_config,
             const Config &process_config = Config());
@@ -0,0 +1,792 @@
+// mam4xx: Copyright (c) 2022,
+// Battelle Memorial Institute and
+// National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef MAM4XX_IO_HPP
+#define MAM4XX_IO_HPP
+
+#include <mam4xx/aero_config.hpp>
+#include <mam4xx/aging.hpp>
+#include <mam4xx/calcsize.hpp>
+#include <mam4xx/coagulation.hpp>
+#include <mam4xx/convproc.hpp>
+#include <mam4xx/diagnostic_fields.hpp>
+#include <mam4xx/drydep.hpp>
+#include <mam4xx/gasaerexch.hpp>
+#include <mam4xx/hetfrz.hpp>
+#include <mam4xx/mode_size_state.hpp>
+#include <mam4xx/nucleate_ice.hpp>
+#include <mam4xx/nucleation.hpp>
+#include <mam4xx/rename.hpp>
+#include <mam4xx/water_uptake.hpp>
+#include <mam4xx/wet_dep.hpp>
+
+#include <ekat/ekat_assert.hpp>
+#include <haero/atmosphere.hpp>
+#include <haero/haero.hpp>
+#include <haero/surface.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MAM4XX_IO_HAS_MMAP 1
+#endif
+
+/// The mam4::io namespace contains host-side functions for checkpointing and
+/// restarting the state of a set of MAM4 columns, and for capturing the inputs
+/// of columns for offline replay.
+namespace mam4::io {
+
+/// Version of the checkpoint format written by Checkpoint::write
+constexpr std::uint32_t checkpoint_version = 1;
+
+/// Options for reading checkpoints
+struct ReadOptions {
+  /// If true, the file is memory-mapped instead of being read into memory,
+  /// and field data are copied straight from the mapping (where supported)
+  bool memory_map = false;
+  /// If true, the checksum of every field is verified when it is loaded
+  bool verify_checksums = true;
+};
+
+// The for_each_field functions call f(name, view) for every (allocated or
+// not) view of the given column container that holds state, with a name
+// unique within the container.
+
+template <typename F>
+void for_each_field(const haero::Atmosphere &atm, F f) {
+  f("temperature", atm.temperature);
+  f("pressure", atm.pressure);
+  f("vapor_mixing_ratio", atm.vapor_mixing_ratio);
+  f("liquid_mixing_ratio", atm.liquid_mixing_ratio);
+  f("cloud_liquid_number_mixing_ratio", atm.cloud_liquid_number_mixing_ratio);
+  f("ice_mixing_ratio", atm.ice_mixing_ratio);
+  f("height", atm.height);
+  f("hydrostatic_dp", atm.hydrostatic_dp);
+  f("cloud_fraction", atm.cloud_fraction);
+  f("updraft_vel_ice_nucleation", atm.updraft_vel_ice_nucleation);
+  f("planetary_boundary_layer_height",
+    Kokkos::View<const Real *, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>(
+        &atm.planetary_boundary_layer_height, 1));
+}
+
+// haero::Surface has no fields yet, so its columns are stored (and loaded) as
+// empty containers.
+template <typename F> void for_each_field(const haero::Surface &sfc, F f) {}
+
+template <typename F> void for_each_field(const Prognostics &progs, F f) {
+  for (int m = 0; m < AeroConfig::num_modes(); ++m) {
+    const std::string mode = "/" + std::to_string(m);
+    f("n_mode_i" + mode, progs.n_mode_i[m]);
+    f("n_mode_c" + mode, progs.n_mode_c[m]);
+    for (int s = 0; s < AeroConfig::num_aerosol_ids(); ++s) {
+      const std::string species = mode + "/" + std::to_string(s);
+      f("q_aero_i" + species, progs.q_aero_i[m][s]);
+      f("q_aero_c" + species, progs.q_aero_c[m][s]);
+    }
+  }
+  for (int g = 0; g < AeroConfig::num_gas_ids(); ++g) {
+    const std::string gas = "/" + std::to_string(g);
+    f("q_gas" + gas, progs.q_gas[g]);
+    f("q_gas_avg" + gas, progs.q_gas_avg[g]);
+    for (int m = 0; m < AeroConfig::num_modes(); ++m)
+      f("uptkaer" + gas + "/" + std::to_string(m), progs.uptkaer[g][m]);
+  }
+}
+
+// The views of Diagnostics come from the table of for_each_diagnostic, without
+// its work arrays (e.g. active_levels), which aren't part of the state.
+template <typename F> void for_each_field(const Diagnostics &diags, F f) {
+  for_each_diagnostic(diags.num_levels(),
+                      [&](const DiagnosticField &info, const auto &get) {
+                        if (info.state)
+                          f(info.name, get(diags));
+                      });
+}
+
+namespace detail {
+
+// 64-bit FNV-1a hash of the given bytes
+inline std::uint64_t checksum(const void *data, const std::size_t size) {
+  const unsigned char *bytes = static_cast<const unsigned char *>(data);
+  std::uint64_t hash = 0xcbf29ce484222325ull;
+  for (std::size_t i = 0; i < size; ++i) {
+    hash ^= bytes[i];
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+// copies the values of the given (contiguous) view to the given host array.
+// Real views are copied whole, straight from the view if it is on the host;
+// other views are converted to Reals through a host mirror.
+template <typename View> void copy_to_host(const View &v, Real *values) {
+  using T = typename View::non_const_value_type;
+  if constexpr (std::is_same_v<T, Real>) {
+    using HostView =
+        Kokkos::View<typename View::non_const_data_type,
+                     typename View::array_layout, Kokkos::HostSpace,
+                     Kokkos::MemoryUnmanaged>;
+    Kokkos::deep_copy(HostView(values, v.layout()), v);
+  } else {
+    const auto h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v);
+    std::transform(h.data(), h.data() + h.span(), values,
+                   [](const T x) { return static_cast<Real>(x); });
+  }
+}
+
+// copies the given host array into the given (contiguous) view, the
+// counterpart of copy_to_host. Other views are filled through a host mirror,
+// which isn't initialized from the view since it is overwritten.
+template <typename View>
+void copy_from_host(const Real *values, const View &v) {
+  using T = typename View::non_const_value_type;
+  if constexpr (std::is_same_v<T, Real>) {
+    using HostView =
+        Kokkos::View<typename View::const_data_type,
+                     typename View::array_layout, Kokkos::HostSpace,
+                     Kokkos::MemoryUnmanaged>;
+    Kokkos::deep_copy(v, HostView(values, v.layout()));
+  } else {
+    const auto h = Kokkos::create_mirror_view(Kokkos::WithoutInitializing, v);
+    std::transform(values, values + h.span(), h.data(),
+                   [](const Real x) { return static_cast<T>(x); });
+    Kokkos::deep_copy(v, h);
+  }
+}
+
+// writable alias of the given (possibly const) view. Atmosphere views are
+// read-only in mam4xx, but are restored from checkpoints like the others.
+template <typename View> auto writable(const View &v) {
+  using T = typename View::non_const_value_type;
+  return Kokkos::View<typename View::non_const_data_type,
+                      typename View::array_layout,
+                      typename View::memory_space, Kokkos::MemoryUnmanaged>(
+      const_cast<T *>(v.data()), v.layout());
+}
+
+// On-disk layout: a Header, num_fields FieldRecords, and the data of all
+// fields starting at data_offset (aligned to data_alignment bytes). Each field
+// holds the values of all columns, one column after the other.
+constexpr char magic[8] = {'M', 'A', 'M', '4', 'X', 'X', 'C', 'K'};
+constexpr std::size_t max_name_length = 96;
+constexpr std::uint64_t data_alignment = 64;
+
+struct Header {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t real_size;
+  std::uint64_t num_columns;
+  std::uint64_t num_fields;
+  std::uint64_t data_offset;
+};
+
+struct FieldRecord {
+  char name[max_name_length];
+  std::uint64_t offset; // in Reals from the start of the data
+  std::uint64_t count;  // number of Reals (for all columns)
+  std::uint64_t checksum;
+};
+
+} // namespace detail
+
+/// @class Checkpoint
+/// A Checkpoint holds named fields of Real values for a set of columns in a
+/// single contiguous buffer, and writes and reads them as one binary file.
+///
+/// The state of the columns is added with store() (e.g. for
+/// std::vector<Prognostics> or std::vector<Diagnostics>), and put back into
+/// (allocated) views with load(). Only allocated views are stored, so
+/// checkpoints of lazily allocated Diagnostics contain only the fields in use.
+/// Integer and boolean diagnostics are stored as Reals.
+///
+/// Processes aren't checkpointed: all of their data, such as the impaction
+/// scavenging tables of WetDeposition (scavimptblnum, scavimptblvol) and the
+/// work arrays of WetDeposition and ConvProc, are rebuilt by init() from the
+/// process configuration, so a restart calls init() with the configurations
+/// of the checkpointed run. Process state that isn't rebuilt by init() would
+/// be stored as plain arrays of values with store(name, values).
+class Checkpoint {
+public:
+  /// Creates an empty checkpoint for the given number of columns
+  explicit Checkpoint(const int num_columns) : num_columns_(num_columns) {
+    EKAT_REQUIRE_MSG(num_columns > 0, "Checkpoint: invalid number of columns");
+  }
+
+  Checkpoint(const Checkpoint &) = default;
+  Checkpoint(Checkpoint &&) = default;
+  ~Checkpoint() = default;
+  Checkpoint &operator=(const Checkpoint &) = default;
+  Checkpoint &operator=(Checkpoint &&) = default;
+
+  /// Returns the number of columns
+  int num_columns() const { return num_columns_; }
+
+  /// Returns the number of fields
+  int num_fields() const { return static_cast<int>(records_.size()); }
+
+  /// Returns true iff the checkpoint has a field with the given name
+  bool has(const std::string &name) const { return find_(name) != nullptr; }
+
+  /// Adds the allocated views of the given columns (one container per
+  /// column), naming each field prefix + "/" + its name in the container.
+  template <typename Column>
+  void store(const std::string &prefix, const std::vector<Column> &columns) {
+    EKAT_REQUIRE_MSG(static_cast<int>(columns.size()) == num_columns_,
+                     "Checkpoint: expected " << num_columns_ << " columns");
+    EKAT_REQUIRE_MSG(!mapping_, "Checkpoint: can't add fields to a checkpoint "
+                                "read from a memory-mapped file");
+    // the fields allocated in the first column get records, whose values are
+    // then copied from the views of each column in turn
+    const std::size_t first = records_.size();
+    for_each_field(columns[0], [&](const std::string &name, const auto &v) {
+      if (!v.is_allocated())
+        return;
+      const std::string field = prefix + "/" + name;
+      EKAT_REQUIRE_MSG(field.size() < detail::max_name_length,
+                       "Checkpoint: field name too long: " << field);
+      EKAT_REQUIRE_MSG(!has(field), "Checkpoint: duplicate field " << field);
+      add_record_({field, buffer_.size(), v.span() * num_columns_, 0});
+      buffer_.resize(buffer_.size() + v.span() * num_columns_);
+    });
+    for (int icol = 0; icol < num_columns_; ++icol) {
+      std::size_t num_stored = 0;
+      for_each_field(columns[icol], [&](const std::string &name,
+                                        const auto &v) {
+        if (!v.is_allocated())
+          return;
+        const std::string field = prefix + "/" + name;
+        const Record *record = find_(field);
+        EKAT_REQUIRE_MSG(record && record->count == v.span() * num_columns_,
+                         "Checkpoint: "
+                             << field << " is not allocated in all columns"
+                             << " or differs in size among them");
+        detail::copy_to_host(v, buffer_.data() + record->offset +
+                                    icol * v.span());
+        ++num_stored;
+      });
+      EKAT_REQUIRE_MSG(num_stored == records_.size() - first,
+                       "Checkpoint: the fields of "
+                           << prefix << " are not allocated in all columns");
+    }
+    for (std::size_t r = first; r < records_.size(); ++r) {
+      records_[r].checksum = detail::checksum(
+          buffer_.data() + records_[r].offset, records_[r].count * sizeof(Real));
+    }
+  }
+
+  /// Adds a field with the given values
+  void store(const std::string &name, const std::vector<Real> &values) {
+    EKAT_REQUIRE_MSG(name.size() < detail::max_name_length,
+                     "Checkpoint: field name too long: " << name);
+    EKAT_REQUIRE_MSG(!has(name), "Checkpoint: duplicate field " << name);
+    EKAT_REQUIRE_MSG(!mapping_, "Checkpoint: can't add fields to a checkpoint "
+                                "read from a memory-mapped file");
+    Record record;
+    record.name = name;
+    record.offset = buffer_.size();
+    record.count = values.size();
+    record.checksum =
+        detail::checksum(values.data(), values.size() * sizeof(Real));
+    buffer_.insert(buffer_.end(), values.begin(), values.end());
+    add_record_(record);
+  }
+
+  /// Copies the stored fields into the allocated views of the given columns,
+  /// which must have the layout of the stored ones. Throws if an allocated
+  /// view has no stored field, or if a checksum doesn't match.
+  template <typename Column>
+  void load(const std::string &prefix, std::vector<Column> &columns) const {
+    EKAT_REQUIRE_MSG(static_cast<int>(columns.size()) == num_columns_,
+                     "Checkpoint: expected " << num_columns_ << " columns");
+    for (int icol = 0; icol < num_columns_; ++icol) {
+      for_each_field(columns[icol], [&](const std::string &name,
+                                        const auto &v) {
+        if (!v.is_allocated())
+          return;
+        const std::string field = prefix + "/" + name;
+        const Record *record = find_(field);
+        EKAT_REQUIRE_MSG(record, "Checkpoint: missing field " << field);
+        const std::size_t count = record->count / num_columns_;
+        EKAT_REQUIRE_MSG(count == v.span(),
+                         "Checkpoint: size mismatch for " << field);
+        if (icol == 0)
+          verify_(*record);
+        detail::copy_from_host(data_() + record->offset + icol * count,
+                               detail::writable(v));
+      });
+    }
+  }
+
+  /// Returns the values of the field with the given name
+  std::vector<Real> values(const std::string &name) const {
+    const Record *record = find_(name);
+    EKAT_REQUIRE_MSG(record, "Checkpoint: missing field " << name);
+    verify_(*record);
+    const Real *begin = data_() + record->offset;
+    return std::vector<Real>(begin, begin + record->count);
+  }
+
+  /// Writes the checkpoint to the file with the given name
+  void write(const std::string &filename) const {
+    detail::Header header;
+    std::memcpy(header.magic, detail::magic, sizeof(header.magic));
+    header.version = checkpoint_version;
+    header.real_size = sizeof(Real);
+    header.num_columns = num_columns_;
+    header.num_fields = records_.size();
+    const std::size_t records_size =
+        records_.size() * sizeof(detail::FieldRecord);
+    header.data_offset = aligned_(sizeof(header) + records_size);
+
+    std::ofstream file(filename, std::ios::binary);
+    EKAT_REQUIRE_MSG(file, "Checkpoint: can't open " << filename);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    for (const Record &record : records_) {
+      detail::FieldRecord r = {};
+      std::strncpy(r.name, record.name.c_str(), sizeof(r.name) - 1);
+      r.offset = record.offset;
+      r.count = record.count;
+      r.checksum = record.checksum;
+      file.write(reinterpret_cast<const char *>(&r), sizeof(r));
+    }
+    const std::size_t padding = header.data_offset - static_cast<std::size_t>(
+                                                         file.tellp());
+    const char zeros[detail::data_alignment] = {};
+    file.write(zeros, padding);
+    const std::size_t size = (records_.empty())
+                                 ? 0
+                                 : records_.back().offset +
+                                       records_.back().count;
+    file.write(reinterpret_cast<const char *>(data_()), size * sizeof(Real));
+    EKAT_REQUIRE_MSG(file, "Checkpoint: error writing " << filename);
+  }
+
+  /// Reads the checkpoint in the file with the given name
+  static Checkpoint read(const std::string &filename,
+                         const ReadOptions &options) {
+    std::ifstream file(filename, std::ios::binary);
+    EKAT_REQUIRE_MSG(file, "Checkpoint: can't open " << filename);
+    detail::Header header;
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+    EKAT_REQUIRE_MSG(file && std::memcmp(header.magic, detail::magic,
+                                         sizeof(header.magic)) == 0,
+                     "Checkpoint: " << filename << " is not a checkpoint");
+    EKAT_REQUIRE_MSG(header.version == checkpoint_version,
+                     "Checkpoint: unsupported version " << header.version
+                                                        << " in " << filename);
+    EKAT_REQUIRE_MSG(header.real_size == sizeof(Real),
+                     "Checkpoint: " << filename << " was written with "
+                                    << 8 * header.real_size
+                                    << "-bit reals");
+
+    Checkpoint checkpoint(static_cast<int>(header.num_columns));
+    checkpoint.verify_checksums_ = options.verify_checksums;
+    std::size_t size = 0;
+    for (std::uint64_t i = 0; i < header.num_fields; ++i) {
+      detail::FieldRecord r;
+      file.read(reinterpret_cast<char *>(&r), sizeof(r));
+      r.name[sizeof(r.name) - 1] = '\0';
+      checkpoint.add_record_({r.name, r.offset, r.count, r.checksum});
+      size = std::max<std::size_t>(size, r.offset + r.count);
+    }
+    EKAT_REQUIRE_MSG(file, "Checkpoint: truncated header in " << filename);
+
+#ifdef MAM4XX_IO_HAS_MMAP
+    if (options.memory_map) {
+      file.close();
+      checkpoint.map_(filename, header.data_offset, size);
+      return checkpoint;
+    }
+#endif
+    checkpoint.buffer_.resize(size);
+    file.seekg(header.data_offset);
+    file.read(reinterpret_cast<char *>(checkpoint.buffer_.data()),
+              size * sizeof(Real));
+    EKAT_REQUIRE_MSG(file, "Checkpoint: truncated data in " << filename);
+    return checkpoint;
+  }
+
+private:
+  struct Record {
+    std::string name;
+    std::size_t offset;
+    std::size_t count;
+    std::uint64_t checksum;
+  };
+
+  static std::uint64_t aligned_(const std::uint64_t offset) {
+    return (offset + detail::data_alignment - 1) / detail::data_alignment *
+           detail::data_alignment;
+  }
+
+  void add_record_(const Record &record) {
+    index_[record.name] = records_.size();
+    records_.push_back(record);
+  }
+
+  const Record *find_(const std::string &name) const {
+    const auto iter = index_.find(name);
+    return (iter != index_.end()) ? &records_[iter->second] : nullptr;
+  }
+
+  const Real *data_() const {
+    return (mapping_) ? mapped_data_ : buffer_.data();
+  }
+
+  void verify_(const Record &record) const {
+    if (!verify_checksums_)
+      return;
+    const std::uint64_t checksum = detail::checksum(
+        data_() + record.offset, record.count * sizeof(Real));
+    EKAT_REQUIRE_MSG(checksum == record.checksum,
+                     "Checkpoint: checksum mismatch for " << record.name);
+  }
+
+#ifdef MAM4XX_IO_HAS_MMAP
+  // maps the data of the given file, which holds size Reals at offset
+  void map_(const std::string &filename, const std::uint64_t offset,
+            const std::size_t size) {
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    EKAT_REQUIRE_MSG(fd >= 0, "Checkpoint: can't open " << filename);
+    struct stat st;
+    const std::size_t length = offset + size * sizeof(Real);
+    const bool ok = (::fstat(fd, &st) == 0) &&
+                    (static_cast<std::size_t>(st.st_size) >= length);
+    void *addr =
+        (ok) ? ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0) : nullptr;
+    ::close(fd);
+    EKAT_REQUIRE_MSG(ok && addr != MAP_FAILED,
+                     "Checkpoint: can't map " << filename);
+    mapping_ = std::shared_ptr<void>(
+        addr, [length](void *p) { ::munmap(p, length); });
+    mapped_data_ = reinterpret_cast<const Real *>(
+        static_cast<const char *>(addr) + offset);
+  }
+#endif
+
+  int num_columns_;
+  std::vector<Record> records_;
+  std::map<std::string, std::size_t> index_; // indices of records by name
+  // field data, held in buffer_ or in a memory-mapped file
+  std::vector<Real> buffer_;
+  std::shared_ptr<void> mapping_;
+  const Real *mapped_data_ = nullptr;
+  bool verify_checksums_ = true;
+};
+
+// The for_each_parameter functions call f(name, value) for every parameter of
+// the given configuration, with each element of an array parameter named
+// name + "/" + its index. The parameters of a process configuration are named
+// "<process>/<parameter>".
+
+namespace detail {
+
+template <typename T, typename F>
+void parameter(const std::string &name, T &value, F &f) {
+  if constexpr (std::is_array_v<T>) {
+    for (std::size_t i = 0; i < std::extent_v<T>; ++i)
+      parameter(name + "/" + std::to_string(i), value[i], f);
+  } else {
+    f(name, value);
+  }
+}
+
+} // namespace detail
+
+template <typename F> void for_each_parameter(AeroConfig &c, F f) {
+  detail::parameter("calculate_gas_uptake_coefficient",
+                    c.calculate_gas_uptake_coefficient, f);
+  detail::parameter("number_gauss_points_for_integration",
+                    c.number_gauss_points_for_integration, f);
+}
+
+template <typename F> void for_each_parameter(Aging::Config &c, F f) {}
+
+template <typename F> void for_each_parameter(CalcSize::Config &c, F f) {
+  detail::parameter("calcsize/do_aitacc_transfer", c.do_aitacc_transfer, f);
+  detail::parameter("calcsize/do_adjust", c.do_adjust, f);
+  detail::parameter("calcsize/reuse_unchanged_levels",
+                    c.reuse_unchanged_levels, f);
+}
+
+template <typename F> void for_each_parameter(Coagulation::Config &c, F f) {}
+
+template <typename F> void for_each_parameter(ConvProc::Config &c, F f) {
+  detail::parameter("convproc/convproc_do_aer", c.convproc_do_aer, f);
+  detail::parameter("convproc/convproc_do_gas", c.convproc_do_gas, f);
+  detail::parameter("convproc/nlev", c.nlev, f);
+  detail::parameter("convproc/ktop", c.ktop, f);
+  detail::parameter("convproc/kbot", c.kbot, f);
+  detail::parameter("convproc/species_class", c.species_class, f);
+  detail::parameter("convproc/mmtoo_prevap_resusp", c.mmtoo_prevap_resusp, f);
+}
+
+template <typename F> void for_each_parameter(DryDep::Config &c, F f) {
+  detail::parameter("drydep/radius_max", c.radius_max, f);
+  detail::parameter("drydep/cloud_droplet_radius", c.cloud_droplet_radius, f);
+  detail::parameter("drydep/cloud_droplet_density", c.cloud_droplet_density,
+                    f);
+  detail::parameter("drydep/cloud_droplet_std_dev", c.cloud_droplet_std_dev,
+                    f);
+}
+
+template <typename F> void for_each_parameter(GasAerExch::Config &c, F f) {
+  detail::parameter("gasaerexch/dtsub_soa_fixed", c.dtsub_soa_fixed, f);
+  detail::parameter("gasaerexch/soa_implicit", c.soa_implicit, f);
+  detail::parameter("gasaerexch/ntot_soamode", c.ntot_soamode, f);
+  detail::parameter("gasaerexch/l_mode_can_age", c.l_mode_can_age, f);
+  detail::parameter("gasaerexch/calculate_gas_uptake_coefficient",
+                    c.calculate_gas_uptake_coefficient, f);
+  detail::parameter("gasaerexch/qgas_netprod_otrproc", c.qgas_netprod_otrproc,
+                    f);
+}
+
+template <typename F> void for_each_parameter(Hetfrz::Config &c, F f) {}
+
+template <typename F> void for_each_parameter(ModeSize::Config &c, F f) {
+  detail::parameter("mode_size/water_uptake", c.water_uptake, f);
+}
+
+template <typename F> void for_each_parameter(NucleateIce::Config &c, F f) {
+  detail::parameter("nucleate_ice/nucleate_ice_subgrid",
+                    c._nucleate_ice_subgrid, f);
+  detail::parameter("nucleate_ice/so4_sz_thresh_icenuc",
+                    c._so4_sz_thresh_icenuc, f);
+}
+
+template <typename F> void for_each_parameter(Nucleation::Config &c, F f) {
+  detail::parameter("nucleation/dens_so4a_host", c.dens_so4a_host, f);
+  detail::parameter("nucleation/mw_nh4a_host", c.mw_nh4a_host, f);
+  detail::parameter("nucleation/mw_so4a_host", c.mw_so4a_host, f);
+  detail::parameter("nucleation/newnuc_method_user_choice",
+                    c.newnuc_method_user_choice, f);
+  detail::parameter("nucleation/pbl_nuc_wang2008_user_choice",
+                    c.pbl_nuc_wang2008_user_choice, f);
+  detail::parameter("nucleation/adjust_factor_bin_tern_ratenucl",
+                    c.adjust_factor_bin_tern_ratenucl, f);
+  detail::parameter("nucleation/adjust_factor_pbl_ratenucl",
+                    c.adjust_factor_pbl_ratenucl, f);
+  detail::parameter("nucleation/accom_coef_h2so4", c.accom_coef_h2so4, f);
+  detail::parameter("nucleation/newnuc_adjust_factor_dnaitdt",
+                    c.newnuc_adjust_factor_dnaitdt, f);
+  detail::parameter("nucleation/use_rate_table", c.use_rate_table, f);
+  detail::parameter("nucleation/rate_table_num_temp", c.rate_table_num_temp,
+                    f);
+  detail::parameter("nucleation/rate_table_num_rh", c.rate_table_num_rh, f);
+  detail::parameter("nucleation/rate_table_num_h2so4", c.rate_table_num_h2so4,
+                    f);
+  detail::parameter("nucleation/rate_table_num_ter_temp",
+                    c.rate_table_num_ter_temp, f);
+  detail::parameter("nucleation/rate_table_num_ter_rh",
+                    c.rate_table_num_ter_rh, f);
+  detail::parameter("nucleation/rate_table_num_ter_h2so4",
+                    c.rate_table_num_ter_h2so4, f);
+  detail::parameter("nucleation/rate_table_num_nh3", c.rate_table_num_nh3, f);
+}
+
+template <typename F> void for_each_parameter(Rename::Config &c, F f) {
+  detail::parameter("rename/dest_mode_of_mode", c._dest_mode_of_mode, f);
+  detail::parameter("rename/molecular_weight_soa", c._molecular_weight_soa, f);
+  detail::parameter("rename/molecular_weight_so4", c._molecular_weight_so4, f);
+  detail::parameter("rename/molecular_weight_pom", c._molecular_weight_pom, f);
+  detail::parameter("rename/smallest_dryvol_value", c._smallest_dryvol_value,
+                    f);
+  detail::parameter("rename/mam4xx2rename_idx", c._mam4xx2rename_idx, f);
+}
+
+template <typename F> void for_each_parameter(Water_Uptake::Config &c, F f) {}
+
+template <typename F> void for_each_parameter(WetDeposition::Config &c, F f) {
+  detail::parameter("wetdep/nlev", c.nlev, f);
+  detail::parameter("wetdep/mam_prevap_resusp_optcc",
+                    c.mam_prevap_resusp_optcc, f);
+}
+
+/// Adds the parameters of the given configuration to the given checkpoint,
+/// naming each prefix + "/" + its name in the configuration.
+template <typename Config>
+void store_parameters(Checkpoint &checkpoint, const std::string &prefix,
+                      Config config) {
+  for_each_parameter(config, [&](const std::string &name, const auto &value) {
+    checkpoint.store(prefix + "/" + name, {static_cast<Real>(value)});
+  });
+}
+
+/// Sets the parameters of the given configuration stored in the given
+/// checkpoint by store_parameters with the given prefix, returning the number
+/// of parameters that were not stored (and keep their values).
+template <typename Config>
+int load_parameters(const Checkpoint &checkpoint, const std::string &prefix,
+                    Config &config) {
+  int num_missing = 0;
+  for_each_parameter(config, [&](const std::string &name, auto &value) {
+    const std::string field = prefix + "/" + name;
+    if (!checkpoint.has(field)) {
+      ++num_missing;
+      return;
+    }
+    using T = std::decay_t<decltype(value)>;
+    const Real stored = checkpoint.values(field)[0];
+    if constexpr (std::is_same_v<T, bool>)
+      value = (stored != 0);
+    else
+      value = static_cast<T>(stored);
+  });
+  return num_missing;
+}
+
+/// Options for capturing the inputs of selected columns to a file, from which
+/// mam4xx_replay reruns them through any process in isolation (e.g. for
+/// profiling). Capturing is off unless a filename and columns are given.
+struct CaptureOptions {
+  /// Name of the file written by each capture, which is overwritten by later
+  /// captures unless per_step is set
+  std::string filename;
+  /// Indices of the columns to capture
+  std::vector<int> columns;
+  /// If true, each capture is written to its own file, named filename + "." +
+  /// the number of the capture (0, 1, ...), so that the inputs of every step
+  /// are kept
+  bool per_step = false;
+
+  /// Returns true iff captures are enabled
+  bool enabled() const { return !filename.empty() && !columns.empty(); }
+
+  /// Returns the name of the file written by the next capture
+  std::string next_filename() const {
+    return (per_step) ? filename + "." + std::to_string(num_captures_)
+                      : filename;
+  }
+
+  /// Returns options read from the environment: MAM4XX_CAPTURE_FILE names the
+  /// file, MAM4XX_CAPTURE_COLUMNS lists the column indices, separated by
+  /// commas (e.g. "0,17,42"), and MAM4XX_CAPTURE_PER_STEP=1 sets per_step.
+  static CaptureOptions from_environment() {
+    CaptureOptions options;
+    if (const char *filename = std::getenv("MAM4XX_CAPTURE_FILE"))
+      options.filename = filename;
+    if (const char *columns = std::getenv("MAM4XX_CAPTURE_COLUMNS")) {
+      std::istringstream stream(columns);
+      std::string column;
+      while (std::getline(stream, column, ','))
+        options.columns.push_back(std::stoi(column));
+    }
+    if (const char *per_step = std::getenv("MAM4XX_CAPTURE_PER_STEP"))
+      options.per_step = (std::string(per_step) == "1");
+    return options;
+  }
+
+private:
+  template <typename... ProcessConfigs>
+  friend void capture_columns(const CaptureOptions &, const AeroConfig &,
+                              Real, Real,
+                              const DeviceType::view_1d<haero::Atmosphere> &,
+                              const DeviceType::view_1d<haero::Surface> &,
+                              const DeviceType::view_1d<Prognostics> &,
+                              const DeviceType::view_1d<Diagnostics> &,
+                              const ProcessConfigs &...);
+
+  // number of captures written with these options
+  mutable int num_captures_ = 0;
+};
+
+/// Writes the exact inputs of the columns selected by the given options (their
+/// atmospheric and surface state, prognostics, and diagnostics, along with the
+/// time, time step, and the configuration of MAM4 and of the given processes)
+/// to the options' file. Fields are named "atm/...", "sfc/...", "progs/...",
+/// "diags/...", "capture/..." and "config/..." (see for_each_parameter).
+template <typename... ProcessConfigs>
+void capture_columns(const CaptureOptions &options, const AeroConfig &config,
+                     const Real t, const Real dt,
+                     const DeviceType::view_1d<haero::Atmosphere> &atm,
+                     const DeviceType::view_1d<haero::Surface> &sfc,
+                     const DeviceType::view_1d<Prognostics> &progs,
+                     const DeviceType::view_1d<Diagnostics> &diags,
+                     const ProcessConfigs &...process_configs) {
+  EKAT_REQUIRE_MSG(!options.columns.empty(),
+                   "capture_columns: no columns selected");
+  const auto h_atm =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), atm);
+  const auto h_sfc =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), sfc);
+  const auto h_progs =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), progs);
+  const auto h_diags =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), diags);
+  std::vector<haero::Atmosphere> atm_columns;
+  std::vector<haero::Surface> sfc_columns;
+  std::vector<Prognostics> progs_columns;
+  std::vector<Diagnostics> diags_columns;
+  std::vector<Real> columns;
+  for (const int icol : options.columns) {
+    EKAT_REQUIRE_MSG(0 <= icol && icol < atm.extent_int(0),
+                     "capture_columns: invalid column index " << icol);
+    atm_columns.push_back(h_atm(icol));
+    sfc_columns.push_back(h_sfc(icol));
+    progs_columns.push_back(h_progs(icol));
+    diags_columns.push_back(h_diags(icol));
+    columns.push_back(icol);
+  }
+  Checkpoint capture(static_cast<int>(columns.size()));
+  capture.store("atm", atm_columns);
+  capture.store("sfc", sfc_columns);
+  capture.store("progs", progs_columns);
+  capture.store("diags", diags_columns);
+  capture.store("capture/columns", columns);
+  capture.store("capture/num_levels", {Real(atm_columns[0].num_levels())});
+  capture.store("capture/time", {t});
+  capture.store("capture/time_step", {dt});
+  store_parameters(capture, "config", config);
+  (store_parameters(capture, "config", process_configs), ...);
+  capture.write(options.next_filename());
+  ++options.num_captures_;
+}
+
+/// Runs the given process (or ProcessScheduler) on the given columns in a
+/// single kernel launch, as the multi-column compute_tendencies of
+/// ProcessScheduler does, after capturing the inputs of the columns selected
+/// by the given options if they are enabled. The configurations of the
+/// process (or of each scheduled process) are given last, to be captured along
+/// with the inputs.
+template <typename Process, typename... ProcessConfigs>
+void compute_tendencies(const CaptureOptions &capture, const Process &process,
+                        const AeroConfig &config, const int ncol, const Real t,
+                        const Real dt,
+                        const DeviceType::view_1d<haero::Atmosphere> &atm,
+                        const DeviceType::view_1d<haero::Surface> &sfc,
+                        const DeviceType::view_1d<Prognostics> &progs,
+                        const DeviceType::view_1d<Diagnostics> &diags,
+                        const DeviceType::view_1d<Tendencies> &tends,
+                        const ProcessConfigs &...process_configs) {
+  if (capture.enabled())
+    capture_columns(capture, config, t, dt, atm, sfc, progs, diags,
+                    process_configs...);
+  Kokkos::parallel_for(
+      "mam4::io::compute_tendencies",
+      haero::ThreadTeamPolicy(ncol, Kokkos::AUTO),
+      KOKKOS_LAMBDA(const ThreadTeam &team) {
+        const int icol = team.league_rank();
+        process.compute_tendencies(team, t, dt, atm(icol), sfc(icol),
+                                   progs(icol), diags(icol), tends(icol));
+      });
+}
+
+} // namespace mam4::io
+
+#endif
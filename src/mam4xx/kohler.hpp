@@ -6,7 +6,7 @@
 #ifndef MAM4XX_KOHLER_HPP
 #define MAM4XX_KOHLER_HPP
 
-#include <mam4xx/mam4.hpp>
+#include <mam4xx/aero_config.hpp>
 
 #include <haero/constants.hpp>
 #include <haero/floating_point.hpp>
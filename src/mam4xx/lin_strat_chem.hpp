@@ -24,7 +24,7 @@ namespace mam4 {
 namespace lin_strat_chem {
 
 constexpr Real radians_to_degrees = 180. / haero::Constants::pi;
-// number of vertical levels
+// default number of vertical levels
 constexpr int pver = mam4::nlev;
 
 KOKKOS_INLINE_FUNCTION
@@ -283,6 +283,8 @@ void lin_strat_sfcsink(const Real delta_t, const ColumnView &pdel, // in
   const Real efactor =
       (one - haero::exp(-delta_t / o3_tau)); // !compute time scale factor
   Real do3mass_icol = 0;
+  // number of levels in the column
+  const int pver = pdel.extent_int(0);
   for (int kk = pver - 1; kk > pver - o3_lbl - 1; --kk) {
     const Real mass = pdel(kk) * rgrav; //   air mass in kg/m2
 
@@ -11,9 +11,11 @@
 #include <haero/aero_process.hpp>
 #include <mam4xx/aero_config.hpp>
 #include <mam4xx/aero_model.hpp>
+#include <mam4xx/bcscavcoef_table.hpp>
 #include <mam4xx/aging.hpp>
 #include <mam4xx/calcsize.hpp>
 #include <mam4xx/coagulation.hpp>
+#include <mam4xx/column_storage.hpp>
 #include <mam4xx/convproc.hpp>
 #include <mam4xx/drydep.hpp>
 #include <mam4xx/gas_chem.hpp>
@@ -24,9 +26,11 @@
 #include <mam4xx/mam4_types.hpp>
 #include <mam4xx/mo_chm_diags.hpp>
 #include <mam4xx/mo_photo.hpp>
+#include <mam4xx/mode_size_state.hpp>
 #include <mam4xx/ndrop.hpp>
 #include <mam4xx/nucleate_ice.hpp>
 #include <mam4xx/nucleation.hpp>
+#include <mam4xx/process_scheduler.hpp>
 #include <mam4xx/rename.hpp>
 #include <mam4xx/water_uptake.hpp>
 #include <mam4xx/wet_dep.hpp>
@@ -45,6 +49,7 @@ using NucleateIceProcess = haero::AeroProcess<AeroConfig, NucleateIce>;
 using WetDepositionProcess = haero::AeroProcess<AeroConfig, WetDeposition>;
 using DryDepProcess = haero::AeroProcess<AeroConfig, DryDep>;
 using WaterUptakeProcess = haero::AeroProcess<AeroConfig, Water_Uptake>;
+using ModeSizeProcess = haero::AeroProcess<AeroConfig, ModeSize>;
 
 } // namespace mam4
 
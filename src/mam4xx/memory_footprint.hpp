@@ -0,0 +1,147 @@
+// mam4xx: Copyright (c) 2022,
+// Battelle Memorial Institute and
+// National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef MAM4XX_MEMORY_FOOTPRINT_HPP
+#define MAM4XX_MEMORY_FOOTPRINT_HPP
+
+#include <mam4xx/aero_config.hpp>
+#include <mam4xx/io.hpp>
+#include <mam4xx/utils.hpp>
+
+#include <haero/atmosphere.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace mam4 {
+
+/// Returns the number of bytes allocated for the views of the given
+/// atmospheric state.
+inline std::size_t memory_footprint(const haero::Atmosphere &atm) {
+  std::size_t bytes = 0;
+  io::for_each_field(atm, [&](const std::string &name, const auto &v) {
+    // the boundary layer height is a scalar, not an allocation
+    if (name != "planetary_boundary_layer_height")
+      bytes += utils::view_footprint(v);
+  });
+  return bytes;
+}
+
+/// Returns the number of bytes allocated for the views of the given
+/// prognostics (or tendencies).
+inline std::size_t memory_footprint(const Prognostics &progs) {
+  std::size_t bytes = 0;
+  io::for_each_field(progs, [&](const std::string &, const auto &v) {
+    bytes += utils::view_footprint(v);
+  });
+  return bytes;
+}
+
+/// Returns the number of bytes allocated for the views of the given
+/// diagnostics, including their work arrays. Only the fields in use are
+/// allocated (see mam4::create_diagnostics).
+inline std::size_t memory_footprint(const Diagnostics &diags) {
+  std::size_t bytes = 0;
+  for_each_diagnostic(diags.num_levels(),
+                      [&](const DiagnosticField &, const auto &get) {
+                        bytes += utils::view_footprint(get(diags));
+                      });
+  return bytes;
+}
+
+/// Returns the number of bytes of device memory held by the given process
+/// implementation (e.g. ConvProc or WetDeposition), as reported by its
+/// memory_footprint() method.
+template <typename Process>
+auto memory_footprint(const Process &process)
+    -> decltype(process.memory_footprint()) {
+  return process.memory_footprint();
+}
+
+/// Returns the total number of bytes held by the given objects (e.g. the
+/// prognostics of a set of columns).
+template <typename T>
+std::size_t memory_footprint(const std::vector<T> &objects) {
+  std::size_t bytes = 0;
+  for (const T &object : objects)
+    bytes += memory_footprint(object);
+  return bytes;
+}
+
+/// @class MemoryReport
+/// A MemoryReport collects the memory footprints of the processes and state
+/// containers of a rank under given names, and summarizes them, so memory can
+/// be budgeted per rank and the effect of layout changes can be seen.
+class MemoryReport {
+public:
+  /// Adds an entry with the given name and number of bytes.
+  void add_bytes(const std::string &name, const std::size_t bytes) {
+    entries_.push_back({name, bytes});
+  }
+
+  /// Adds an entry with the given name for the memory held by the given
+  /// object: a process implementation, a state container, or a std::vector
+  /// of either.
+  template <typename T> void add(const std::string &name, const T &object) {
+    add_bytes(name, memory_footprint(object));
+  }
+
+  /// Returns the number of entries
+  int num_entries() const { return static_cast<int>(entries_.size()); }
+
+  /// Returns the number of bytes of the entry with the given name (0 if there
+  /// is none)
+  std::size_t bytes(const std::string &name) const {
+    std::size_t sum = 0;
+    for (const Entry &entry : entries_)
+      if (entry.name == name)
+        sum += entry.bytes;
+    return sum;
+  }
+
+  /// Returns the total number of bytes of all entries
+  std::size_t total_bytes() const {
+    std::size_t sum = 0;
+    for (const Entry &entry : entries_)
+      sum += entry.bytes;
+    return sum;
+  }
+
+  /// Returns a table with the size of each entry in MiB and its share of the
+  /// total, followed by the total.
+  std::string str() const {
+    const Real mib = 1024.0 * 1024.0;
+    const std::size_t total = total_bytes();
+    std::size_t width = 5; // "total"
+    for (const Entry &entry : entries_)
+      width = std::max(width, entry.name.size());
+    std::ostringstream s;
+    s << std::fixed;
+    for (const Entry &entry : entries_) {
+      s << std::left << std::setw(width) << entry.name << std::right
+        << std::setprecision(3) << std::setw(12) << entry.bytes / mib
+        << " MiB" << std::setprecision(1) << std::setw(7)
+        << ((total > 0) ? 100.0 * entry.bytes / total : 0.0) << " %\n";
+    }
+    s << std::left << std::setw(width) << "total" << std::right
+      << std::setprecision(3) << std::setw(12) << total / mib << " MiB\n";
+    return s.str();
+  }
+
+private:
+  struct Entry {
+    std::string name;
+    std::size_t bytes;
+  };
+  std::vector<Entry> entries_;
+};
+
+} // namespace mam4
+
+#endif
@@ -148,6 +148,25 @@ Real log_nucleation_rate(Real temp, Real rel_hum, Real c_h2so4, Real xi_nh3) {
          1.9828365865570703e-7 * cube(temp) * cube(log(xi)) * log(rel_hum);
 }
 
+/// Computes the "onset temperature" [K] (eq 10) given the natural logarithms
+/// of the H2SO4 number concentration and the NH3 molar mixing ratio. This form
+/// is useful to callers that have already computed these logarithms.
+/// @param [in] rel_hum The relative humidity [-]
+/// @param [in] log_c_h2so4 The log of the number concentration of H2SO4 gas
+///                         [log(cm-3)]
+/// @param [in] log_xi_nh3 The log of the molar mixing ratio of NH3 [log(ppt)]
+KOKKOS_INLINE_FUNCTION
+Real onset_temperature_from_logs(Real rel_hum, Real log_c_h2so4,
+                                 Real log_xi_nh3) {
+  return 143.6002929064716 + 1.0178856665693992 * rel_hum +
+         10.196398812974294 * log_c_h2so4 -
+         0.1849879416839113 * square(log_c_h2so4) -
+         17.161783213150173 * log_xi_nh3 +
+         109.92469248546053 * log_xi_nh3 / log_c_h2so4 +
+         0.7734119613144357 * log_c_h2so4 * log_xi_nh3 -
+         0.15576469879527022 * square(log_xi_nh3);
+}
+
 /// Computes the "onset temperature" [K] (eq 10) above which Merikanto's
 /// parameterization for the nucleation rate (eq 8) cannot be used (in which
 /// case the authors suggest setting the nucleation rate to zero).
@@ -156,13 +175,7 @@ Real log_nucleation_rate(Real temp, Real rel_hum, Real c_h2so4, Real xi_nh3) {
 /// @param [in] xi_nh3 The molar mixing ratio of NH3 [ppt]
 KOKKOS_INLINE_FUNCTION
 Real onset_temperature(Real rel_hum, Real c_h2so4, Real xi_nh3) {
-  return 143.6002929064716 + 1.0178856665693992 * rel_hum +
-         10.196398812974294 * log(c_h2so4) -
-         0.1849879416839113 * square(log(c_h2so4)) -
-         17.161783213150173 * log(xi_nh3) +
-         109.92469248546053 * log(xi_nh3) / log(c_h2so4) +
-         0.7734119613144357 * log(c_h2so4) * log(xi_nh3) -
-         0.15576469879527022 * square(log(xi_nh3));
+  return onset_temperature_from_logs(rel_hum, log(c_h2so4), log(xi_nh3));
 }
 
 /// Computes the radius of a critical cluster [nm] as parameterized in Merikanto
@@ -27,7 +27,7 @@ constexpr Real avogadro = haero::Constants::avogadro;
 constexpr const int gas_pcnst = gas_chemistry::gas_pcnst;
 constexpr const int pcnst = 80; // FIXME, 80 is the only value I found for this
                                 // in the fortran, but using 41 in the test
-// number of vertical levels
+// default number of vertical levels
 constexpr const int pver = mam4::nlev;
 
 KOKKOS_INLINE_FUNCTION
@@ -48,6 +48,8 @@ void het_diags(
   // output integrated wet deposition field
   //===========
 
+  // number of levels in the column
+  const int pver = pdel.extent_int(0);
   sox_wk[0] = 0;
   Kokkos::parallel_for(
       Kokkos::TeamThreadRange(team, gas_pcnst), KOKKOS_LAMBDA(int mm) {
@@ -153,6 +155,8 @@ void chm_diags(
   //--------------------------------------------------------------------
 
   Real wgt;
+  // number of levels in the column
+  const int pver = pdel.extent_int(0);
   // Real pointer :: fldcw(:,:)  //working pointer to extract data from pbuf for
   // sum of mass for aerosol classes
 
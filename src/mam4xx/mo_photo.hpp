@@ -1,6 +1,7 @@
 #ifndef MAM4XX_MO_PHOTO_HPP
 #define MAM4XX_MO_PHOTO_HPP
 
+#include <ekat/ekat_assert.hpp>
 #include <haero/math.hpp>
 #include <mam4xx/aero_config.hpp>
 #include <mam4xx/mam4_types.hpp>
@@ -10,21 +11,39 @@ namespace mam4 {
 
 namespace mo_photo {
 
-// number of vertical levels
+// default number of vertical levels
 constexpr int pver = mam4::nlev;
 constexpr int pverm = pver - 1;
 
+// Levels<NLEV> gives the number of levels, and the size of the per-level stack
+// buffers, of the kernels (cloud_mod, table_photo) specialized for columns of
+// NLEV levels. The level counts of our common configurations (72 and 128) get
+// buffers and loops of fixed size; NLEV = 0 handles any number of levels up
+// to mam4::max_nlev.
+template <int NLEV> struct Levels {
+  static constexpr int capacity = NLEV;
+  KOKKOS_INLINE_FUNCTION
+  static constexpr int count(const int) { return NLEV; }
+};
+
+template <> struct Levels<0> {
+  static constexpr int capacity = mam4::max_nlev;
+  KOKKOS_INLINE_FUNCTION
+  static constexpr int count(const int nlev) { return nlev; }
+};
+
 using View5D = Kokkos::View<Real *****>;
 using View4D = Kokkos::View<Real ****>;
 using View2D = DeviceType::view_2d<Real>;
 using View1D = DeviceType::view_1d<Real>;
 using ViewInt1D = DeviceType::view_1d<int>;
 
-KOKKOS_INLINE_FUNCTION
-void cloud_mod(const Real zen_angle, const Real *clouds, const Real *lwc,
-               const Real *delp,
-               const Real srf_alb, //  in
-               Real *eff_alb, Real *cld_mult) {
+template <int NLEV>
+KOKKOS_INLINE_FUNCTION void
+cloud_mod(const Real zen_angle, const Real *clouds, const Real *lwc,
+          const Real *delp,
+          const Real srf_alb, //  in
+          Real *eff_alb, Real *cld_mult, const int nlev) {
   /*-----------------------------------------------------------------------
         ... cloud alteration factors for photorates and albedo
   -----------------------------------------------------------------------*/
@@ -46,12 +65,17 @@ void cloud_mod(const Real zen_angle, const Real *clouds, const Real *lwc,
   const Real one = 1;
   const Real half = 0.5;
 
+  // number of levels in the column
+  const int pver = Levels<NLEV>::count(nlev);
+  const int pverm = pver - 1;
+  EKAT_KERNEL_ASSERT(pver <= Levels<NLEV>::capacity);
+
   // cloud optical depth in each layer
-  Real del_tau[pver] = {};
+  Real del_tau[Levels<NLEV>::capacity] = {};
   // cloud optical depth below this layer
-  Real below_tau[pver] = {};
+  Real below_tau[Levels<NLEV>::capacity] = {};
   // cloud cover below this layer
-  Real below_cld[pver] = {};
+  Real below_cld[Levels<NLEV>::capacity] = {};
 
   // BAD CONSTANT
   const Real rgrav = one / 9.80616; //  1/g [s^2/m]
@@ -73,9 +97,9 @@ void cloud_mod(const Real zen_angle, const Real *clouds, const Real *lwc,
               ... form integrated tau and cloud cover from top down
   --------------------------------------------------------- */
   // cloud optical depth above this layer
-  Real above_tau[pver] = {zero};
+  Real above_tau[Levels<NLEV>::capacity] = {zero};
   // cloud cover above this layer
-  Real above_cld[pver] = {zero};
+  Real above_cld[Levels<NLEV>::capacity] = {zero};
 
   for (int kk = 0; kk < pverm; kk++) {
     above_tau[kk + 1] = del_tau[kk] + above_tau[kk];
@@ -180,6 +204,23 @@ void cloud_mod(const Real zen_angle, const Real *clouds, const Real *lwc,
 
 } // end cloud_mod
 
+// computes the cloud alteration factors above for a column of nlev levels
+KOKKOS_INLINE_FUNCTION
+void cloud_mod(const Real zen_angle, const Real *clouds, const Real *lwc,
+               const Real *delp,
+               const Real srf_alb, //  in
+               Real *eff_alb, Real *cld_mult, const int nlev = pver) {
+  if (nlev == 72)
+    cloud_mod<72>(zen_angle, clouds, lwc, delp, srf_alb, eff_alb, cld_mult,
+                  nlev);
+  else if (nlev == 128)
+    cloud_mod<128>(zen_angle, clouds, lwc, delp, srf_alb, eff_alb, cld_mult,
+                   nlev);
+  else
+    cloud_mod<0>(zen_angle, clouds, lwc, delp, srf_alb, eff_alb, cld_mult,
+                 nlev);
+}
+
 KOKKOS_INLINE_FUNCTION
 void find_index(const Real *var_in, const int var_len,
                 const Real var_min, //  in
@@ -417,8 +458,8 @@ void jlong(const Real sza_in, const Real *alb_in, const Real *p_in,
            const View2D &j_long, // output
            // work arrays
            const View2D &rsf, const View2D &xswk, Real *psum_l,
-           Real *psum_u) // out
-{
+           Real *psum_u, // out
+           const int nlev = pver) {
   /*==============================================================================
      Purpose:
        To calculate the total J for selective species longward of 200nm.
@@ -464,11 +505,13 @@ void jlong(const Real sza_in, const Real *alb_in, const Real *p_in,
   // @param[in]  np_xs          number of pressure levels in xsection table
   // @param[in]  numj           number of photorates in xsqy, rsf
   // @param[out]  j_long(:,:)   photo rates [1/s]
+  // @param[in]  nlev           number of levels in the column
 
   /*----------------------------------------------------------------------
     ... interpolate table rsf to model variables
 ----------------------------------------------------------------------*/
   const Real zero = 0;
+  const int pver = nlev;
   interpolate_rsf(alb_in, sza_in, p_in, colo3_in, pver, sza, del_sza, alb,
                   press, del_p, colo3, o3rat, del_alb, del_o3rat, etfphot,
                   rsf_tab, //  in
@@ -551,26 +594,27 @@ void jlong(const Real sza_in, const Real *alb_in, const Real *p_in,
 
 } // jlong
 const Real phtcnt = 1; // number of photolysis reactions
-KOKKOS_INLINE_FUNCTION
-void table_photo(const View2D &photo, // out
-                 const ColumnView &pmid, const ColumnView &pdel,
-                 const ColumnView &temper, // in
-                 const ColumnView &colo3_in, const Real zen_angle,
-                 const Real srf_alb, const ColumnView &lwc,
-                 const ColumnView &clouds, // in
-                 const Real esfact, const View4D &xsqy, const View1D &sza,
-                 const View1D &del_sza, const View1D &alb, const View1D &press,
-                 const View1D &del_p, const View1D &colo3, const View1D &o3rat,
-                 const View1D &del_alb, const View1D &del_o3rat,
-                 const View1D &etfphot, const View5D &rsf_tab,
-                 const View1D &prs, const View1D &dprs, const int nw,
-                 const int nump, const int numsza, const int numcolo3,
-                 const int numalb, const int np_xs, const int numj,
-                 const View1D &pht_alias_mult_1, const ViewInt1D &lng_indexer,
-                 // work arrays
-                 const View2D &lng_prates, const View2D &rsf,
-                 const View2D &xswk, const View1D &psum_l,
-                 const View1D &psum_u) {
+template <int NLEV>
+KOKKOS_INLINE_FUNCTION void
+table_photo(const View2D &photo, // out
+            const ColumnView &pmid, const ColumnView &pdel,
+            const ColumnView &temper, // in
+            const ColumnView &colo3_in, const Real zen_angle,
+            const Real srf_alb, const ColumnView &lwc,
+            const ColumnView &clouds, // in
+            const Real esfact, const View4D &xsqy, const View1D &sza,
+            const View1D &del_sza, const View1D &alb, const View1D &press,
+            const View1D &del_p, const View1D &colo3, const View1D &o3rat,
+            const View1D &del_alb, const View1D &del_o3rat,
+            const View1D &etfphot, const View5D &rsf_tab,
+            const View1D &prs, const View1D &dprs, const int nw,
+            const int nump, const int numsza, const int numcolo3,
+            const int numalb, const int np_xs, const int numj,
+            const View1D &pht_alias_mult_1, const ViewInt1D &lng_indexer,
+            // work arrays
+            const View2D &lng_prates, const View2D &rsf,
+            const View2D &xswk, const View1D &psum_l,
+            const View1D &psum_u) {
   /*-----------------------------------------------------------------
       ... table photorates for wavelengths > 200nm
  -----------------------------------------------------------------*/
@@ -621,10 +665,14 @@ void table_photo(const View2D &photo, // out
   // BAD CONSTANT
   constexpr Real max_zen_angle = 88.85; //  degrees
 
+  // number of levels in the column
+  const int pver = Levels<NLEV>::count(pmid.extent_int(0));
+  EKAT_KERNEL_ASSERT(pver <= Levels<NLEV>::capacity);
+
   // vertical pressure array [hPa]
-  Real parg[pver] = {};
-  Real eff_alb[pver] = {};
-  Real cld_mult[pver] = {};
+  Real parg[Levels<NLEV>::capacity] = {};
+  Real eff_alb[Levels<NLEV>::capacity] = {};
+  Real cld_mult[Levels<NLEV>::capacity] = {};
 
   /*-----------------------------------------------------------------
     ... zero all photorates
@@ -635,9 +683,9 @@ void table_photo(const View2D &photo, // out
     /*-----------------------------------------------------------------
          ... compute eff_alb and cld_mult -- needs to be before jlong
     -----------------------------------------------------------------*/
-    cloud_mod(zen_angle, clouds.data(), lwc.data(), pdel.data(),
-              srf_alb, //  in
-              eff_alb, cld_mult);
+    cloud_mod<NLEV>(zen_angle, clouds.data(), lwc.data(), pdel.data(),
+                    srf_alb, //  in
+                    eff_alb, cld_mult, pver);
 
     for (int kk = 0; kk < pver; ++kk) {
       parg[kk] = pmid(kk) * Pa2mb;
@@ -656,7 +704,7 @@ void table_photo(const View2D &photo, // out
           numj,
           lng_prates, // output
           // work arrays
-          rsf, xswk, psum_l.data(), psum_u.data());
+          rsf, xswk, psum_l.data(), psum_u.data(), pver);
 
     for (int mm = 0; mm < phtcnt; ++mm) {
       if (lng_indexer(mm) > -1) {
@@ -671,6 +719,52 @@ void table_photo(const View2D &photo, // out
   // } // end col_loop
 }
 
+// computes the photolysis rates above for a column with the number of levels
+// of pmid
+KOKKOS_INLINE_FUNCTION
+void table_photo(const View2D &photo, // out
+                 const ColumnView &pmid, const ColumnView &pdel,
+                 const ColumnView &temper, // in
+                 const ColumnView &colo3_in, const Real zen_angle,
+                 const Real srf_alb, const ColumnView &lwc,
+                 const ColumnView &clouds, // in
+                 const Real esfact, const View4D &xsqy, const View1D &sza,
+                 const View1D &del_sza, const View1D &alb, const View1D &press,
+                 const View1D &del_p, const View1D &colo3, const View1D &o3rat,
+                 const View1D &del_alb, const View1D &del_o3rat,
+                 const View1D &etfphot, const View5D &rsf_tab,
+                 const View1D &prs, const View1D &dprs, const int nw,
+                 const int nump, const int numsza, const int numcolo3,
+                 const int numalb, const int np_xs, const int numj,
+                 const View1D &pht_alias_mult_1, const ViewInt1D &lng_indexer,
+                 // work arrays
+                 const View2D &lng_prates, const View2D &rsf,
+                 const View2D &xswk, const View1D &psum_l,
+                 const View1D &psum_u) {
+  const int nlev = pmid.extent_int(0);
+  if (nlev == 72)
+    table_photo<72>(photo, pmid, pdel, temper, colo3_in, zen_angle, srf_alb,
+                    lwc, clouds, esfact, xsqy, sza, del_sza, alb, press, del_p,
+                    colo3, o3rat, del_alb, del_o3rat, etfphot, rsf_tab, prs,
+                    dprs, nw, nump, numsza, numcolo3, numalb, np_xs, numj,
+                    pht_alias_mult_1, lng_indexer, lng_prates, rsf, xswk,
+                    psum_l, psum_u);
+  else if (nlev == 128)
+    table_photo<128>(photo, pmid, pdel, temper, colo3_in, zen_angle, srf_alb,
+                     lwc, clouds, esfact, xsqy, sza, del_sza, alb, press,
+                     del_p, colo3, o3rat, del_alb, del_o3rat, etfphot, rsf_tab,
+                     prs, dprs, nw, nump, numsza, numcolo3, numalb, np_xs,
+                     numj, pht_alias_mult_1, lng_indexer, lng_prates, rsf,
+                     xswk, psum_l, psum_u);
+  else
+    table_photo<0>(photo, pmid, pdel, temper, colo3_in, zen_angle, srf_alb,
+                   lwc, clouds, esfact, xsqy, sza, del_sza, alb, press, del_p,
+                   colo3, o3rat, del_alb, del_o3rat, etfphot, rsf_tab, prs,
+                   dprs, nw, nump, numsza, numcolo3, numalb, np_xs, numj,
+                   pht_alias_mult_1, lng_indexer, lng_prates, rsf, xswk,
+                   psum_l, psum_u);
+}
+
 } // namespace mo_photo
 } // end namespace mam4
 
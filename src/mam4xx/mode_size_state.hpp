@@ -0,0 +1,258 @@
+// mam4xx: Copyright (c) 2022,
+// Battelle Memorial Institute and
+// National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef MAM4XX_MODE_SIZE_STATE_HPP
+#define MAM4XX_MODE_SIZE_STATE_HPP
+
+#include <mam4xx/aero_config.hpp>
+#include <mam4xx/aero_modes.hpp>
+#include <mam4xx/calcsize.hpp>
+#include <mam4xx/mam4_types.hpp>
+#include <mam4xx/mode_wet_particle_size.hpp>
+
+#include <haero/atmosphere.hpp>
+#include <haero/constants.hpp>
+#include <haero/haero.hpp>
+#include <haero/math.hpp>
+#include <haero/surface.hpp>
+
+namespace mam4 {
+
+/// The size distribution of the modes at one level: the dry volume and mass,
+/// dry geometric mean diameters and hygroscopicity of each mode, computed from
+/// the prognostics in one pass over the species of each mode, and the wet
+/// diameter and density of the interstitial particles. Species properties are
+/// looked up by AeroId.
+///
+/// Modes without particles (or without mass) get their nominal diameter and
+/// the hygroscopicity and density of their first species, so the state is
+/// always usable by water uptake. Like CalcSize, the dry diameters are kept
+/// within the bounds of each mode (see calcsize::update_diameter_and_vol2num).
+struct ModeSizeState {
+  static constexpr int num_modes = AeroConfig::num_modes();
+  Real dry_vol_i[num_modes];      // interstitial dry volume [m3/kg air]
+  Real dry_vol_c[num_modes];      // cloud-borne dry volume [m3/kg air]
+  Real dry_mass_i[num_modes];     // interstitial dry mass [kg/kg air]
+  Real dgn_i[num_modes];          // interstitial dry diameter [m]
+  Real dgn_c[num_modes];          // cloud-borne dry diameter [m]
+  Real dgn_total[num_modes];      // total (interstitial + cloud-borne) [m]
+  Real hygroscopicity[num_modes]; // volume-mean (interstitial) [-]
+  Real dgn_wet[num_modes];        // interstitial wet diameter [m]
+  Real wet_density[num_modes];    // interstitial wet density [kg/m3]
+
+  /// Computes the dry state of the modes at level k. The wet diameters are set
+  /// to the dry ones, and the wet densities to the dry ones.
+  KOKKOS_INLINE_FUNCTION
+  void compute_dry(const ModeLognormalFactors &factors,
+                   const Prognostics &progs, const int k) {
+    static constexpr Real small_vol = 1.0e-30; // (BAD CONSTANT)
+    for (int m = 0; m < num_modes; ++m) {
+      Real vol_i = 0, vol_c = 0, mass_i = 0, hyg = 0;
+      for (int s = 0; s < num_species_mode(m); ++s) {
+        const int aid = static_cast<int>(mode_aero_species(m, s));
+        const Real inv_density = mode_species_inv_density(m, s);
+        const Real q_i = progs.q_aero_i[m][s](k);
+        vol_i += q_i * inv_density;
+        vol_c += progs.q_aero_c[m][s](k) * inv_density;
+        mass_i += q_i;
+        hyg += q_i * inv_density * aero_species(aid).hygroscopicity;
+      }
+      dry_vol_i[m] = vol_i;
+      dry_vol_c[m] = vol_c;
+      dry_mass_i[m] = mass_i;
+
+      const int aid_1 = static_cast<int>(mode_aero_species(m, 0));
+      hygroscopicity[m] = (vol_i > small_vol)
+                              ? hyg / vol_i
+                              : aero_species(aid_1).hygroscopicity;
+
+      const Real n_i = haero::max(progs.n_mode_i[m](k), 0.0);
+      const Real n_c = haero::max(progs.n_mode_c[m](k), 0.0);
+      dgn_i[m] = bounded_diameter(factors, m, vol_i, n_i);
+      dgn_c[m] = bounded_diameter(factors, m, vol_c, n_c);
+      const Real mean_vol = ((n_i > 0) ? vol_i / n_i : 0) +
+                            ((n_c > 0) ? vol_c / n_c : 0);
+      dgn_total[m] = bounded_diameter(factors, m, mean_vol, 1);
+
+      dgn_wet[m] = dgn_i[m];
+      wet_density[m] =
+          (vol_i > small_vol) ? mass_i / vol_i : aero_species(aid_1).density;
+    }
+  }
+
+  /// Replaces the interstitial and cloud-borne dry diameters with those at
+  /// level k of the given diagnostics (e.g. as adjusted by CalcSize). The wet
+  /// diameters are reset to the dry ones.
+  KOKKOS_INLINE_FUNCTION
+  void load_dry_diameters(const Diagnostics &diags, const int k) {
+    for (int m = 0; m < num_modes; ++m) {
+      dgn_i[m] = diags.dry_geometric_mean_diameter_i[m](k);
+      dgn_c[m] = diags.dry_geometric_mean_diameter_c[m](k);
+      dgn_wet[m] = dgn_i[m];
+    }
+  }
+
+  /// Computes the wet diameters and densities of the modes at level k from
+  /// their dry state by water uptake (see mode_avg_wet_particle_diam).
+  KOKKOS_INLINE_FUNCTION
+  void compute_wet(const ModeLognormalFactors &factors, const Atmosphere &atm,
+                   const int k) {
+    const Real rel_humidity =
+        conversions::relative_humidity_from_vapor_mixing_ratio(
+            atm.vapor_mixing_ratio(k), atm.temperature(k), atm.pressure(k));
+    for (int m = 0; m < num_modes; ++m)
+      set_wet_diameter(m, mode_avg_wet_particle_diam(factors, m, dgn_i[m],
+                                                     hygroscopicity[m],
+                                                     rel_humidity));
+  }
+
+  /// Sets the wet diameter of mode m to the given one and updates its wet
+  /// density with the water taken up. The particles keep the geometric
+  /// standard deviation of the mode, so the wet to dry volume ratio is the
+  /// cube of the diameter ratio.
+  KOKKOS_INLINE_FUNCTION
+  void set_wet_diameter(const int m, const Real wet_diameter) {
+    const Real rho_h2o = haero::Constants::density_h2o;
+    if (wet_diameter > dgn_i[m]) {
+      const Real dry_density = wet_density[m];
+      wet_density[m] =
+          rho_h2o +
+          (dry_density - rho_h2o) * haero::cube(dgn_i[m] / wet_diameter);
+    }
+    dgn_wet[m] = wet_diameter;
+  }
+
+  /// Returns the geometric mean diameter of mode m for the given dry volume
+  /// and number, within the bounds CalcSize applies: the nominal diameter if
+  /// there is no volume, and the minimum (maximum) diameter of the mode if
+  /// the mean particle volume is below (above) its range.
+  KOKKOS_INLINE_FUNCTION
+  static Real bounded_diameter(const ModeLognormalFactors &factors,
+                               const int m, const Real vol, const Real num) {
+    const Real num2vol_ratio_min =
+        1.0 / factors.volume_from_diameter(m, modes(m).max_diameter);
+    const Real num2vol_ratio_max =
+        1.0 / factors.volume_from_diameter(m, modes(m).min_diameter);
+    Real dgn = modes(m).nom_diameter, num2vol_ratio;
+    calcsize::update_diameter_and_vol2num(
+        vol, num, num2vol_ratio_min, num2vol_ratio_max, modes(m).min_diameter,
+        modes(m).max_diameter, modes(m).mean_std_dev, dgn, num2vol_ratio);
+    return dgn;
+  }
+
+  /// Stores the dry diameters and hygroscopicities at level k of the given
+  /// diagnostics.
+  KOKKOS_INLINE_FUNCTION
+  void store_dry(const Diagnostics &diags, const int k) const {
+    for (int m = 0; m < num_modes; ++m) {
+      diags.dry_geometric_mean_diameter_i[m](k) = dgn_i[m];
+      diags.dry_geometric_mean_diameter_c[m](k) = dgn_c[m];
+      diags.dry_geometric_mean_diameter_total[m](k) = dgn_total[m];
+      diags.hygroscopicity[m](k) = hygroscopicity[m];
+    }
+  }
+
+  /// Stores the wet diameters and densities at level k of the given
+  /// diagnostics.
+  KOKKOS_INLINE_FUNCTION
+  void store_wet(const Diagnostics &diags, const int k) const {
+    for (int m = 0; m < num_modes; ++m) {
+      diags.wet_geometric_mean_diameter_i[m](k) = dgn_wet[m];
+      diags.wet_density[m](k) = wet_density[m];
+    }
+  }
+};
+
+/// @class ModeSize
+/// This process computes the size distribution state of the modes (see
+/// ModeSizeState) once per level and stores it in the particle size
+/// diagnostics, which later processes (e.g. DryDep and WetDeposition) read
+/// instead of recomputing diameters, hygroscopicities and densities from the
+/// prognostics. Run with a ProcessScheduler, it is scheduled ahead of the
+/// processes that read particle sizes. It writes the same dry diameters as
+/// CalcSize (both declare field::particle_size), so the two never share a
+/// stage and run in the given order. Its structure is defined by the usage
+/// of the impl_ member in the AeroProcess class in ../aero_process.hpp.
+class ModeSize {
+public:
+  struct Config {
+
+    Config(){};
+
+    Config(const Config &) = default;
+    ~Config() = default;
+    Config &operator=(const Config &) = default;
+
+    // compute the wet diameters and densities from water uptake (otherwise
+    // they are set to the dry values)
+    bool water_uptake = true;
+  };
+
+private:
+  Config config_;
+  ModeLognormalFactors factors_;
+
+public:
+  // name -- unique name of the process implemented by this class
+  const char *name() const { return "MAM4 mode size state"; }
+
+  // memory_footprint -- bytes of device memory held by this process
+  std::size_t memory_footprint() const { return 0; }
+
+  // field_access -- groups of fields read and written by compute_tendencies
+  KOKKOS_INLINE_FUNCTION
+  static constexpr FieldAccess field_access() {
+    return {field::interstitial_aerosols | field::cloudborne_aerosols,
+            field::particle_size};
+  }
+
+  // prognostic_update -- compute_tendencies only sets tendencies
+  KOKKOS_INLINE_FUNCTION
+  static constexpr PrognosticUpdate prognostic_update() {
+    return PrognosticUpdate::tendencies_only;
+  }
+
+  // init -- initializes the implementation with MAM4's configuration
+  void init(const AeroConfig &aero_config,
+            const Config &process_config = Config()) {
+    config_ = process_config;
+    factors_ = ModeLognormalFactors();
+  }
+
+  // validate -- validates the given atmospheric state and prognostics against
+  // assumptions made by this implementation, returning true if the states are
+  // valid, false if not
+  KOKKOS_INLINE_FUNCTION
+  bool validate(const AeroConfig &config, const ThreadTeam &team,
+                const Atmosphere &atm, const Surface &sfc,
+                const Prognostics &progs) const {
+    return progs.quantities_nonnegative(team);
+  }
+
+  // compute_tendencies -- computes tendencies and updates diagnostics
+  // NOTE: that both diags and tends are const below--this means their views
+  // NOTE: are fixed, but the data in those views is allowed to vary.
+  KOKKOS_INLINE_FUNCTION
+  void compute_tendencies(const AeroConfig &config, const ThreadTeam &team,
+                          Real t, Real dt, const Atmosphere &atm,
+                          const Surface &sfc, const Prognostics &progs,
+                          const Diagnostics &diags,
+                          const Tendencies &tends) const {
+    const int nk = atm.num_levels();
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team, nk), KOKKOS_CLASS_LAMBDA(int k) {
+          ModeSizeState state;
+          state.compute_dry(factors_, progs, k);
+          state.store_dry(diags, k);
+          if (config_.water_uptake)
+            state.compute_wet(factors_, atm, k);
+          state.store_wet(diags, k);
+        });
+  }
+};
+
+} // namespace mam4
+
+#endif
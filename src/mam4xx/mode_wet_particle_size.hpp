@@ -26,32 +26,27 @@ static constexpr Real dry_radius_max_microns =
 static constexpr Real wet_radius_max_microns = 30.0;
 static constexpr Real solver_convergence_tol = 1e-10;
 
-///  Compute aerosol particle wet diameter for interstitial aerosols
-///  in a single mode.
-///
-///  This version can be called in parallel over both modes and vertical levels.
+///  Compute the wet geometric mean diameter of the interstitial aerosols of a
+///  single mode from their dry geometric mean diameter and hygroscopicity.
 ///
 ///  This function replaces subroutine modal_aero_wateruptake_dr from
 ///  file modal_aero_wateruptake.F90.
 ///
-///  Inputs are the mode averages contained in @ref Diagnostics (dry particle
-///  size, hygroscopicity) and @ref Atmosphere (vapor mass mixing ratio). Diags
-///  are marked 'const' because they need to be able to be captured by value by
-///  a lambda.  The Views inside the Diags struct are const, but the data
-///  contained by the Views can change.
-///
-///  @param [in/out] diags dry/wet particle geometric mean diameter
-///  @param [in] atm Atmosphere contains (T, P, w) data
+///  @param [in] factors log-normal factors of the modes
 ///  @param [in] mode_idx mode that needs wet particle size data
-///  @param [in] k column vertical level index
+///  @param [in] dry_diam dry geometric mean diameter [m]
+///  @param [in] hygroscopicity volume-mean hygroscopicity [-]
+///  @param [in] rel_humidity relative humidity [-]
+///  @return wet geometric mean diameter [m]
 KOKKOS_INLINE_FUNCTION
-void mode_avg_wet_particle_diam_water_uptake(const Diagnostics &diags,
-                                             const Atmosphere &atm,
-                                             int mode_idx, int k) {
+Real mode_avg_wet_particle_diam(const ModeLognormalFactors &factors,
+                                const int mode_idx, const Real dry_diam,
+                                const Real hygroscopicity,
+                                const Real rel_humidity) {
 
   // check hygroscopicity is in bounds for water uptake
   EKAT_KERNEL_ASSERT(FloatingPoint<Real>::in_bounds(
-      diags.hygroscopicity[mode_idx](k), KohlerPolynomial::hygro_min,
+      hygroscopicity, KohlerPolynomial::hygro_min,
       KohlerPolynomial::hygro_max));
 
   // unit conversion multipliers
@@ -63,9 +58,6 @@ void mode_avg_wet_particle_diam_water_uptake(const Diagnostics &diags,
   // initialize result (default initializer is quiet nan)
   Real wet_diam = 0;
 
-  // compute relative humidity
-  Real rel_humidity = conversions::relative_humidity_from_vapor_mixing_ratio(
-      atm.vapor_mixing_ratio(k), atm.temperature(k), atm.pressure(k));
   // check that relative humidity is in bounds for interstitial water uptake
   // and Kohler theory
   EKAT_KERNEL_ASSERT(FloatingPoint<Real>::in_bounds(
@@ -81,19 +73,16 @@ void mode_avg_wet_particle_diam_water_uptake(const Diagnostics &diags,
   //  case 3: nearly saturated air
   const auto rh_high = (rel_humidity > modes(mode_idx).deliquescence_pt);
   //  case 4: particles too small
-  const auto too_small =
-      (0.5 * to_microns * diags.dry_geometric_mean_diameter_i[mode_idx](k) <
-       rdry_min);
+  const auto too_small = (0.5 * to_microns * dry_diam < rdry_min);
 
   // no water uptake occurs if particles are too small or if air is too dry
   if (rh_low || too_small) {
-    wet_diam = diags.dry_geometric_mean_diameter_i[mode_idx](k);
+    wet_diam = dry_diam;
   } else {
     // for all other cases, we need a Kohler polynomial solve
 
     // convert from diameter in meters to radius in microns
-    const Real dry_radius_microns =
-        0.5 * to_microns * diags.dry_geometric_mean_diameter_i[mode_idx](k);
+    const Real dry_radius_microns = 0.5 * to_microns * dry_diam;
 
     // check dry particle size is in bounds
     EKAT_KERNEL_ASSERT((dry_radius_microns <= rdry_max));
@@ -109,8 +98,7 @@ void mode_avg_wet_particle_diam_water_uptake(const Diagnostics &diags,
     //  a new solver that is better conditioned and stable for
     //  finite precision computations.
     SolverType kohler_solver =
-        SolverType(rel_humidity, diags.hygroscopicity[mode_idx](k),
-                   dry_radius_microns, tol);
+        SolverType(rel_humidity, hygroscopicity, dry_radius_microns, tol);
     auto rwet_microns = kohler_solver.solve();
 
     // set maximum wet radius of 30 microns
@@ -133,13 +121,12 @@ void mode_avg_wet_particle_diam_water_uptake(const Diagnostics &diags,
     //  dry_geometric_mean_diameter_i input accounts for the PDF while the same
     //  quantity for wet particles does not.
     //
-    //  Here, we use the PDF functions for both.
-    const Real dry_vol = conversions::mean_particle_volume_from_diameter(
-        diags.dry_geometric_mean_diameter_i[mode_idx](k),
-        modes(mode_idx).mean_std_dev);
+    //  Here, we use the PDF functions for both, with the factors of the
+    //  mode's log-normal distribution.
+    const Real dry_vol = factors.volume_from_diameter(mode_idx, dry_diam);
 
-    Real wet_vol = conversions::mean_particle_volume_from_diameter(
-        2 * to_meters * rwet_microns, modes(mode_idx).mean_std_dev);
+    Real wet_vol =
+        factors.volume_from_diameter(mode_idx, 2 * to_meters * rwet_microns);
 
     // check that wet particle volume >= dry particle volume
     EKAT_KERNEL_ASSERT(wet_vol >= dry_vol);
@@ -168,8 +155,7 @@ void mode_avg_wet_particle_diam_water_uptake(const Diagnostics &diags,
     wet_vol = dry_vol + water_vol;
 
     const Real rwet_hyst =
-        0.5 * conversions::mean_particle_diameter_from_volume(
-                  wet_vol, modes(mode_idx).mean_std_dev);
+        0.5 * factors.diameter_from_volume(mode_idx, wet_vol);
 
     if (rh_mid) {
       wet_diam = 2 * rwet_hyst;
@@ -178,7 +164,36 @@ void mode_avg_wet_particle_diam_water_uptake(const Diagnostics &diags,
     }
   }
 
-  diags.wet_geometric_mean_diameter_i[mode_idx](k) = wet_diam;
+  return wet_diam;
+}
+
+///  Compute aerosol particle wet diameter for interstitial aerosols
+///  in a single mode.
+///
+///  This version can be called in parallel over both modes and vertical levels.
+///
+///  Inputs are the mode averages contained in @ref Diagnostics (dry particle
+///  size, hygroscopicity) and @ref Atmosphere (vapor mass mixing ratio). Diags
+///  are marked 'const' because they need to be able to be captured by value by
+///  a lambda.  The Views inside the Diags struct are const, but the data
+///  contained by the Views can change.
+///
+///  @param [in/out] diags dry/wet particle geometric mean diameter
+///  @param [in] atm Atmosphere contains (T, P, w) data
+///  @param [in] mode_idx mode that needs wet particle size data
+///  @param [in] k column vertical level index
+KOKKOS_INLINE_FUNCTION
+void mode_avg_wet_particle_diam_water_uptake(const Diagnostics &diags,
+                                             const Atmosphere &atm,
+                                             int mode_idx, int k) {
+  // compute relative humidity
+  const Real rel_humidity =
+      conversions::relative_humidity_from_vapor_mixing_ratio(
+          atm.vapor_mixing_ratio(k), atm.temperature(k), atm.pressure(k));
+  diags.wet_geometric_mean_diameter_i[mode_idx](k) = mode_avg_wet_particle_diam(
+      ModeLognormalFactors(), mode_idx,
+      diags.dry_geometric_mean_diameter_i[mode_idx](k),
+      diags.hygroscopicity[mode_idx](k), rel_humidity);
 }
 
 ///  Compute aerosol particle wet diameter for interstitial aerosols
@@ -201,8 +216,14 @@ void mode_avg_wet_particle_diam_water_uptake(const Diagnostics &diags,
 KOKKOS_INLINE_FUNCTION
 void mode_avg_wet_particle_diam_water_uptake(const Diagnostics &diags,
                                              const Atmosphere &atm, int k) {
+  const ModeLognormalFactors factors;
+  const Real rel_humidity =
+      conversions::relative_humidity_from_vapor_mixing_ratio(
+          atm.vapor_mixing_ratio(k), atm.temperature(k), atm.pressure(k));
   for (int m = 0; m < AeroConfig::num_modes(); ++m) {
-    mode_avg_wet_particle_diam_water_uptake(diags, atm, m, k);
+    diags.wet_geometric_mean_diameter_i[m](k) = mode_avg_wet_particle_diam(
+        factors, m, diags.dry_geometric_mean_diameter_i[m](k),
+        diags.hygroscopicity[m](k), rel_humidity);
   }
 }
 
@@ -238,7 +259,7 @@ void diag_dgn_wet(
     for (int iaer = 0; iaer < num_aer; ++iaer) {
       const Real weight_gm_per_mol = molecular_weight_gm[iaer];
       const Real tmpa = qaer_cur[iaer][n] * weight_gm_per_mol;
-      tmp_dryvol += tmpa / mam4::aero_species(iaer).density;
+      tmp_dryvol += tmpa * mam4::aero_species_inv_density(iaer);
     }
     // Convert dry volume to dry diameter, then to wet diameter
     const Real sx = std::log(mam4::modes(n).mean_std_dev);
@@ -19,7 +19,8 @@ namespace ndrop {
 using View1D = DeviceType::view_1d<Real>;
 using View2D = DeviceType::view_2d<Real>;
 
-// number of vertical levels
+// default number of vertical levels (the kernels below take the number of
+// levels from their column views)
 constexpr int pver = mam4::nlev;
 // Top level for troposphere cloud physics
 constexpr int top_lev = 7;
@@ -1177,9 +1178,9 @@ void update_from_explmix(
     const View2D &mact,          // fractional aero. mass activation rate [/s]
     const ColumnView &qcld,      // cloud droplet number mixing ratio [#/kg]
     // single column of saved aerosol mass, number mixing ratios [#/kg or kg/kg]
-    const View1D raercol[pver][2],
+    const View1D raercol[][2],
     // same as raercol but for cloud-borne phase [#/kg or kg/kg]
-    const View1D raercol_cw[pver][2],
+    const View1D raercol_cw[][2],
     int &nsav, // indices for old, new time levels in substepping
     int &nnew, // indices for old, new time levels in substepping
     const int nspec_amode[AeroConfig::num_modes()],
@@ -1203,6 +1204,8 @@ void update_from_explmix(
   Real tmpa = zero; //  temporary aerosol tendency variable [/s]
 
   constexpr int ntot_amode = AeroConfig::num_modes();
+  // number of levels in the column
+  const int pver = cldn.extent_int(0);
   // load new droplets in layers above, below clouds
   Real dtmin = dtmicro;
   // rce-comment -- eddy_diff(k) is eddy-diffusivity at k/k+1 interface
@@ -1472,7 +1475,7 @@ void dropmixnuc(
     const ColumnView &wtke, const View2D &ccn,
     const ColumnView coltend[ncnst_tot], const ColumnView coltend_cw[ncnst_tot],
     // work arrays
-    const View1D raercol_cw[pver][2], const View1D raercol[pver][2],
+    const View1D raercol_cw[][2], const View1D raercol[][2],
     const View2D &nact, const View2D &mact, const ColumnView &eddy_diff,
     const ColumnView &zn, const ColumnView &csbot, const ColumnView &zs,
     const ColumnView &overlapp, const ColumnView &overlapm,
@@ -1534,6 +1537,8 @@ void dropmixnuc(
   /// inverse time step for microphysics [s^-1]
   const Real dtinv = one / dtmicro;
   constexpr int ntot_amode = AeroConfig::num_modes();
+  // number of levels in the column
+  const int pver = qcld.extent_int(0);
 
   // NOTE FOR C++ PORT: Get the cloud borne MMRs from AD in variable qcldbrn,
   // do not port the code before END NOTE
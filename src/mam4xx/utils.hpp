@@ -6,8 +6,11 @@
 #ifndef MAM4XX_UTILS_HPP
 #define MAM4XX_UTILS_HPP
 
+#include <haero/haero.hpp>
 #include <haero/math.hpp>
 
+#include <cstddef>
+
 // This file contains utility-type functions that are available for use by
 // various processes, tests, etc.
 
@@ -24,6 +27,88 @@ Real min_max_bound(const Real &low, const Real &high, const Real &num) {
   return max(low, min(high, num));
 }
 
+// This function runs body(k) on each vertical level k in [0, nk) for which
+// is_active(k) is true, and on_inactive(k) on every other level, using all
+// threads in the given team. It returns the number of inactive (skipped)
+// levels. is_active is evaluated up to twice per level, so it should be cheap
+// and free of side effects.
+//
+// If active_levels is allocated (with at least nk entries), a pre-pass
+// compacts the indices of active levels into it so that the team's threads
+// are spread over active levels only. Because active_levels is written by the
+// team, it must not be shared by columns that are processed concurrently. If
+// active_levels is not allocated, inactive levels are masked in place.
+template <typename TeamType, typename IsActive, typename Body,
+          typename OnInactive>
+KOKKOS_INLINE_FUNCTION int
+for_each_active_level(const TeamType &team, const int nk,
+                      const haero::DeviceType::view_1d<int> &active_levels,
+                      const IsActive &is_active, const Body &body,
+                      const OnInactive &on_inactive) {
+  int num_active = 0;
+  if (active_levels.data() == nullptr) {
+    Kokkos::parallel_reduce(
+        Kokkos::TeamThreadRange(team, nk),
+        [&](int k, int &n) {
+          if (is_active(k)) {
+            body(k);
+            ++n;
+          } else {
+            on_inactive(k);
+          }
+        },
+        num_active);
+  } else {
+    Kokkos::parallel_scan(
+        Kokkos::TeamThreadRange(team, nk),
+        [&](int k, int &offset, const bool final) {
+          if (is_active(k)) {
+            if (final) {
+              active_levels(offset) = k;
+            }
+            ++offset;
+          } else if (final) {
+            on_inactive(k);
+          }
+        },
+        num_active);
+    team.team_barrier();
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, num_active),
+                         [&](int i) { body(active_levels(i)); });
+  }
+  return nk - num_active;
+}
+
+// This version does nothing on inactive levels.
+template <typename TeamType, typename IsActive, typename Body>
+KOKKOS_INLINE_FUNCTION int
+for_each_active_level(const TeamType &team, const int nk,
+                      const haero::DeviceType::view_1d<int> &active_levels,
+                      const IsActive &is_active, const Body &body) {
+  return for_each_active_level(team, nk, active_levels, is_active, body,
+                               [](int) {});
+}
+
+// This function adds n to counters(i) once per team. It does nothing if
+// counters is not allocated. The update is atomic, since counters may be
+// shared by several columns.
+template <typename TeamType>
+KOKKOS_INLINE_FUNCTION void
+add_to_counter(const TeamType &team,
+               const haero::DeviceType::view_1d<int> &counters, const int i,
+               const int n) {
+  if (counters.data() != nullptr) {
+    Kokkos::single(Kokkos::PerTeam(team),
+                   [&]() { Kokkos::atomic_add(&counters(i), n); });
+  }
+}
+
+// This function returns the number of bytes allocated for the given view, or
+// 0 if it is not allocated.
+template <typename View> std::size_t view_footprint(const View &v) {
+  return v.is_allocated() ? v.span() * sizeof(typename View::value_type) : 0;
+}
+
 } // end namespace mam4::utils
 
 #endif
@@ -11,6 +11,7 @@
 #include <haero/surface.hpp>
 #include <mam4xx/aero_config.hpp>
 #include <mam4xx/convproc.hpp>
+#include <mam4xx/mode_size_state.hpp>
 #include <mam4xx/utils.hpp>
 #include <mam4xx/wv_sat_methods.hpp>
 namespace mam4 {
@@ -28,11 +29,31 @@ public:
 
 private:
   Config config_;
+  // log-normal factors of the modes, fixed at init
+  ModeLognormalFactors factors_;
 
 public:
   // name -- unique name of the process implemented by this class
   const char *name() const { return "MAM4 wet deposition"; }
 
+  // memory_footprint -- bytes of device memory held by this process
+  std::size_t memory_footprint() const { return 0; }
+
+  // field_access -- groups of fields read and written by compute_tendencies:
+  // the dry diameters and hygroscopicities of the modes determine their wet
+  // diameters and densities
+  KOKKOS_INLINE_FUNCTION
+  static constexpr FieldAccess field_access() {
+    return {field::interstitial_aerosols | field::particle_size,
+            field::particle_size};
+  }
+
+  // prognostic_update -- compute_tendencies only sets tendencies
+  KOKKOS_INLINE_FUNCTION
+  static constexpr PrognosticUpdate prognostic_update() {
+    return PrognosticUpdate::tendencies_only;
+  }
+
   static constexpr Real eps = 1e-4; // Bad constant
 
   // init -- initializes the implementation with MAM4's configuration
@@ -529,8 +550,38 @@ inline void Water_Uptake::init(const AeroConfig &aero_config,
                                const Config &process_config) {
 
   config_ = process_config;
+  factors_ = ModeLognormalFactors();
 };
 
+KOKKOS_INLINE_FUNCTION
+bool Water_Uptake::validate(const AeroConfig &config, const ThreadTeam &team,
+                            const Atmosphere &atm, const Surface &sfc,
+                            const Prognostics &progs) const {
+  return progs.quantities_nonnegative(team);
+}
+
+// compute_tendencies -- computes the wet diameters and densities of the modes
+// by water uptake on the dry diameters in the diagnostics (set by CalcSize or
+// ModeSize), with the hygroscopicities and dry densities of the shared mode
+// size state (see ModeSizeState)
+KOKKOS_INLINE_FUNCTION
+void Water_Uptake::compute_tendencies(const AeroConfig &config,
+                                      const ThreadTeam &team, Real t, Real dt,
+                                      const Atmosphere &atm, const Surface &sfc,
+                                      const Prognostics &progs,
+                                      const Diagnostics &diags,
+                                      const Tendencies &tends) const {
+  const int nk = atm.num_levels();
+  Kokkos::parallel_for(
+      Kokkos::TeamThreadRange(team, nk), KOKKOS_CLASS_LAMBDA(int k) {
+        ModeSizeState state;
+        state.compute_dry(factors_, progs, k);
+        state.load_dry_diameters(diags, k);
+        state.compute_wet(factors_, atm, k);
+        state.store_wet(diags, k);
+      });
+}
+
 } // namespace mam4
 
 #endif
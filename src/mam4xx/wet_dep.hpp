@@ -12,6 +12,7 @@
 #include <limits>
 #include <mam4xx/aero_config.hpp>
 #include <mam4xx/aero_model.hpp>
+#include <mam4xx/bcscavcoef_table.hpp>
 #include <mam4xx/utils.hpp>
 // Based on e3sm_mam4_refactor/components/eam/src/chemistry/aerosol/wetdep.F90
 namespace mam4 {
@@ -1182,6 +1183,30 @@ public:
 
   const char *name() const { return "MAM4 Wet Deposition"; }
 
+  // memory_footprint -- bytes of device memory held by this process
+  std::size_t memory_footprint() const {
+    return utils::view_footprint(cldv) + utils::view_footprint(cldvcu) +
+           utils::view_footprint(cldvst) + utils::view_footprint(rain) +
+           utils::view_footprint(cldcu) + utils::view_footprint(cldt) +
+           utils::view_footprint(evapc) + utils::view_footprint(cmfdqr) +
+           utils::view_footprint(prain) + utils::view_footprint(conicw) +
+           utils::view_footprint(totcond) + utils::view_footprint(scratch);
+  }
+
+  // field_access -- groups of fields read and written by compute_tendencies
+  KOKKOS_INLINE_FUNCTION
+  static constexpr FieldAccess field_access() {
+    return {field::convection | field::cloud_state | field::particle_size,
+            field::convection | field::wet_deposition |
+                field::level_work_arrays};
+  }
+
+  // prognostic_update -- compute_tendencies only sets tendencies
+  KOKKOS_INLINE_FUNCTION
+  static constexpr PrognosticUpdate prognostic_update() {
+    return PrognosticUpdate::tendencies_only;
+  }
+
   void init(const AeroConfig &aero_config,
             const Config &wed_dep_config = Config());
 
@@ -1234,19 +1259,17 @@ inline void WetDeposition::init(const AeroConfig &aero_config,
   Real dgnum_amode[num_modes];
   Real sigmag_amode[num_modes];
   Real aerosol_dry_density[num_modes];
-  for (int i = 0; i < num_modes; ++i) {
-    dgnum_amode[i] = modes(i).nom_diameter;
-    sigmag_amode[i] = modes(i).mean_std_dev;
+  aero_model::bcscavcoef_mode_parameters(dgnum_amode, sigmag_amode,
+                                         aerosol_dry_density);
+  // the table for these modes is generated at build time
+  const aero_model::BcScavCoefTable &table = aero_model::bcscavcoef_table(
+      dgnum_amode, sigmag_amode, aerosol_dry_density);
+  for (int jgrow = 0; jgrow < aero_model::nimptblgrow_total; ++jgrow) {
+    for (int imode = 0; imode < num_modes; ++imode) {
+      scavimptblnum[jgrow][imode] = table.scavimptblnum[jgrow][imode];
+      scavimptblvol[jgrow][imode] = table.scavimptblvol[jgrow][imode];
+    }
   }
-  // Note: Original code uses the following aerosol densities.
-  // sulfate, sulfate, dust, p-organic
-  aerosol_dry_density[0] = mam4::mam4_density_so4;
-  aerosol_dry_density[1] = mam4::mam4_density_so4;
-  aerosol_dry_density[2] = mam4::mam4_density_dst;
-  aerosol_dry_density[3] = mam4::mam4_density_pom;
-  aero_model::modal_aero_bcscavcoef_init(dgnum_amode, sigmag_amode,
-                                         aerosol_dry_density, scavimptblnum,
-                                         scavimptblvol);
 }
 // compute_tendencies -- computes tendencies and updates diagnostics
 // NOTE: that both diags and tends are const below--this means their views
@@ -1334,6 +1357,30 @@ void WetDeposition::compute_tendencies(
       });
   team.team_barrier();
 
+  // No precipitation falls through the levels above the highest one that
+  // produces or evaporates precipitation, so nothing is scavenged or
+  // resuspended there. Columns without precipitation are skipped entirely.
+  int kprec;
+  Kokkos::parallel_reduce(
+      Kokkos::TeamThreadRange(team, nlev),
+      [&](const int k, int &kmin) {
+        const bool wet = (prain[k] != 0 || cmfdqr[k] != 0 || evapr[k] != 0);
+        kmin = haero::min(kmin, wet ? k : nlev);
+      },
+      Kokkos::Min<int>(kprec));
+  if (kprec == nlev) {
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nlev), [&](int k) {
+      aerdepwetis[k] = 0;
+      aerdepwetcw[k] = 0;
+    });
+    utils::add_to_counter(team, diags.num_skipped_columns,
+                          Diagnostics::wetdep_skipped_columns, 1);
+    team.team_barrier();
+    return;
+  }
+  utils::add_to_counter(team, diags.num_skipped_levels,
+                        Diagnostics::wetdep_skipped_levels, kprec);
+
   Kokkos::parallel_for(
       Kokkos::TeamThreadRange(team, 1), KOKKOS_CLASS_LAMBDA(int k) {
         wetdep::clddiag(nlev, temperature.data(), pmid.data(), pdel.data(),
@@ -1355,14 +1402,20 @@ void WetDeposition::compute_tendencies(
         aerdepwetis[k] = 0;
         aerdepwetcw[k] = 0;
         Real rtscavt_sv[gas_pcnst] = {};
-        const bool isprx_k = aero_model::examine_prec_exist(
-            k, pdel.data(), prain.data(), cmfdqr.data(), evapr.data());
+        // levels above kprec only take part in the surface flux sums
+        const bool precipitating = (kprec <= k);
+        const bool isprx_k =
+            precipitating &&
+            aero_model::examine_prec_exist(k, pdel.data(), prain.data(),
+                                           cmfdqr.data(), evapr.data());
 
         Real f_act_conv_coarse = 0, f_act_conv_coarse_dust = 0,
              f_act_conv_coarse_nacl = 0;
-        aero_model::set_f_act_coarse(k, state_q, ptend_q, dt, f_act_conv_coarse,
-                                     f_act_conv_coarse_dust,
-                                     f_act_conv_coarse_nacl);
+        if (precipitating)
+          aero_model::set_f_act_coarse(k, state_q, ptend_q, dt,
+                                       f_act_conv_coarse,
+                                       f_act_conv_coarse_dust,
+                                       f_act_conv_coarse_nacl);
         // main loop over aerosol modes
         for (int mtmp = 0; mtmp < AeroConfig::num_modes(); ++mtmp) {
           // for mam4, do accum, aitken, pcarbon, then coarse
@@ -1381,8 +1434,8 @@ void WetDeposition::compute_tendencies(
 
           // do cloudborne (2) first then interstitial (1)
           for (int lphase = 2; 1 <= lphase; --lphase) {
-            Real scavcoefnum_k, scavcoefvol_k;
-            if (lphase == 1) { // interstial aerosol
+            Real scavcoefnum_k = 0, scavcoefvol_k = 0;
+            if (precipitating && lphase == 1) { // interstial aerosol
               const Real dgnum_amode_imode = modes(imode).nom_diameter;
               ColumnView dgn_awet_imode =
                   diags.wet_geometric_mean_diameter_i[imode];
@@ -1394,8 +1447,9 @@ void WetDeposition::compute_tendencies(
 
             Real sol_facti = 0, sol_factic = 0, sol_factb = 0;
             Real f_act_conv = 0;
-            aero_model::define_act_frac(lphase, imode, sol_facti, sol_factic,
-                                        sol_factb, f_act_conv);
+            if (precipitating)
+              aero_model::define_act_frac(lphase, imode, sol_facti,
+                                          sol_factic, sol_factb, f_act_conv);
 
             // REASTER 08/12/2015 - changed ordering (mass then number) for
             // prevap resuspend to coarse loop over number + chem constituents +
@@ -1473,18 +1527,21 @@ void WetDeposition::compute_tendencies(
                   // is_strat_cloudborne = true if tracer is
                   // stratiform-cloudborne aerosol; else false
                   const bool is_strat_cloudborne = false;
-                  wetdep::wetdepa_v2(
-                      dt, pdel[k], cmfdqr[k], evapc[k], dlf[k], conicw[k],
-                      prain[k], evapr[k], totcond[k], cldt[k], cldcu[k],
-                      cldvcu[k], cldvcu[k_p1], cldvst[k], cldvst[k_p1],
-                      sol_factb, sol_facti, sol_factic, mam_prevap_resusp_optcc,
-                      is_strat_cloudborne, scavcoef, f_act_conv, tracer, qqcw,
-                      fracis, scavt, iscavt, icscavt, isscavt, bcscavt, bsscavt,
-                      rcscavt, rsscavt);
-                  const bool update_dqdt = true;
-                  aero_model::calc_resusp_to_coarse(mm, update_dqdt, rcscavt,
-                                                    rsscavt, scavt, rtscavt_sv);
-                  ptend_q(k, mm) += scavt;
+                  if (precipitating) {
+                    wetdep::wetdepa_v2(
+                        dt, pdel[k], cmfdqr[k], evapc[k], dlf[k], conicw[k],
+                        prain[k], evapr[k], totcond[k], cldt[k], cldcu[k],
+                        cldvcu[k], cldvcu[k_p1], cldvst[k], cldvst[k_p1],
+                        sol_factb, sol_facti, sol_factic,
+                        mam_prevap_resusp_optcc, is_strat_cloudborne, scavcoef,
+                        f_act_conv, tracer, qqcw, fracis, scavt, iscavt,
+                        icscavt, isscavt, bcscavt, bsscavt, rcscavt, rsscavt);
+                    const bool update_dqdt = true;
+                    aero_model::calc_resusp_to_coarse(mm, update_dqdt, rcscavt,
+                                                      rsscavt, scavt,
+                                                      rtscavt_sv);
+                    ptend_q(k, mm) += scavt;
+                  }
 
                   aerdepwetis[k] =
                       aero_model::calc_sfc_flux(team, scratch, scavt, pdel[k]);
@@ -1,12 +1,76 @@
 #ifndef MAM4XX_WV_SAT_METHODS_HPP
 #define MAM4XX_WV_SAT_METHODS_HPP
 
+#include <mam4xx/aero_config.hpp>
+
+#include <haero/constants.hpp>
+#include <haero/haero.hpp>
+#include <haero/math.hpp>
+
 namespace mam4 {
 
 namespace wv_sat_methods {
 
-KOKKOS_INLINE_FUNCTION
-Real GoffGratch_svp_water(const Real temperature) {
+namespace detail {
+
+// log10 and powers of 10 evaluated at run time
+struct RuntimeMath {
+  KOKKOS_INLINE_FUNCTION
+  static Real pow10(const Real x) { return haero::pow(Real(10), x); }
+  KOKKOS_INLINE_FUNCTION
+  static Real log10(const Real x) { return haero::log10(x); }
+};
+
+// log10 and powers of 10 evaluated at compile time (for tabulation), accurate
+// to a few ulps
+struct ConstexprMath {
+  static constexpr Real ln2 = 0.693147180559945309417232121458176568;
+  static constexpr Real ln10 = 2.302585092994045684017991454684364208;
+
+  static constexpr Real exp(const Real x) {
+    // x = k ln(2) + r with |r| <= ln(2)/2
+    const Real kf = x / ln2;
+    int k = static_cast<int>((kf < 0) ? kf - Real(0.5) : kf + Real(0.5));
+    const Real r = x - k * ln2;
+    Real term = r, sum = 1 + r;
+    for (int n = 2; sum + term != sum; ++n) {
+      term *= r / n;
+      sum += term;
+    }
+    for (; k > 0; --k)
+      sum *= 2;
+    for (; k < 0; ++k)
+      sum /= 2;
+    return sum;
+  }
+
+  static constexpr Real log(Real x) {
+    // x = m 2^e with 1/sqrt(2) <= m < sqrt(2), and
+    // ln(m) = 2 atanh(z) with z = (m-1)/(m+1), |z| < 0.172
+    const Real sqrt2 = 1.414213562373095048801688724209698079;
+    int e = 0;
+    for (; x >= sqrt2; ++e)
+      x /= 2;
+    for (; x < sqrt2 / 2; --e)
+      x *= 2;
+    const Real z = (x - 1) / (x + 1), z2 = z * z;
+    Real term = z * z2, sum = z;
+    for (int n = 3; sum + term / n != sum; n += 2) {
+      sum += term / n;
+      term *= z2;
+    }
+    return 2 * sum + e * ln2;
+  }
+
+  static constexpr Real pow10(const Real x) { return exp(x * ln10); }
+  static constexpr Real log10(const Real x) { return log(x) / ln10; }
+};
+
+// Goff & Gratch formula for the saturation vapor pressure over water [Pa],
+// with the given log10 and powers of 10
+template <typename Math>
+KOKKOS_INLINE_FUNCTION constexpr Real
+goff_gratch_svp_water(const Real temperature) {
   // Goff & Gratch (1946)
   // temperature in Kelvin
 
@@ -25,24 +89,24 @@ Real GoffGratch_svp_water(const Real temperature) {
   const Real svp_at_steam_pt_pressure = 1013.246; // BAD_CONSTANT!
 
   // uncertain below -70 C (NOTE: from mam4)
-  return haero::pow(ten,
-                    -Real(7.90298) * (tboil / temperature - one) +
-                        Real(5.02808) * haero::log10(tboil / temperature) -
-                        Real(1.3816e-7) *
-                            (haero::pow(ten, Real(11.344) *
-                                                 (one - temperature / tboil)) -
-                             one) +
-                        Real(8.1328e-3) *
-                            (haero::pow(ten, -Real(3.49149) *
-                                                 (tboil / temperature - one)) -
-                             one) +
-                        haero::log10(svp_at_steam_pt_pressure)) *
+  return Math::pow10(
+             -Real(7.90298) * (tboil / temperature - one) +
+             Real(5.02808) * Math::log10(tboil / temperature) -
+             Real(1.3816e-7) *
+                 (Math::pow10(Real(11.344) * (one - temperature / tboil)) -
+                  one) +
+             Real(8.1328e-3) *
+                 (Math::pow10(-Real(3.49149) * (tboil / temperature - one)) -
+                  one) +
+             Math::log10(svp_at_steam_pt_pressure)) *
          ten * ten;
+}
 
-} // GoffGratch_svp_water
-
-KOKKOS_INLINE_FUNCTION
-Real GoffGratch_svp_ice(const Real temperature) {
+// Goff & Gratch formula for the saturation vapor pressure over ice [Pa], with
+// the given log10 and powers of 10
+template <typename Math>
+KOKKOS_INLINE_FUNCTION constexpr Real
+goff_gratch_svp_ice(const Real temperature) {
   // temperature in Kelvin
 
   // good down to -100 C
@@ -54,15 +118,144 @@ Real GoffGratch_svp_ice(const Real temperature) {
   // https://en.wikipedia.org/wiki/Goff-Gratch_equation
   const Real svp_at_ice_pt_pressure = 6.1071; // BAD_CONSTANT!
 
-  return haero::pow(ten,
-                    -Real(9.09718) * (h2otrip / temperature - one) -
-                        Real(3.56654) * haero::log10(h2otrip / temperature) +
-                        Real(0.876793) * (one - temperature / h2otrip) +
-                        haero::log10(svp_at_ice_pt_pressure)) *
+  return Math::pow10(-Real(9.09718) * (h2otrip / temperature - one) -
+                     Real(3.56654) * Math::log10(h2otrip / temperature) +
+                     Real(0.876793) * (one - temperature / h2otrip) +
+                     Math::log10(svp_at_ice_pt_pressure)) *
          ten * ten;
+}
 
+} // namespace detail
+
+KOKKOS_INLINE_FUNCTION
+Real GoffGratch_svp_water(const Real temperature) {
+  return detail::goff_gratch_svp_water<detail::RuntimeMath>(temperature);
+} // GoffGratch_svp_water
+
+KOKKOS_INLINE_FUNCTION
+Real GoffGratch_svp_ice(const Real temperature) {
+  return detail::goff_gratch_svp_ice<detail::RuntimeMath>(temperature);
 } // end GoffGratch_svp_ice
 
+namespace detail {
+
+// Range of temperatures [K] of the saturation vapor pressure tables
+constexpr Real svp_table_tmin = 150;
+constexpr Real svp_table_tmax = 350;
+
+// Bound on the relative error of the cubic interpolation of the tables divided
+// by the fourth power of their spacing [K], i.e. 3/128 max |d4 es/dT4| / es
+// over the range of the tables. It is largest for water at the lowest
+// temperatures (3.5e-4); for ice it is 9.1e-5. (BAD CONSTANT)
+constexpr Real svp_table_error_coef = 4.0e-4;
+
+// Largest number of nodes per kelvin of the tables, which are computed at
+// compile time (32 nodes per kelvin give 6401 entries per table and relative
+// errors of 3.8e-10). The SVP_TABLE_TOLERANCE CMake option is checked
+// against the smallest tolerance this allows.
+constexpr int svp_table_max_nodes_per_kelvin = 32;
+
+// Returns true if tables with the given number of nodes per kelvin are
+// interpolated with relative errors below the given tolerance
+constexpr bool svp_table_meets_tolerance(const int nodes_per_kelvin,
+                                         const Real tolerance) {
+  const Real n = nodes_per_kelvin;
+  return svp_table_error_coef <= tolerance * n * n * n * n;
+}
+
+// Returns the number of nodes per kelvin (a power of 2, at most
+// svp_table_max_nodes_per_kelvin) of tables interpolated with relative errors
+// below the given tolerance, if there is one
+constexpr int svp_table_nodes_per_kelvin(const Real tolerance) {
+  int n = 1;
+  while (n < svp_table_max_nodes_per_kelvin &&
+         !svp_table_meets_tolerance(n, tolerance))
+    n *= 2;
+  return n;
+}
+
+static_assert(!svp_table ||
+                  svp_table_meets_tolerance(
+                      svp_table_nodes_per_kelvin(svp_table_tolerance),
+                      svp_table_tolerance),
+              "svp_table_tolerance (SVP_TABLE_TOLERANCE) is too small for "
+              "the saturation vapor pressure tables");
+
+// Saturation vapor pressures over water and ice [Pa] at evenly spaced
+// temperatures from svp_table_tmin to svp_table_tmax, computed at compile time
+template <int NodesPerKelvin> struct SvpTable {
+  static constexpr int size =
+      static_cast<int>(svp_table_tmax - svp_table_tmin) * NodesPerKelvin + 1;
+  Real water[size];
+  Real ice[size];
+
+  constexpr SvpTable() : water(), ice() {
+    for (int i = 0; i < size; ++i) {
+      const Real temperature = svp_table_tmin + Real(i) / NodesPerKelvin;
+      water[i] = goff_gratch_svp_water<ConstexprMath>(temperature);
+      ice[i] = goff_gratch_svp_ice<ConstexprMath>(temperature);
+    }
+  }
+};
+
+// Returns the table with NodesPerKelvin nodes per kelvin, which is only built
+// if it is used. It is a function-local static so that device code gets its
+// own copy (namespace-scope arrays are only accessible on the host).
+template <int NodesPerKelvin>
+KOKKOS_INLINE_FUNCTION const SvpTable<NodesPerKelvin> &svp_table_values() {
+  static constexpr SvpTable<NodesPerKelvin> values{};
+  return values;
+}
+
+// Interpolates the given table with NodesPerKelvin nodes per kelvin at the
+// given temperature with a cubic through the 4 nearest nodes, storing the
+// result in value. Returns false (and leaves value alone) if the temperature
+// is too close to the ends of the table (or isn't a number).
+template <int NodesPerKelvin>
+KOKKOS_INLINE_FUNCTION bool
+svp_table_interpolate(const Real (&table)[SvpTable<NodesPerKelvin>::size],
+                      const Real temperature, Real &value) {
+  constexpr int size = SvpTable<NodesPerKelvin>::size;
+  const Real x = (temperature - svp_table_tmin) * NodesPerKelvin;
+  if (!(x >= 1 && x < size - 2))
+    return false;
+  const int i = static_cast<int>(x);
+  const Real s = x - i;
+  // Lagrange weights of the nodes i-1, i, i+1 and i+2
+  const Real sp1 = s + 1, sm1 = s - 1, sm2 = s - 2;
+  value = (sp1 * s * sm1 * table[i + 2] - s * sm1 * sm2 * table[i - 1]) / 6 +
+          (sp1 * sm1 * sm2 * table[i] - sp1 * s * sm2 * table[i + 1]) / 2;
+  return true;
+}
+
+} // namespace detail
+
+// Saturation vapor pressure over water [Pa] interpolated from a table of
+// GoffGratch_svp_water with NodesPerKelvin nodes per kelvin (by default, the
+// number meeting svp_table_tolerance), or computed by GoffGratch_svp_water
+// outside the range of the table.
+template <int NodesPerKelvin =
+              detail::svp_table_nodes_per_kelvin(svp_table_tolerance)>
+KOKKOS_INLINE_FUNCTION Real tabulated_svp_water(const Real temperature) {
+  Real es = 0;
+  if (!detail::svp_table_interpolate<NodesPerKelvin>(
+          detail::svp_table_values<NodesPerKelvin>().water, temperature, es))
+    es = GoffGratch_svp_water(temperature);
+  return es;
+}
+
+// Saturation vapor pressure over ice [Pa] interpolated from a table of
+// GoffGratch_svp_ice, as above
+template <int NodesPerKelvin =
+              detail::svp_table_nodes_per_kelvin(svp_table_tolerance)>
+KOKKOS_INLINE_FUNCTION Real tabulated_svp_ice(const Real temperature) {
+  Real es = 0;
+  if (!detail::svp_table_interpolate<NodesPerKelvin>(
+          detail::svp_table_values<NodesPerKelvin>().ice, temperature, es))
+    es = GoffGratch_svp_ice(temperature);
+  return es;
+}
+
 // FIXME
 // Compute saturation vapor pressure over water
 KOKKOS_INLINE_FUNCTION
@@ -70,7 +263,10 @@ Real svp_water(const Real temperature) {
   // FIXME
   // ask if we need to implement the other methods to compute svp_water
   // initial_default_idx = GoffGratch_idx
-  return GoffGratch_svp_water(temperature);
+  if constexpr (svp_table)
+    return tabulated_svp_water(temperature);
+  else
+    return GoffGratch_svp_water(temperature);
 }
 
 /*---------------------------------------------------------------------
@@ -129,7 +325,12 @@ void wv_sat_qsat_water(const Real t, const Real p, Real &es, Real &qs) {
 } // wv_sat_qsat_water
 
 KOKKOS_INLINE_FUNCTION
-Real svp_ice(const Real temperature) { return GoffGratch_svp_ice(temperature); }
+Real svp_ice(const Real temperature) {
+  if constexpr (svp_table)
+    return tabulated_svp_ice(temperature);
+  else
+    return GoffGratch_svp_ice(temperature);
+}
 
 KOKKOS_INLINE_FUNCTION
 Real wv_sat_svp_trans(const Real t) {
@@ -142,14 +343,14 @@ Real wv_sat_svp_trans(const Real t) {
   // Water
   Real es = zero;
   if (t >= (tmelt - ttrice)) {
-    es = wv_sat_methods::GoffGratch_svp_water(t);
+    es = svp_water(t);
   }
   // Ice
   // Intermediate scratch variable for es transition
   if (t < tmelt) {
     // Saturation vapor pressure over ice
     Real weight = one;
-    const Real esice = wv_sat_methods::GoffGratch_svp_ice(t);
+    const Real esice = svp_ice(t);
     if ((tmelt - t) < ttrice) {
       weight = (tmelt - t) / ttrice;
     }
@@ -0,0 +1,170 @@
+// mam4xx: Copyright (c) 2022,
+// Battelle Memorial Institute and
+// National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+// SPDX-License-Identifier: BSD-3-Clause
+
+// mam4xx_replay reruns the columns captured by mam4::io::capture_columns
+// through a single MAM4 process, reproducing the inputs it saw in the host
+// model, so the process can be profiled in isolation.
+
+#include <mam4xx/column_storage.hpp>
+#include <mam4xx/io.hpp>
+#include <mam4xx/mam4.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace haero;
+using namespace mam4;
+
+namespace {
+
+// runs the process implemented by Impl on the captured columns the given
+// number of times, restoring the captured inputs before each run, and reports
+// the time spent in the process
+template <typename Impl>
+void replay(const io::Checkpoint &capture, const std::string &name,
+            const int repetitions) {
+  const int ncol = capture.num_columns();
+  const int nlev = static_cast<int>(capture.values("capture/num_levels")[0]);
+  const Real t = capture.values("capture/time")[0];
+  const Real dt = capture.values("capture/time_step")[0];
+  const std::vector<Real> columns = capture.values("capture/columns");
+
+  // the configurations of MAM4 and of the process, whose parameters keep their
+  // default values if they weren't captured
+  AeroConfig config;
+  typename Impl::Config process_config;
+  const int num_missing = io::load_parameters(capture, "config", config) +
+                          io::load_parameters(capture, "config",
+                                              process_config);
+  if (num_missing > 0)
+    std::cout << "mam4xx_replay: " << num_missing
+              << " configuration parameter(s) weren't captured and keep "
+              << "their default values" << std::endl;
+  const haero::AeroProcess<AeroConfig, Impl> process(config, process_config);
+
+  // columns with the diagnostics used by the process, which must have been
+  // captured
+  const FieldSet fields =
+      fields_accessed<haero::AeroProcess<AeroConfig, Impl>>() &
+      diagnostic_fields;
+  ColumnStorage storage;
+  std::vector<Atmosphere> atm;
+  std::vector<Surface> sfc(ncol);
+  std::vector<Prognostics> progs;
+  std::vector<Diagnostics> diags;
+  std::vector<Tendencies> tends;
+  for (int icol = 0; icol < ncol; ++icol) {
+    atm.push_back(create_atmosphere(nlev, storage));
+    progs.push_back(create_prognostics(nlev, storage));
+    diags.push_back(create_diagnostics(nlev, storage, fields));
+    tends.push_back(create_tendencies(nlev, storage));
+  }
+  DeviceType::view_1d<Atmosphere> mc_atm("mc_atm", ncol);
+  DeviceType::view_1d<Surface> mc_sfc("mc_sfc", ncol);
+  DeviceType::view_1d<Prognostics> mc_progs("mc_progs", ncol);
+  DeviceType::view_1d<Diagnostics> mc_diags("mc_diags", ncol);
+  DeviceType::view_1d<Tendencies> mc_tends("mc_tends", ncol);
+  auto h_atm = Kokkos::create_mirror_view(mc_atm);
+  auto h_sfc = Kokkos::create_mirror_view(mc_sfc);
+  auto h_progs = Kokkos::create_mirror_view(mc_progs);
+  auto h_diags = Kokkos::create_mirror_view(mc_diags);
+  auto h_tends = Kokkos::create_mirror_view(mc_tends);
+
+  std::cout << "mam4xx_replay: running " << ncol << " column(s) of " << nlev
+            << " levels through " << name << " (t = " << t
+            << ", dt = " << dt << ")" << std::endl;
+  Real total_time = 0.0, min_time = 0.0;
+  for (int n = 0; n < repetitions; ++n) {
+    capture.load("atm", atm);
+    capture.load("sfc", sfc);
+    capture.load("progs", progs);
+    capture.load("diags", diags);
+    for (int icol = 0; icol < ncol; ++icol) {
+      h_atm(icol) = atm[icol];
+      h_sfc(icol) = sfc[icol];
+      h_progs(icol) = progs[icol];
+      h_diags(icol) = diags[icol];
+      h_tends(icol) = tends[icol];
+    }
+    Kokkos::deep_copy(mc_atm, h_atm);
+    Kokkos::deep_copy(mc_sfc, h_sfc);
+    Kokkos::deep_copy(mc_progs, h_progs);
+    Kokkos::deep_copy(mc_diags, h_diags);
+    Kokkos::deep_copy(mc_tends, h_tends);
+    Kokkos::fence();
+
+    Kokkos::Timer timer;
+    io::compute_tendencies(io::CaptureOptions(), process, config, ncol, t, dt,
+                           mc_atm, mc_sfc, mc_progs, mc_diags, mc_tends);
+    Kokkos::fence();
+    const Real time = timer.seconds();
+    total_time += time;
+    min_time = (n == 0) ? time : std::min(min_time, time);
+  }
+  std::cout << "mam4xx_replay: " << repetitions << " run(s) of columns";
+  for (const Real icol : columns)
+    std::cout << " " << static_cast<int>(icol);
+  std::cout << ": mean " << total_time / repetitions << " s, min " << min_time
+            << " s" << std::endl;
+}
+
+using ReplayFunction = void (*)(const io::Checkpoint &, const std::string &,
+                                int);
+
+// processes that can be replayed, by name
+const std::map<std::string, ReplayFunction> replays = {
+    {"aging", replay<Aging>},
+    {"calcsize", replay<CalcSize>},
+    {"coagulation", replay<Coagulation>},
+    {"convproc", replay<ConvProc>},
+    {"drydep", replay<DryDep>},
+    {"gasaerexch", replay<GasAerExch>},
+    {"hetfrz", replay<Hetfrz>},
+    {"mode_size", replay<ModeSize>},
+    {"nucleate_ice", replay<NucleateIce>},
+    {"nucleation", replay<Nucleation>},
+    {"rename", replay<Rename>},
+    {"water_uptake", replay<Water_Uptake>},
+    {"wetdep", replay<WetDeposition>},
+};
+
+int usage() {
+  std::cerr << "mam4xx_replay: reruns captured columns through a process.\n"
+            << "usage: mam4xx_replay <capture file> <process> [repetitions]\n"
+            << "processes:";
+  for (const auto &r : replays)
+    std::cerr << " " << r.first;
+  std::cerr << std::endl;
+  return 1;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  if (argc < 3)
+    return usage();
+  const std::string filename = argv[1];
+  const std::string process = argv[2];
+  const int repetitions = (argc > 3) ? std::atoi(argv[3]) : 1;
+  if (repetitions < 1)
+    return usage();
+  const auto r = replays.find(process);
+  if (r == replays.end()) {
+    std::cerr << "mam4xx_replay: unknown process " << process << std::endl;
+    return usage();
+  }
+
+  Kokkos::initialize(argc, argv);
+  {
+    const auto capture = io::Checkpoint::read(filename, io::ReadOptions());
+    r->second(capture, process, repetitions);
+  }
+  Kokkos::finalize();
+  return 0;
+}
@@ -47,3 +47,22 @@ TEST_CASE("aero_modes_test", "") {
     }
   }
 }
+
+TEST_CASE("aero_modes_constexpr_test", "") {
+  // mode and species metadata are available at compile time
+  static_assert(num_species_mode(1) == 4, "");
+  static_assert(modes(2).mean_std_dev == mam4_coarse_mead_std_dev, "");
+  static_assert(aero_species(5).density == mam4_density_dst, "");
+  static_assert(aerosol_index_for_mode(ModeIndex::Coarse, AeroId::DST) == 5,
+                "");
+  static_assert(!mode_contains_species(ModeIndex::Aitken, AeroId::DST), "");
+  static_assert(!mode_contains_species(ModeIndex::Aitken, AeroId::None), "");
+
+  for (int m = 0; m < 4; ++m) {
+    for (int s = 0; s < num_species_mode(m); ++s) {
+      const int aero_id = static_cast<int>(mode_aero_species(m, s));
+      REQUIRE(mode_species_inv_density(m, s) ==
+              Approx(1.0 / aero_species(aero_id).density));
+    }
+  }
+}
@@ -163,8 +163,8 @@ TEST_CASE("kohler_verificiation", "") {
     const Real mam4_kelvin_a = kelvin_coefficient() * 1e6;
 
     for (int i = 0; i < N3; ++i) {
-      REQUIRE(
-          FloatingPoint<Real>::equiv(h_k0(i), mam4_kelvin_a * cube(h_rdry(i))));
+      REQUIRE(FloatingPoint<Real>::equiv(
+          h_k0(i), mam4_kelvin_a * haero::cube(h_rdry(i))));
       REQUIRE(h_krdry(i) > 0);
       REQUIRE(h_k25(i) < 0);
     }
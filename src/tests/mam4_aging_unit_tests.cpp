@@ -77,6 +77,16 @@ TEST_CASE("test_compute_tendencies", "mam4_aging_process") {
     CHECK(!isnan(h_tend_qgas0(k)));
   }
 
+  // Put primary carbon aerosol in the lower half of the column only, so that
+  // aging skips the upper half.
+  const int ipc = static_cast<int>(mam4::ModeIndex::PrimaryCarbon);
+  const auto prog_num_pc = progs.n_mode_i[ipc];
+  auto h_prog_num_pc = Kokkos::create_mirror_view(prog_num_pc);
+  for (int k = 0; k < nlev; ++k) {
+    h_prog_num_pc(k) = (k < nlev / 2) ? 0.0 : 1.0e6;
+  }
+  Kokkos::deep_copy(prog_num_pc, h_prog_num_pc);
+
   // Single-column dispatch.
   auto team_policy = ThreadTeamPolicy(1u, Kokkos::AUTO);
   Real t = 0.0, dt = 30.0;
@@ -87,6 +97,10 @@ TEST_CASE("test_compute_tendencies", "mam4_aging_process") {
   Kokkos::deep_copy(h_prog_qgas0, prog_qgas0);
   Kokkos::deep_copy(h_tend_qgas0, tend_qgas0);
 
+  auto h_num_skipped = Kokkos::create_mirror_view(diags.num_skipped_levels);
+  Kokkos::deep_copy(h_num_skipped, diags.num_skipped_levels);
+  REQUIRE(h_num_skipped(mam4::Diagnostics::aging_skipped_levels) == nlev / 2);
+
   ss << "prog_qgas0 [out]: [ ";
   for (int k = 0; k < nlev; ++k) {
     ss << h_prog_qgas0(k) << " ";
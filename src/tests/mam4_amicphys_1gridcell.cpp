@@ -244,6 +244,7 @@ void mam_amicphys_1subarea_clear(
       const Real dtsub_soa_fixed = -1.0;
       // Integration order
       const int nghq = 2;
+      const ModeLognormalFactors lnsg_terms(alnsg_aer);
       const int ntot_soamode = 4;
       int niter_out = 0;
       Real g0_soa_out = 0;
@@ -251,9 +252,9 @@ void mam_amicphys_1subarea_clear(
       gasaerexch::mam_gasaerexch_1subarea(
           nghq, igas_h2so4, use_nh3, ntot_soamode, gas_to_aer, iaer_so4,
           iaer_pom, l_calc_gas_uptake_coeff, l_gas_condense_to_mode,
-          eqn_and_numerics_category, dtsubstep, dtsub_soa_fixed, temp, pmid,
-          aircon, num_gas_ids, qgas_cur, qgas_avg, qgas_netprod_otrproc,
-          qaer_cur, qnum_cur, dgn_awet, alnsg_aer, uptk_rate_factor, uptkaer,
+          eqn_and_numerics_category, dtsubstep, dtsub_soa_fixed, false, temp,
+          pmid, aircon, num_gas_ids, qgas_cur, qgas_avg, qgas_netprod_otrproc,
+          qaer_cur, qnum_cur, dgn_awet, lnsg_terms, uptk_rate_factor, uptkaer,
           uptkrate_h2so4, niter_out, g0_soa_out);
 
       if (newnuc_h2so4_conc_optaa == 11)
@@ -719,6 +720,7 @@ void mam_amicphys_1subarea_cloudy(
           qaer_sv1[j][i] = qaer_cur[j][i];
 
       const int nghq = 2;
+      const ModeLognormalFactors lnsg_terms(alnsg_aer);
       const int ntot_soamode = 4;
       int niter_out = 0;
       Real g0_soa_out = 0;
@@ -728,9 +730,9 @@ void mam_amicphys_1subarea_cloudy(
       gasaerexch::mam_gasaerexch_1subarea(
           nghq, igas_h2so4, use_nh3, ntot_soamode, gas_to_aer, iaer_so4,
           iaer_pom, l_calc_gas_uptake_coeff, l_gas_condense_to_mode,
-          eqn_and_numerics_category, dtsubstep, dtsub_soa_fixed, temp, pmid,
-          aircon, num_gas_ids, qgas_cur, qgas_avg, qgas_netprod_otrproc,
-          qaer_cur, qnum_cur, dgn_awet, alnsg_aer, uptk_rate_factor, uptkaer,
+          eqn_and_numerics_category, dtsubstep, dtsub_soa_fixed, false, temp,
+          pmid, aircon, num_gas_ids, qgas_cur, qgas_avg, qgas_netprod_otrproc,
+          qaer_cur, qnum_cur, dgn_awet, lnsg_terms, uptk_rate_factor, uptkaer,
           uptkrate_h2so4, niter_out, g0_soa_out);
 
       if (newnuc_h2so4_conc_optaa == 11)
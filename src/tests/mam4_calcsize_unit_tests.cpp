@@ -152,3 +152,120 @@ TEST_CASE("test_compute_tendencies", "mam4_calcsize_process") {
     } // end species
   }   // end modes
 }
+
+TEST_CASE("test_reuse_unchanged_levels", "mam4_calcsize_process") {
+  const int nlev = 8;
+  const auto nmodes = mam4::AeroConfig::num_modes();
+  Atmosphere atm = mam4::testing::create_atmosphere(nlev, 1000);
+  Surface sfc = mam4::testing::create_surface();
+  mam4::Prognostics progs = mam4::testing::create_prognostics(nlev);
+  mam4::Diagnostics diags = mam4::testing::create_diagnostics(nlev);
+  mam4::Diagnostics ref_diags = mam4::testing::create_diagnostics(nlev);
+  mam4::Tendencies tends = mam4::testing::create_tendencies(nlev);
+  mam4::Tendencies ref_tends = mam4::testing::create_tendencies(nlev);
+
+  // levels without aerosols need no adjustment or transfer, and their results
+  // can be reused; the others are (mostly) adjusted towards the size bounds
+  // of their modes
+  for (int imode = 0; imode < nmodes; ++imode) {
+    auto h_n = Kokkos::create_mirror_view(progs.n_mode_i[imode]);
+    for (int k = 0; k < nlev; ++k)
+      h_n(k) = (k % 2 == 0) ? 0.0 : 1.0e9 * (imode + 1);
+    Kokkos::deep_copy(progs.n_mode_i[imode], h_n);
+    for (int isp = 0; isp < mam4::num_species_mode(imode); ++isp) {
+      auto h_q = Kokkos::create_mirror_view(progs.q_aero_i[imode][isp]);
+      for (int k = 0; k < nlev; ++k)
+        h_q(k) = (k % 2 == 0) ? 0.0 : 1.0e-9 * (isp + 1);
+      Kokkos::deep_copy(progs.q_aero_i[imode][isp], h_q);
+    }
+  }
+
+  mam4::AeroConfig mam4_config;
+  mam4::CalcSizeProcess ref_process(mam4_config);
+  mam4::CalcSize::Config process_config;
+  process_config.reuse_unchanged_levels = true;
+  mam4::CalcSizeProcess process(mam4_config, process_config);
+
+  auto zero_tends = [&](const mam4::Tendencies &dqdt) {
+    for (int imode = 0; imode < nmodes; ++imode) {
+      Kokkos::deep_copy(dqdt.n_mode_i[imode], 0.0);
+      Kokkos::deep_copy(dqdt.n_mode_c[imode], 0.0);
+      for (int isp = 0; isp < mam4::num_species_mode(imode); ++isp) {
+        Kokkos::deep_copy(dqdt.q_aero_i[imode][isp], 0.0);
+        Kokkos::deep_copy(dqdt.q_aero_c[imode][isp], 0.0);
+      }
+    }
+  };
+  auto run = [&](const mam4::CalcSizeProcess &p, const mam4::Diagnostics &d,
+                 const mam4::Tendencies &dqdt) {
+    zero_tends(dqdt);
+    Real t = 0.0, dt = 30.0;
+    Kokkos::parallel_for(
+        haero::ThreadTeamPolicy(1u, Kokkos::AUTO),
+        KOKKOS_LAMBDA(const ThreadTeam &team) {
+          p.compute_tendencies(team, t, dt, atm, sfc, progs, d, dqdt);
+        });
+  };
+  // checks that the results of the process reusing levels are exactly those
+  // of the reference process
+  auto require_same = [&](const ColumnView &v, const ColumnView &ref) {
+    auto h_v = Kokkos::create_mirror_view(v);
+    auto h_ref = Kokkos::create_mirror_view(ref);
+    Kokkos::deep_copy(h_v, v);
+    Kokkos::deep_copy(h_ref, ref);
+    for (int k = 0; k < nlev; ++k)
+      REQUIRE(h_v(k) == h_ref(k));
+  };
+  auto require_same_results = [&]() {
+    for (int imode = 0; imode < nmodes; ++imode) {
+      require_same(diags.dry_geometric_mean_diameter_i[imode],
+                   ref_diags.dry_geometric_mean_diameter_i[imode]);
+      require_same(diags.dry_geometric_mean_diameter_c[imode],
+                   ref_diags.dry_geometric_mean_diameter_c[imode]);
+      require_same(tends.n_mode_i[imode], ref_tends.n_mode_i[imode]);
+      require_same(tends.n_mode_c[imode], ref_tends.n_mode_c[imode]);
+      for (int isp = 0; isp < mam4::num_species_mode(imode); ++isp) {
+        require_same(tends.q_aero_i[imode][isp],
+                     ref_tends.q_aero_i[imode][isp]);
+        require_same(tends.q_aero_c[imode][isp],
+                     ref_tends.q_aero_c[imode][isp]);
+      }
+    }
+  };
+  auto num_reused = [&]() {
+    auto h_skipped = Kokkos::create_mirror_view(diags.num_skipped_levels);
+    Kokkos::deep_copy(h_skipped, diags.num_skipped_levels);
+    return h_skipped(mam4::Diagnostics::calcsize_skipped_levels);
+  };
+
+  // nothing is reused by the first call
+  run(ref_process, ref_diags, ref_tends);
+  run(process, diags, tends);
+  require_same_results();
+  REQUIRE(num_reused() == 0);
+
+  // the second call with the same inputs reuses at least the empty levels
+  run(process, diags, tends);
+  require_same_results();
+  const int num_reused_2 = num_reused();
+  REQUIRE(num_reused_2 >= nlev / 2);
+  REQUIRE(num_reused_2 <= nlev);
+
+  // a level whose inputs change is recomputed (here, coarse mode particles
+  // without mass are removed by the number adjustment)
+  const int icoarse = static_cast<int>(mam4::ModeIndex::Coarse);
+  auto h_n = Kokkos::create_mirror_view(progs.n_mode_i[icoarse]);
+  Kokkos::deep_copy(h_n, progs.n_mode_i[icoarse]);
+  h_n(0) = 1.0e6;
+  Kokkos::deep_copy(progs.n_mode_i[icoarse], h_n);
+  run(ref_process, ref_diags, ref_tends);
+  run(process, diags, tends);
+  require_same_results();
+  REQUIRE(num_reused() == 2 * num_reused_2 - 1);
+
+  // the level changed isn't reused by the next call either, because its
+  // tendencies change its inputs
+  run(process, diags, tends);
+  require_same_results();
+  REQUIRE(num_reused() == 3 * num_reused_2 - 2);
+}
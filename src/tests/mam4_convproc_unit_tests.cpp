@@ -18,6 +18,18 @@
 
 using namespace haero;
 
+namespace {
+
+// runs f on one team of the largest size allowed for it, so that the species
+// sweeps are spread over more than one thread on all but the Serial backend
+template <typename F> void run_on_team(const F &f) {
+  const int team_size =
+      ThreadTeamPolicy(1, 1).team_size_max(f, Kokkos::ParallelForTag());
+  Kokkos::parallel_for(ThreadTeamPolicy(1, team_size), f);
+}
+
+} // namespace
+
 TEST_CASE("test_constructor", "mam4_convproc_process") {
   mam4::AeroConfig mam4_config;
   mam4::ConvProcProcess process(mam4_config);
@@ -214,3 +226,576 @@ TEST_CASE("assign_dotend", "mam4_convproc_process") {
     }
   }
 }
+TEST_CASE("species_parallel_transport", "mam4_convproc_process") {
+  // the vertical sweeps spread over the species on the threads of a team give
+  // the same mixing ratios and tendencies as the sweeps on a single thread
+  const int nlev = mam4::nlev;
+  const int pcnst_extd = mam4::ConvProc::pcnst_extd;
+  const int ktop = 47, kbot = nlev - 1;
+  using View2D = Kokkos::View<Real * [pcnst_extd], mam4::convproc::WorkLayout>;
+  View2D gath("gath", nlev), chat("chat", nlev + 1), conu("conu", nlev + 1),
+      dconudt("dconudt", nlev + 1);
+  View2D cond_serial("cond_serial", nlev + 1),
+      cond_team("cond_team", nlev + 1);
+  View2D dcondt_serial("dcondt_serial", nlev),
+      dcondt_team("dcondt_team", nlev);
+  ColumnView mu = testing::create_column_view(nlev + 1);
+  ColumnView md = testing::create_column_view(nlev + 1);
+  ColumnView dp = testing::create_column_view(nlev);
+  ColumnView fa_u = testing::create_column_view(nlev);
+  ColumnView eudp = testing::create_column_view(nlev);
+  ColumnView eddp = testing::create_column_view(nlev);
+  Kokkos::parallel_for(
+      1, KOKKOS_LAMBDA(const int) {
+        for (int k = 0; k < nlev + 1; ++k) {
+          mu(k) = 0.01 * (k % 7);
+          md(k) = -0.02 * (k % 5);
+          for (int i = 0; i < pcnst_extd; ++i) {
+            chat(k, i) = conu(k, i) = 1.0e-9 * (1 + (k + i) % 11);
+            dconudt(k, i) = 1.0e-12 * (i % 3);
+            cond_serial(k, i) = cond_team(k, i) = 2.0e-9 * (1 + (k * i) % 13);
+            if (k < nlev)
+              gath(k, i) = 1.5e-9 * (1 + (k + 2 * i) % 17);
+          }
+          if (k < nlev) {
+            dp(k) = 10 + k % 3;
+            fa_u(k) = 0.01 * (1 + k % 4);
+            eudp(k) = 0.003 * (k % 2);
+            eddp(k) = 0.004 * (k % 3);
+          }
+        }
+      });
+
+  Kokkos::parallel_for(
+      1, KOKKOS_LAMBDA(const int) {
+        bool doconvproc_extd[pcnst_extd];
+        for (int i = 0; i < pcnst_extd; ++i)
+          doconvproc_extd[i] = (i % 3 != 0);
+        mam4::convproc::compute_downdraft_mixing_ratio(
+            doconvproc_extd, ktop, kbot, md.data(), eddp.data(), gath,
+            cond_serial);
+        mam4::convproc::initialize_dcondt(
+            doconvproc_extd, 1, ktop, kbot, nlev, dp.data(), fa_u.data(),
+            mu.data(), md.data(), chat, gath, conu, cond_serial, dconudt,
+            dconudt, eudp.data(), eddp.data(), eudp.data(), eddp.data(),
+            dcondt_serial);
+      });
+  run_on_team(KOKKOS_LAMBDA(const ThreadTeam &team) {
+    bool doconvproc_extd[pcnst_extd];
+    for (int i = 0; i < pcnst_extd; ++i)
+      doconvproc_extd[i] = (i % 3 != 0);
+    mam4::ConvProc::SpeciesLists species;
+    species.set(doconvproc_extd, pcnst_extd);
+    mam4::convproc::compute_downdraft_mixing_ratio(
+        team, species, ktop, kbot, md.data(), eddp.data(), gath, cond_team);
+    team.team_barrier();
+    mam4::convproc::initialize_dcondt(
+        team, species, 1, ktop, kbot, nlev, dp.data(), fa_u.data(), mu.data(),
+        md.data(), chat, gath, conu, cond_team, dconudt, dconudt, eudp.data(),
+        eddp.data(), eudp.data(), eddp.data(), dcondt_team);
+  });
+
+  const auto h_cond_serial =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), cond_serial);
+  const auto h_cond_team =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), cond_team);
+  const auto h_dcondt_serial =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dcondt_serial);
+  const auto h_dcondt_team =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dcondt_team);
+  for (int k = 0; k < nlev; ++k) {
+    for (int i = 0; i < pcnst_extd; ++i) {
+      REQUIRE(h_cond_team(k + 1, i) == h_cond_serial(k + 1, i));
+      REQUIRE(h_dcondt_team(k, i) == h_dcondt_serial(k, i));
+    }
+  }
+}
+
+TEST_CASE("species_parallel_updraft", "mam4_convproc_process") {
+  // the updraft sweep spread over the species on the threads of a team gives
+  // the same mixing ratios, tendencies and cloud base as on a single thread
+  const int nlev = mam4::nlev;
+  const int gas_pcnst = mam4::ConvProc::gas_pcnst;
+  const int pcnst_extd = mam4::ConvProc::pcnst_extd;
+  const int ktop = 47, kbot = nlev - 1;
+  const Real dt = 3600, dz = 100;
+  using View2D = Kokkos::View<Real * [pcnst_extd], mam4::convproc::WorkLayout>;
+  View2D gath("gath", nlev);
+  View2D conu_serial("conu_serial", nlev + 1), conu_team("conu_team", nlev + 1);
+  View2D wetdep_serial("wetdep_serial", nlev + 1),
+      wetdep_team("wetdep_team", nlev + 1);
+  View2D activa_serial("activa_serial", nlev + 1),
+      activa_team("activa_team", nlev + 1);
+  ColumnView mu = testing::create_column_view(nlev + 1);
+  ColumnView dp = testing::create_column_view(nlev);
+  ColumnView cldfrac = testing::create_column_view(nlev);
+  ColumnView rhoair = testing::create_column_view(nlev);
+  ColumnView zmagl = testing::create_column_view(nlev);
+  ColumnView eudp = testing::create_column_view(nlev);
+  ColumnView temperature = testing::create_column_view(nlev);
+  ColumnView icwmr = testing::create_column_view(nlev);
+  ColumnView rprd = testing::create_column_view(nlev);
+  ColumnView fa_u_serial = testing::create_column_view(nlev);
+  ColumnView fa_u_team = testing::create_column_view(nlev);
+  Kokkos::View<Real[2]> wcldbase("wcldbase");
+  Kokkos::View<int[2]> kcldbase("kcldbase");
+  Kokkos::parallel_for(
+      1, KOKKOS_LAMBDA(const int) {
+        // aerosol numbers [#/kg] are much larger than mass mixing ratios
+        Real scale[pcnst_extd];
+        for (int i = 0; i < pcnst_extd; ++i)
+          scale[i] = 1.0e-9;
+        for (int imode = 0; imode < mam4::AeroConfig::num_modes(); ++imode) {
+          int la, lc;
+          mam4::convproc::assign_la_lc(imode, -1, la, lc);
+          scale[la] = scale[lc] = 1.0e8;
+        }
+        for (int k = 0; k < nlev + 1; ++k) {
+          mu(k) = 0.02 + 0.01 * (k % 5);
+          for (int i = 0; i < pcnst_extd; ++i) {
+            conu_serial(k, i) = conu_team(k, i) =
+                scale[i] * (1 + (k + i) % 11);
+            if (k < nlev)
+              gath(k, i) = 1.5 * scale[i] * (1 + (k + 2 * i) % 17);
+          }
+          if (k < nlev) {
+            dp(k) = 10 + k % 3;
+            cldfrac(k) = 0.1 + 0.05 * (k % 4);
+            rhoair(k) = 1.0 - 0.005 * k;
+            zmagl(k) = 100.0 * (nlev - k);
+            eudp(k) = 0.002 * (k % 3);
+            temperature(k) = 280 - 0.5 * (nlev - k);
+            icwmr(k) = 1.0e-4 * (1 + k % 3);
+            rprd(k) = 1.0e-7 * (k % 5);
+          }
+        }
+      });
+
+  // transport the aerosols, as with the default configuration
+  const mam4::ConvProc::Config config;
+  Kokkos::parallel_for(
+      1, KOKKOS_LAMBDA(const int) {
+        bool doconvproc[gas_pcnst];
+        for (int i = 0; i < gas_pcnst; ++i)
+          doconvproc[i] = config.species_class[i] ==
+                          mam4::ConvProc::species_class::aerosol;
+        Real aqfrac[pcnst_extd];
+        bool doconvproc_extd[pcnst_extd];
+        mam4::convproc::set_cloudborne_vars(doconvproc, aqfrac,
+                                            doconvproc_extd);
+        mam4::convproc::compute_updraft_mixing_ratio(
+            doconvproc_extd, nlev, ktop, kbot, 1, dt, dp.data(), dp.data(),
+            cldfrac.data(), rhoair.data(), zmagl.data(), dz, mu.data(),
+            eudp.data(), gath, temperature.data(), aqfrac, icwmr.data(),
+            rprd.data(), fa_u_serial.data(), wetdep_serial, activa_serial,
+            conu_serial, wcldbase(0), kcldbase(0));
+      });
+  run_on_team(KOKKOS_LAMBDA(const ThreadTeam &team) {
+    bool doconvproc[gas_pcnst];
+    for (int i = 0; i < gas_pcnst; ++i)
+      doconvproc[i] =
+          config.species_class[i] == mam4::ConvProc::species_class::aerosol;
+    Real aqfrac[pcnst_extd];
+    bool doconvproc_extd[pcnst_extd];
+    mam4::convproc::set_cloudborne_vars(doconvproc, aqfrac, doconvproc_extd);
+    mam4::ConvProc::SpeciesLists species;
+    species.set(doconvproc_extd, pcnst_extd);
+    Real xx_wcldbase = 0;
+    int xx_kcldbase = 0;
+    mam4::convproc::compute_updraft_mixing_ratio(
+        team, species, nlev, ktop, kbot, 1, dt, dp.data(), dp.data(),
+        cldfrac.data(), rhoair.data(), zmagl.data(), dz, mu.data(),
+        eudp.data(), gath, temperature.data(), aqfrac, icwmr.data(),
+        rprd.data(), fa_u_team.data(), wetdep_team, activa_team, conu_team,
+        xx_wcldbase, xx_kcldbase);
+    Kokkos::single(Kokkos::PerTeam(team), [&]() {
+      wcldbase(1) = xx_wcldbase;
+      kcldbase(1) = xx_kcldbase;
+    });
+  });
+
+  const auto h_conu_serial =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), conu_serial);
+  const auto h_conu_team =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), conu_team);
+  const auto h_wetdep_serial =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), wetdep_serial);
+  const auto h_wetdep_team =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), wetdep_team);
+  const auto h_activa_serial =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), activa_serial);
+  const auto h_activa_team =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), activa_team);
+  const auto h_fa_u_serial =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), fa_u_serial);
+  const auto h_fa_u_team =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), fa_u_team);
+  const auto h_wcldbase =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), wcldbase);
+  const auto h_kcldbase =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), kcldbase);
+  // the sweep removes and activates aerosols below the cloud top
+  Real wetdep_sum = 0, activa_sum = 0;
+  for (int k = 0; k < nlev + 1; ++k) {
+    for (int i = 0; i < pcnst_extd; ++i) {
+      REQUIRE(h_conu_team(k, i) == h_conu_serial(k, i));
+      REQUIRE(h_wetdep_team(k, i) == h_wetdep_serial(k, i));
+      REQUIRE(h_activa_team(k, i) == h_activa_serial(k, i));
+      wetdep_sum += haero::abs(h_wetdep_serial(k, i));
+      activa_sum += haero::abs(h_activa_serial(k, i));
+    }
+    if (k < nlev)
+      REQUIRE(h_fa_u_team(k) == h_fa_u_serial(k));
+  }
+  REQUIRE(wetdep_sum > 0);
+  REQUIRE(activa_sum > 0);
+  REQUIRE(h_wcldbase(1) == h_wcldbase(0));
+  REQUIRE(h_kcldbase(1) == h_kcldbase(0));
+}
+
+namespace {
+
+// creates the scratch views used by ma_convproc_tend, each large enough for
+// any of them
+void create_scratch(
+    const int nlev,
+    Kokkos::View<Real *> scratch[mam4::ConvProc::Col1DViewInd::NumScratch]) {
+  const int size = (1 + nlev) * mam4::ConvProc::pcnst_extd;
+  for (int i = 0; i < mam4::ConvProc::Col1DViewInd::NumScratch; ++i)
+    scratch[i] = Kokkos::View<Real *>("convproc_scratch", size);
+}
+
+// transports a deep convective column with the given entrainment and
+// detrainment rates on a single thread and on the threads of a team, and checks
+// that both give the same tendencies, column fluxes and cloud properties
+void check_team_tend(const int ktop, const int kbot, ColumnView du,
+                     ColumnView eu, ColumnView ed) {
+  const int nlev = mam4::nlev;
+  const int gas_pcnst = mam4::ConvProc::gas_pcnst;
+  const int nsrflx = mam4::convproc::nsrflx;
+  const Real dt = 3600;
+  using TracerView = Kokkos::View<Real * [gas_pcnst]>;
+  TracerView qnew("qnew", nlev), dqdt_serial("dqdt_serial", nlev),
+      dqdt_team("dqdt_team", nlev);
+  Kokkos::View<Real[2][gas_pcnst][nsrflx]> qsrflx("qsrflx");
+  Kokkos::View<Real[2][2]> cloud("cloud"); // mfup_max and wcldbase
+  Kokkos::View<int[2]> kcldbase("kcldbase");
+  ColumnView temperature = testing::create_column_view(nlev);
+  ColumnView pmid = testing::create_column_view(nlev);
+  ColumnView dp = testing::create_column_view(nlev);
+  ColumnView cldfrac = testing::create_column_view(nlev);
+  ColumnView icwmr = testing::create_column_view(nlev);
+  ColumnView rprd = testing::create_column_view(nlev);
+  ColumnView evapc = testing::create_column_view(nlev);
+  Kokkos::parallel_for(
+      1, KOKKOS_LAMBDA(const int) {
+        for (int k = 0; k < nlev; ++k) {
+          temperature(k) = 280 - 0.5 * (nlev - k);
+          pmid(k) = 1.0e5 * (k + 1) / nlev;
+          dp(k) = 10 + k % 3;
+          cldfrac(k) = 0.1 + 0.05 * (k % 4);
+          icwmr(k) = 1.0e-4 * (1 + k % 3);
+          rprd(k) = 1.0e-7 * (k % 5);
+          evapc(k) = 1.0e-8 * (k % 2);
+          for (int i = 0; i < gas_pcnst; ++i)
+            qnew(k, i) = 1.0e-9 * (1 + (k + i) % 13);
+        }
+      });
+
+  Kokkos::View<Real *> scratch_serial[mam4::ConvProc::Col1DViewInd::NumScratch],
+      scratch_team[mam4::ConvProc::Col1DViewInd::NumScratch];
+  create_scratch(nlev, scratch_serial);
+  create_scratch(nlev, scratch_team);
+
+  // transport the aerosols, as with the default configuration
+  const mam4::ConvProc::Config config;
+  Kokkos::parallel_for(
+      1, KOKKOS_LAMBDA(const int) {
+        bool doconvproc[gas_pcnst];
+        for (int i = 0; i < gas_pcnst; ++i)
+          doconvproc[i] = config.species_class[i] ==
+                          mam4::ConvProc::species_class::aerosol;
+        Real xx_qsrflx[gas_pcnst][nsrflx];
+        int xx_kcldbase = 0;
+        mam4::convproc::ma_convproc_tend(
+            scratch_serial, nlev, mam4::ConvProc::Deep, dt,
+            temperature.data(), pmid.data(), qnew, du.data(), eu.data(),
+            ed.data(), dp.data(), dp.data(), ktop, kbot,
+            config.mmtoo_prevap_resusp, cldfrac.data(), icwmr.data(),
+            rprd.data(), evapc.data(), dqdt_serial, doconvproc, xx_qsrflx,
+            config.species_class, cloud(0, 0), cloud(0, 1), xx_kcldbase);
+        kcldbase(0) = xx_kcldbase;
+        for (int i = 0; i < gas_pcnst; ++i)
+          for (int j = 0; j < nsrflx; ++j)
+            qsrflx(0, i, j) = xx_qsrflx[i][j];
+      });
+  run_on_team(KOKKOS_LAMBDA(const ThreadTeam &team) {
+    bool doconvproc[gas_pcnst];
+    for (int i = 0; i < gas_pcnst; ++i)
+      doconvproc[i] =
+          config.species_class[i] == mam4::ConvProc::species_class::aerosol;
+    Real aqfrac[mam4::ConvProc::pcnst_extd];
+    bool doconvproc_extd[mam4::ConvProc::pcnst_extd];
+    mam4::convproc::set_cloudborne_vars(doconvproc, aqfrac, doconvproc_extd);
+    mam4::ConvProc::SpeciesLists species;
+    species.set(doconvproc_extd, mam4::ConvProc::pcnst_extd);
+    Real xx_qsrflx[gas_pcnst][nsrflx];
+    Real xx_mfup_max = 0, xx_wcldbase = 0;
+    int xx_kcldbase = 0;
+    mam4::convproc::ma_convproc_tend(
+        team, scratch_team, nlev, mam4::ConvProc::Deep, dt,
+        temperature.data(), pmid.data(), qnew, du.data(), eu.data(), ed.data(),
+        dp.data(), dp.data(), ktop, kbot, config.mmtoo_prevap_resusp,
+        cldfrac.data(), icwmr.data(), rprd.data(), evapc.data(), dqdt_team,
+        doconvproc, species, xx_qsrflx, config.species_class, xx_mfup_max,
+        xx_wcldbase, xx_kcldbase);
+    Kokkos::single(Kokkos::PerTeam(team), [&]() {
+      cloud(1, 0) = xx_mfup_max;
+      cloud(1, 1) = xx_wcldbase;
+      kcldbase(1) = xx_kcldbase;
+      for (int i = 0; i < gas_pcnst; ++i)
+        for (int j = 0; j < nsrflx; ++j)
+          qsrflx(1, i, j) = xx_qsrflx[i][j];
+    });
+  });
+
+  const auto h_dqdt_serial =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dqdt_serial);
+  const auto h_dqdt_team =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dqdt_team);
+  const auto h_qsrflx =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), qsrflx);
+  const auto h_cloud =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), cloud);
+  const auto h_kcldbase =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), kcldbase);
+  // the aerosols are transported in the convective layers
+  Real dqdt_sum = 0;
+  for (int k = 0; k < nlev; ++k) {
+    for (int i = 0; i < gas_pcnst; ++i) {
+      REQUIRE(h_dqdt_team(k, i) == h_dqdt_serial(k, i));
+      dqdt_sum += haero::abs(h_dqdt_serial(k, i));
+    }
+  }
+  REQUIRE(dqdt_sum > 0);
+  for (int i = 0; i < gas_pcnst; ++i) {
+    for (int j = 0; j < nsrflx; ++j)
+      REQUIRE(h_qsrflx(1, i, j) == h_qsrflx(0, i, j));
+  }
+  REQUIRE(h_cloud(0, 0) > 0);
+  REQUIRE(h_cloud(1, 0) == h_cloud(0, 0));
+  REQUIRE(h_cloud(1, 1) == h_cloud(0, 1));
+  REQUIRE(h_kcldbase(1) == h_kcldbase(0));
+}
+
+} // namespace
+
+TEST_CASE("species_parallel_tend", "mam4_convproc_process") {
+  // the convective transport of a column by the threads of a team gives the
+  // same tendencies, column fluxes and cloud properties as on a single thread
+  const int nlev = mam4::nlev;
+  const int ktop = 47, kbot = nlev - 1;
+  ColumnView du = testing::create_column_view(nlev);
+  ColumnView eu = testing::create_column_view(nlev);
+  ColumnView ed = testing::create_column_view(nlev);
+  Kokkos::parallel_for(
+      1, KOKKOS_LAMBDA(const int) {
+        for (int k = 0; k < nlev; ++k) {
+          const bool convective = ktop <= k && k < kbot;
+          eu(k) = convective ? 1.0e-4 * (1 + k % 3) : 0;
+          du(k) = convective ? 5.0e-5 * (k % 2) : 0;
+          ed(k) = convective ? -2.0e-5 * (k % 4) : 0;
+        }
+      });
+  check_team_tend(ktop, kbot, du, eu, ed);
+}
+
+TEST_CASE("entraining_layers_without_mass_flux", "mam4_convproc_process") {
+  // layers below the updraft base that entrain as much as they detrain have no
+  // mass flux at their interfaces, but stay in the layers swept by the team
+  // (narrowed to those with mass fluxes), which then matches the single thread
+  // (which sweeps from ktop to kbot)
+  const int nlev = mam4::nlev;
+  const int ktop = 47, kbot = nlev - 1, kbase = 60;
+  ColumnView du = testing::create_column_view(nlev);
+  ColumnView eu = testing::create_column_view(nlev);
+  ColumnView ed = testing::create_column_view(nlev);
+  ColumnView mu = testing::create_column_view(nlev + 1);
+  ColumnView md = testing::create_column_view(nlev + 1);
+  ColumnView dpdry = testing::create_column_view(nlev);
+  Kokkos::View<int[2]> range("range");
+  Kokkos::parallel_for(
+      1, KOKKOS_LAMBDA(const int) {
+        for (int k = 0; k < nlev; ++k) {
+          dpdry(k) = 10 + k % 3;
+          if (ktop <= k && k < kbase) {
+            eu(k) = 1.0e-4 * (1 + k % 3);
+            du(k) = 5.0e-5 * (k % 2);
+          } else if (kbase <= k && k < kbot) {
+            eu(k) = du(k) = 1.0e-4;
+          }
+        }
+        Real mfup_max = 0;
+        mam4::convproc::compute_massflux(nlev, ktop, kbot, dpdry.data(),
+                                         du.data(), eu.data(), ed.data(),
+                                         mu.data(), md.data(), mfup_max);
+        int kt = ktop, kb = kbot;
+        mam4::convproc::mass_flux_layers(mu.data(), md.data(), du.data(),
+                                         eu.data(), ed.data(), kt, kb);
+        range(0) = kt;
+        range(1) = kb;
+      });
+  const auto h_mu =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), mu);
+  const auto h_range =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), range);
+  for (int k = kbase; k <= kbot; ++k)
+    REQUIRE(h_mu(k) == 0);
+  REQUIRE(h_mu(kbase - 1) > 0);
+  REQUIRE(h_range(1) == kbot);
+  check_team_tend(ktop, kbot, du, eu, ed);
+}
+
+TEST_CASE("convection_free_columns", "mam4_convproc_process") {
+  // columns without mass fluxes or shallow clouds are classified as such, and
+  // the layers with mass fluxes are narrowed to those with nonzero fluxes
+  const int nlev = mam4::nlev;
+  const int ktop = 47, kbot = nlev - 1;
+  ColumnView eu = testing::create_column_view(nlev);
+  ColumnView du = testing::create_column_view(nlev);
+  ColumnView ed = testing::create_column_view(nlev);
+  ColumnView sh_frac = testing::create_column_view(nlev);
+  ColumnView mu = testing::create_column_view(nlev + 1);
+  ColumnView md = testing::create_column_view(nlev + 1);
+  Kokkos::View<int[6]> results("results");
+  haero::DeviceType::view_1d<int> num_skipped_columns(
+      "num_skipped_columns", mam4::Diagnostics::num_skipped_column_counters);
+  Kokkos::parallel_for(
+      ThreadTeamPolicy(1, Kokkos::AUTO),
+      KOKKOS_LAMBDA(const ThreadTeam &team) {
+        // no convection at all
+        const bool deep = mam4::convproc::has_deep_convection(
+            team, nlev, eu.data(), du.data(), ed.data());
+        const bool shallow = mam4::convproc::has_shallow_convection(
+            team, nlev, sh_frac.data());
+        if (!deep)
+          mam4::utils::add_to_counter(
+              team, num_skipped_columns,
+              mam4::Diagnostics::convproc_deep_skipped_columns, 1);
+        team.team_barrier();
+        Kokkos::single(Kokkos::PerTeam(team), [&]() {
+          results(0) = deep;
+          results(1) = shallow;
+          // mass fluxes from layer 55 to layer 60
+          eu(60) = 1.0e-3;
+          sh_frac(30) = 0.1;
+          for (int k = 56; k <= 60; ++k)
+            mu(k) = 0.01;
+          md(60) = -0.005;
+        });
+        team.team_barrier();
+        results(2) = mam4::convproc::has_deep_convection(
+            team, nlev, eu.data(), du.data(), ed.data());
+        results(3) = mam4::convproc::has_shallow_convection(
+            team, nlev, sh_frac.data());
+        Kokkos::single(Kokkos::PerTeam(team), [&]() {
+          int kt = ktop, kb = kbot;
+          mam4::convproc::mass_flux_layers(mu.data(), md.data(), du.data(),
+                                           eu.data(), ed.data(), kt, kb);
+          results(4) = kt;
+          results(5) = kb;
+        });
+      });
+  const auto h_results =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), results);
+  REQUIRE(!h_results(0));
+  REQUIRE(!h_results(1));
+  REQUIRE(h_results(2));
+  REQUIRE(h_results(3));
+  REQUIRE(h_results(4) == 55);
+  REQUIRE(h_results(5) == 61);
+  const auto h_skipped = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), num_skipped_columns);
+  REQUIRE(h_skipped(mam4::Diagnostics::convproc_deep_skipped_columns) == 1);
+  REQUIRE(h_skipped(mam4::Diagnostics::convproc_shallow_skipped_columns) == 0);
+
+  // without mass fluxes, entrainment or detrainment, the range is empty
+  Kokkos::deep_copy(mu, 0);
+  Kokkos::deep_copy(md, 0);
+  Kokkos::deep_copy(eu, 0);
+  Kokkos::parallel_for(
+      1, KOKKOS_LAMBDA(const int) {
+        int kt = ktop, kb = kbot;
+        mam4::convproc::mass_flux_layers(mu.data(), md.data(), du.data(),
+                                         eu.data(), ed.data(), kt, kb);
+        results(4) = kt;
+        results(5) = kb;
+      });
+  Kokkos::deep_copy(h_results, results);
+  REQUIRE(h_results(4) == h_results(5));
+}
+
+TEST_CASE("species_lists", "mam4_convproc_process") {
+  // the lists hold the transported species in ascending order, with the
+  // interstitial ones first
+  const int gas_pcnst = mam4::ConvProc::gas_pcnst;
+  const int pcnst_extd = mam4::ConvProc::pcnst_extd;
+  const mam4::ConvProc::Config config;
+  Kokkos::View<int[pcnst_extd + 2]> lists("lists");
+  Kokkos::parallel_for(
+      1, KOKKOS_LAMBDA(const int) {
+        int species_class[gas_pcnst];
+        for (int i = 0; i < gas_pcnst; ++i)
+          species_class[i] = config.species_class[i];
+        mam4::ConvProc::SpeciesLists species;
+        mam4::convproc::set_species_lists(species_class, true, false, species);
+        lists(0) = species.num_extd;
+        lists(1) = species.num_interstitial;
+        for (int i = 0; i < species.num_extd; ++i)
+          lists(2 + i) = species.extd[i];
+      });
+  const auto h_lists =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), lists);
+  const int num_extd = h_lists(0), num_interstitial = h_lists(1);
+
+  // the aerosols and their cloudborne partners
+  int num_aerosols = 0;
+  for (int i = 0; i < gas_pcnst; ++i)
+    if (config.species_class[i] == mam4::ConvProc::species_class::aerosol)
+      ++num_aerosols;
+  REQUIRE(num_interstitial == num_aerosols);
+  REQUIRE(num_extd == 2 * num_aerosols);
+  for (int i = 0; i < num_extd; ++i) {
+    const int icnst = h_lists(2 + i);
+    if (i > 0) {
+      REQUIRE(h_lists(1 + i) < icnst);
+    }
+    REQUIRE((icnst < gas_pcnst) == (i < num_interstitial));
+    REQUIRE(config.species_class[icnst % gas_pcnst] ==
+            mam4::ConvProc::species_class::aerosol);
+  }
+}
+
+TEST_CASE("work_array_layout", "mam4_convproc_process") {
+  // the work arrays keep the levels of each species contiguous in the
+  // species-major layout, and the species of each level otherwise
+  const int nlev = mam4::nlev;
+  const int pcnst_extd = mam4::ConvProc::pcnst_extd;
+  ColumnView buffer = testing::create_column_view(nlev * pcnst_extd);
+  Kokkos::View<int[2]> offsets("offsets");
+  Kokkos::parallel_for(
+      1, KOKKOS_LAMBDA(const int) {
+        mam4::convproc::Kokkos_2D_View work(buffer.data(), nlev, pcnst_extd);
+        offsets(0) = static_cast<int>(&work(1, 0) - &work(0, 0));
+        offsets(1) = static_cast<int>(&work(0, 1) - &work(0, 0));
+      });
+  const auto h_offsets =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), offsets);
+  if (mam4::convproc_species_major) {
+    REQUIRE(h_offsets(0) == 1);
+    REQUIRE(h_offsets(1) == nlev);
+  } else {
+    REQUIRE(h_offsets(0) == pcnst_extd);
+    REQUIRE(h_offsets(1) == 1);
+  }
+}
@@ -0,0 +1,148 @@
+// mam4xx: Copyright (c) 2022,
+// Battelle Memorial Institute and
+// National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "atmosphere_utils.hpp"
+#include "testing.hpp"
+#include <mam4xx/mam4.hpp>
+
+#include <ekat/ekat_type_traits.hpp>
+#include <ekat/logging/ekat_logger.hpp>
+#include <ekat/mpi/ekat_comm.hpp>
+
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+
+using namespace haero;
+using namespace mam4;
+
+TEST_CASE("test_constructor", "mam4_drydep_process") {
+  mam4::AeroConfig mam4_config;
+  mam4::DryDepProcess process(mam4_config);
+  REQUIRE(process.name() == "MAM4 dry deposition");
+  REQUIRE(process.aero_config() == mam4_config);
+}
+
+TEST_CASE("test_deposition_velocity", "mam4_drydep_process") {
+  const Real temp = 288.0, pres = 1.0e5;
+  const Real radius = 0.1e-6, density = 1770.0, sig = 1.8;
+  Real fraction_landuse[DryDep::n_land_type] = {};
+
+  // no surface types, no deposition
+  REQUIRE(drydep::particle_deposition_velocity(temp, pres, radius, density, sig,
+                                               fraction_landuse, 30.0,
+                                               0.4) == 0.0);
+
+  // without turbulence, particles deposit with their settling velocity
+  fraction_landuse[6] = 1.0;
+  const Real vsc_dyn_atm = drydep::air_dynamic_viscosity(temp);
+  const Real slp_crc =
+      drydep::slip_correction_factor(vsc_dyn_atm, pres, temp, radius);
+  const Real vlc_grv = drydep::gravit_settling_velocity(
+      radius, density, slp_crc, vsc_dyn_atm, sig);
+  REQUIRE(drydep::particle_deposition_velocity(temp, pres, radius, density,
+                                               sig, fraction_landuse, 30.0,
+                                               0.0) == Approx(vlc_grv));
+
+  // turbulence adds deposition, bounded by the aerodynamic resistance
+  const Real vlc_dry = drydep::particle_deposition_velocity(
+      temp, pres, radius, density, sig, fraction_landuse, 30.0, 0.4);
+  REQUIRE(vlc_dry > vlc_grv);
+  REQUIRE(vlc_dry < vlc_grv + 1.0 / 30.0);
+}
+
+TEST_CASE("test_compute_tendencies", "mam4_drydep_process") {
+  ekat::Comm comm;
+  ekat::logger::Logger<> logger("drydep unit tests",
+                                ekat::logger::LogLevel::debug, comm);
+
+  const int nlev = mam4::nlev;
+  const int num_modes = AeroConfig::num_modes();
+  const Real pblh = 1000;
+  Atmosphere atm = init_atm_const_tv_lapse_rate(nlev, pblh);
+  Surface sfc = mam4::testing::create_surface();
+  mam4::Prognostics progs = mam4::testing::create_prognostics(nlev);
+  mam4::Diagnostics diags = mam4::testing::create_diagnostics(nlev);
+  mam4::Tendencies tends = mam4::testing::create_tendencies(nlev);
+
+  // aerosols of all modes in the whole column, and surface properties
+  const Real dgn[num_modes] = {1.0e-7, 3.0e-8, 2.0e-6, 5.0e-8};
+  for (int m = 0; m < num_modes; ++m) {
+    Kokkos::deep_copy(diags.wet_geometric_mean_diameter_i[m], dgn[m]);
+    Kokkos::deep_copy(diags.wet_density[m], 1500.0);
+    Kokkos::deep_copy(progs.n_mode_i[m], 1.0e8);
+    Kokkos::deep_copy(progs.n_mode_c[m], 1.0e7);
+    for (int s = 0; s < num_species_mode(m); ++s) {
+      Kokkos::deep_copy(progs.q_aero_i[m][s], 1.0e-9);
+      Kokkos::deep_copy(progs.q_aero_c[m][s], 1.0e-10);
+    }
+  }
+  auto h_fraction_landuse = Kokkos::create_mirror_view(diags.fraction_landuse);
+  h_fraction_landuse(1) = 0.6;
+  h_fraction_landuse(6) = 0.4;
+  Kokkos::deep_copy(diags.fraction_landuse, h_fraction_landuse);
+  Kokkos::deep_copy(diags.aerodynamic_resistance, 30.0);
+  Kokkos::deep_copy(diags.friction_velocity, 0.4);
+
+  mam4::AeroConfig mam4_config;
+  mam4::DryDepProcess process(mam4_config);
+
+  // a time step far beyond the settling CFL limit of the coarse mode
+  auto team_policy = ThreadTeamPolicy(1u, Kokkos::AUTO);
+  Real t = 0.0, dt = 86400.0;
+  Kokkos::parallel_for(
+      team_policy, KOKKOS_LAMBDA(const ThreadTeam &team) {
+        process.compute_tendencies(team, t, dt, atm, sfc, progs, diags, tends);
+      });
+
+  auto h_pdel = Kokkos::create_mirror_view(atm.hydrostatic_dp);
+  Kokkos::deep_copy(h_pdel, atm.hydrostatic_dp);
+  auto h_flux_i = Kokkos::create_mirror_view(diags.dry_deposition_flux_i);
+  auto h_flux_c = Kokkos::create_mirror_view(diags.dry_deposition_flux_c);
+  Kokkos::deep_copy(h_flux_i, diags.dry_deposition_flux_i);
+  Kokkos::deep_copy(h_flux_c, diags.dry_deposition_flux_c);
+
+  // For every tracer, the updated mixing ratios are non-negative and the
+  // change in the column burden equals the surface deposition.
+  auto check_tracer = [&](const ColumnView q, const ColumnView dqdt,
+                          const Real sfc_flux) {
+    auto h_q = Kokkos::create_mirror_view(q);
+    auto h_dqdt = Kokkos::create_mirror_view(dqdt);
+    Kokkos::deep_copy(h_q, q);
+    Kokkos::deep_copy(h_dqdt, dqdt);
+    Real burden = 0.0, burden_change = 0.0;
+    for (int k = 0; k < nlev; ++k) {
+      REQUIRE(!std::isnan(h_dqdt(k)));
+      REQUIRE(h_q(k) + dt * h_dqdt(k) >= 0.0);
+      burden += h_q(k) * h_pdel(k) / Constants::gravity;
+      burden_change += dt * h_dqdt(k) * h_pdel(k) / Constants::gravity;
+    }
+    REQUIRE(sfc_flux > 0.0);
+    REQUIRE(dt * sfc_flux <= burden);
+    REQUIRE(burden_change == Approx(-dt * sfc_flux).epsilon(1.0e-10));
+  };
+  for (int m = 0; m < num_modes; ++m) {
+    logger.debug("mode {}: number deposition flux {} (interstitial), {} "
+                 "(cloud-borne) [#/m2/s]",
+                 m, h_flux_i(m, 0), h_flux_c(m, 0));
+    check_tracer(progs.n_mode_i[m], tends.n_mode_i[m], h_flux_i(m, 0));
+    check_tracer(progs.n_mode_c[m], tends.n_mode_c[m], h_flux_c(m, 0));
+    for (int s = 0; s < num_species_mode(m); ++s) {
+      check_tracer(progs.q_aero_i[m][s], tends.q_aero_i[m][s],
+                   h_flux_i(m, 1 + s));
+      check_tracer(progs.q_aero_c[m][s], tends.q_aero_c[m][s],
+                   h_flux_c(m, 1 + s));
+    }
+  }
+
+  // coarse particles settle faster than accumulation-mode particles (both
+  // modes start with the same number mixing ratio)
+  const int iacc = static_cast<int>(ModeIndex::Accumulation);
+  const int icoa = static_cast<int>(ModeIndex::Coarse);
+  REQUIRE(h_flux_i(icoa, 0) > h_flux_i(iacc, 0));
+}
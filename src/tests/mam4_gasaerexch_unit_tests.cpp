@@ -3,6 +3,7 @@
 // National Technology & Engineering Solutions of Sandia, LLC (NTESS)
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include "atmosphere_utils.hpp"
 #include "testing.hpp"
 #include <mam4xx/aero_modes.hpp>
 #include <mam4xx/mam4.hpp>
@@ -12,6 +13,7 @@
 #include <ekat/mpi/ekat_comm.hpp>
 
 #include <catch2/catch.hpp>
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
 #include <iostream>
@@ -93,6 +95,54 @@ TEST_CASE("test_multicol_compute_tendencies", "mam4_gasaerexch_process") {
       });
 }
 
+TEST_CASE("test_implicit_soa_substeps", "mam4_gasaerexch_process") {
+  // with the implicit SOA solver, the substep diagnostics count its Newton
+  // iterations
+  const int nlev = 72;
+  const Real pblh = 1000;
+  Atmosphere atm = init_atm_const_tv_lapse_rate(nlev, pblh);
+  Surface sfc = mam4::testing::create_surface();
+  mam4::Prognostics progs = mam4::testing::create_prognostics(nlev);
+  mam4::Diagnostics diags = mam4::testing::create_diagnostics(nlev);
+  mam4::Tendencies tends = mam4::testing::create_tendencies(nlev);
+  Kokkos::deep_copy(progs.q_gas[static_cast<int>(GasId::SOAG)], 2.0e-9);
+  for (int n = 0; n < AeroConfig::num_modes(); ++n) {
+    Kokkos::deep_copy(progs.n_mode_i[n], 1.0e9);
+    Kokkos::deep_copy(diags.wet_geometric_mean_diameter_i[n], 1.0e-7);
+    for (int g = 0; g < AeroConfig::num_aerosol_ids(); ++g)
+      Kokkos::deep_copy(progs.q_aero_i[n][g], 1.0e-10);
+  }
+
+  mam4::AeroConfig mam4_config;
+  mam4::GasAerExchProcess::ProcessConfig process_config;
+  process_config.soa_implicit = true;
+  mam4::GasAerExchProcess process(mam4_config, process_config);
+
+  auto team_policy = ThreadTeamPolicy(1u, Kokkos::AUTO);
+  Real t = 0.0, dt = 3600.0;
+  Kokkos::parallel_for(
+      team_policy, KOKKOS_LAMBDA(const ThreadTeam &team) {
+        process.compute_tendencies(team, t, dt, atm, sfc, progs, diags, tends);
+      });
+
+  const auto h_substeps = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), diags.num_substeps);
+  const auto h_histogram = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), diags.num_substeps_histogram);
+  int expected[Diagnostics::num_substeps_histogram_bins] = {};
+  int max_substeps = 0;
+  for (int k = 0; k < nlev; ++k) {
+    REQUIRE(h_substeps(k) >= 1);
+    REQUIRE(h_substeps(k) <= 20);
+    max_substeps = std::max(max_substeps, h_substeps(k));
+    ++expected[gasaerexch::substeps_histogram_bin(h_substeps(k))];
+  }
+  // the stiff uptake takes more than one Newton iteration
+  REQUIRE(max_substeps > 1);
+  for (int b = 0; b < Diagnostics::num_substeps_histogram_bins; ++b)
+    REQUIRE(h_histogram(b) == expected[b]);
+}
+
 TEST_CASE("gas_aer_uptkrates_1box1gas", "mam_gasaerexch") {
 
   ekat::Comm comm;
@@ -230,6 +280,61 @@ TEST_CASE("gas_aer_uptkrates_1box1gas", "mam_gasaerexch") {
   }
 }
 
+TEST_CASE("gas_aer_uptkrates_quadrature_orders", "mam_gasaerexch") {
+  const int num_mode = mam4::GasAerExch::num_mode;
+  const bool l_condense_to_mode[num_mode] = {true, true, true, true};
+  const Real temp = 273.0, pmid = 100000.0, pstd = 101325.0;
+  const Real mw_h2so4 = 98.0784, mw_air = 28.966;
+  const Real vol_molar_h2so4 = 42.88, vol_molar_air = 20.1;
+  const Real accom_coef_h2so4 = 0.65, r_universal = 8314.467591;
+  const Real r_pi = 3.1415926535897931, beta_inp = 0.0;
+  const Real alnsg_aer[num_mode] = {0.58778666490211906, 0.47000362924573563,
+                                    0.58778666490211906, 0.47000362924573563};
+  const Real dgn_awet[num_mode] = {1.27e-7, 2.98e-8, 2.33e-6, 5.30e-8};
+  const ModeLognormalFactors lnsg_terms(alnsg_aer);
+
+  // reference: the 20-point rule
+  Real uptkaer_20[num_mode] = {};
+  gasaerexch::gas_aer_uptkrates_1box1gas<20>(
+      l_condense_to_mode, temp, pmid, pstd, mw_h2so4, mw_air, vol_molar_h2so4,
+      vol_molar_air, accom_coef_h2so4, r_universal, r_pi, beta_inp, dgn_awet,
+      lnsg_terms, uptkaer_20);
+
+  const int nghqs[5] = {1, 2, 4, 8, 10};
+  // the uptake rate is nearly a power law in D_p, so even low orders are
+  // close to the reference
+  const Real tols[5] = {5.0e-2, 5.0e-3, 1.0e-4, 1.0e-7, 1.0e-7};
+  for (int p = 0; p < 5; ++p) {
+    const int nghq = nghqs[p];
+    REQUIRE(gasaerexch::is_valid_quadrature_order(nghq));
+    // runtime dispatch on precomputed terms and on lnsg agree
+    Real uptkaer[num_mode] = {}, uptkaer_lnsg[num_mode] = {};
+    gasaerexch::gas_aer_uptkrates_1box1gas(
+        l_condense_to_mode, temp, pmid, pstd, mw_h2so4, mw_air,
+        vol_molar_h2so4, vol_molar_air, accom_coef_h2so4, r_universal, r_pi,
+        beta_inp, nghq, dgn_awet, lnsg_terms, uptkaer);
+    gasaerexch::gas_aer_uptkrates_1box1gas(
+        l_condense_to_mode, temp, pmid, pstd, mw_h2so4, mw_air,
+        vol_molar_h2so4, vol_molar_air, accom_coef_h2so4, r_universal, r_pi,
+        beta_inp, nghq, dgn_awet, alnsg_aer, uptkaer_lnsg);
+    // and so do the diameter ratios of the quadrature points set at init
+    ModeLognormalFactors quadrature_terms(alnsg_aer);
+    gasaerexch::set_quadrature_points(nghq, quadrature_terms);
+    REQUIRE(quadrature_terms.num_quadrature_points == nghq);
+    Real uptkaer_ratios[num_mode] = {};
+    gasaerexch::gas_aer_uptkrates_1box1gas(
+        l_condense_to_mode, temp, pmid, pstd, mw_h2so4, mw_air,
+        vol_molar_h2so4, vol_molar_air, accom_coef_h2so4, r_universal, r_pi,
+        beta_inp, nghq, dgn_awet, quadrature_terms, uptkaer_ratios);
+    for (int i = 0; i < num_mode; ++i) {
+      REQUIRE(uptkaer[i] == uptkaer_lnsg[i]);
+      REQUIRE(uptkaer[i] == Approx(uptkaer_20[i]).epsilon(tols[p]));
+      REQUIRE(uptkaer_ratios[i] == Approx(uptkaer[i]).epsilon(1.0e-12));
+    }
+  }
+  REQUIRE(!gasaerexch::is_valid_quadrature_order(3));
+}
+
 TEST_CASE("mam_gasaerexch_1subarea_1gas_nonvolatile", "mam_gasaerexch") {
 
   // Since there does not seem to be a way to extract the internal epsilon
@@ -504,6 +609,7 @@ TEST_CASE("mam_gasaerexch_1subarea", "mam_gasaerexch") {
   Real alnsg_aer[num_mode];
   for (int k = 0; k < num_mode; ++k)
     alnsg_aer[k] = std::log(modes_mean_std_dev[k]);
+  const ModeLognormalFactors lnsg_terms(alnsg_aer);
 
   Real uptkrate_h2so4 = 0;
   int niter_out = 0;
@@ -817,10 +923,10 @@ TEST_CASE("mam_gasaerexch_1subarea", "mam_gasaerexch") {
     gasaerexch::mam_gasaerexch_1subarea(
         nghq, igas_h2so4, igas_nh3, ntot_soamode, gas_to_aer, iaer_so4,
         iaer_pom, l_calc_gas_uptake_coeff, l_gas_condense_to_mode,
-        eqn_and_numerics_category, dt, dtsub_soa_fixed, temp, pmid, aircon,
-        ngas, qgas_cur, qgas_avg, qgas_netprod_otrproc, qaer_cur, qnum_cur,
-        dgn_awet, alnsg_aer, uptk_rate_factor, uptkaer, uptkrate_h2so4,
-        niter_out, g0_soa_out);
+        eqn_and_numerics_category, dt, dtsub_soa_fixed, false, temp, pmid,
+        aircon, ngas, qgas_cur, qgas_avg, qgas_netprod_otrproc, qaer_cur,
+        qnum_cur, dgn_awet, lnsg_terms, uptk_rate_factor, uptkaer,
+        uptkrate_h2so4, niter_out, g0_soa_out);
 
     if (!(qgas_cur[igas_soag] == Approx(out_qgas_cur[n][0]).epsilon(epsilon)))
       std::cout << "qgas_cur != Approx(test_qgas_cur)): "
@@ -888,3 +994,77 @@ TEST_CASE("mam_gasaerexch_1subarea", "mam_gasaerexch") {
     }
   }
 }
+
+TEST_CASE("mam_soaexch_implicit", "mam_gasaerexch") {
+  using namespace gasaerexch;
+  const int num_gas = AeroConfig::num_gas_ids();
+  const int num_mode = AeroConfig::num_modes();
+  const int num_aer = AeroConfig::num_aerosol_ids();
+
+  AeroId gas_to_aer[num_gas] = {};
+  for (int i = 0; i < num_gas; ++i)
+    gas_to_aer[i] = GasAerExch::gas_to_aer(static_cast<GasId>(i));
+  const int ntot_soamode = 4, ntot_soaspec = 1;
+  const GasId soaspec[ntot_soaspec] = {GasId::SOAG};
+  const int igas_soag = static_cast<int>(GasId::SOAG);
+  const int iaer_soa = static_cast<int>(AeroId::SOA);
+
+  // a stiff case: uptake time scales are much shorter than the time step
+  const Real dt = 3600.0;
+  Real uptkaer[num_gas][num_mode] = {};
+  for (int n = 0; n < ntot_soamode; ++n)
+    uptkaer[igas_soag][n] = 1.0e-1 * (n + 1);
+  const Real g0_soa[ntot_soaspec] = {1.0e-10};
+  const Real a_opoa[num_mode] = {1.0e-9, 2.0e-10, 0.0, 5.0e-10};
+  Real qgas_cur[num_gas] = {}, qgas_avg[num_gas] = {};
+  Real qaer_cur[num_aer][num_mode] = {};
+  qgas_cur[igas_soag] = 2.0e-9;
+  for (int n = 0; n < ntot_soamode; ++n)
+    qaer_cur[iaer_soa][n] = 1.0e-10 * n;
+
+  Real tot_old = qgas_cur[igas_soag], a_old[num_mode] = {};
+  for (int n = 0; n < ntot_soamode; ++n) {
+    a_old[n] = qaer_cur[iaer_soa][n];
+    tot_old += a_old[n];
+  }
+
+  int niter = 0;
+  mam_soaexch_implicit(ntot_soamode, ntot_soaspec, soaspec, gas_to_aer, dt, 20,
+                       1.0e-10, uptkaer, g0_soa, qgas_cur, a_opoa, qaer_cur,
+                       qgas_avg, niter);
+
+  // the solution is non-negative and conserves total SOA
+  Real tot_new = qgas_cur[igas_soag];
+  REQUIRE(qgas_cur[igas_soag] >= 0.0);
+  REQUIRE(qgas_avg[igas_soag] >= 0.0);
+  for (int n = 0; n < ntot_soamode; ++n) {
+    REQUIRE(qaer_cur[iaer_soa][n] >= 0.0);
+    tot_new += qaer_cur[iaer_soa][n];
+  }
+  REQUIRE(tot_new == Approx(tot_old).epsilon(1.0e-12));
+  REQUIRE(niter <= 20);
+
+  // each mode satisfies the backward-Euler update
+  //   a - a_old = beta * (g - g0 * a / (a + a_opoa))
+  // or has evaporated completely (mode 2 has no POA and starts undersaturated)
+  for (int n = 0; n < ntot_soamode; ++n) {
+    const Real a = qaer_cur[iaer_soa][n];
+    const Real beta = dt * uptkaer[igas_soag][n];
+    if (a > 0.0) {
+      const Real g_eq = g0_soa[0] * a / (a + a_opoa[n]);
+      REQUIRE(a - a_old[n] ==
+              Approx(beta * (qgas_cur[igas_soag] - g_eq)).margin(1.0e-18));
+    } else {
+      REQUIRE(qgas_cur[igas_soag] <= g0_soa[0]);
+    }
+  }
+
+  // substep histogram bins cover (2^(b-1), 2^b]
+  REQUIRE(substeps_histogram_bin(1) == 0);
+  REQUIRE(substeps_histogram_bin(2) == 1);
+  REQUIRE(substeps_histogram_bin(3) == 2);
+  REQUIRE(substeps_histogram_bin(4) == 2);
+  REQUIRE(substeps_histogram_bin(1000) == 10);
+  REQUIRE(substeps_histogram_bin(1 << 20) ==
+          Diagnostics::num_substeps_histogram_bins - 1);
+}
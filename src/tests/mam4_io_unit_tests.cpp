@@ -0,0 +1,223 @@
+// mam4xx: Copyright (c) 2022,
+// Battelle Memorial Institute and
+// National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "testing.hpp"
+#include <mam4xx/io.hpp>
+#include <mam4xx/mam4.hpp>
+
+#include <catch2/catch.hpp>
+#include <ekat/logging/ekat_logger.hpp>
+#include <ekat/mpi/ekat_comm.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+using namespace haero;
+using namespace mam4;
+
+namespace {
+
+// fills the view with values unique to the given column and field
+void fill(const ColumnView v, const int icol, const int ifield) {
+  auto h = Kokkos::create_mirror_view(v);
+  for (int k = 0; k < v.extent_int(0); ++k)
+    h(k) = 1.0e-9 * (1 + icol) + 1.0e-3 * ifield + 1.0e-6 * k;
+  Kokkos::deep_copy(v, h);
+}
+
+// returns true iff the two views hold the same values
+bool same_values(const ColumnView a, const ColumnView b) {
+  auto h_a = Kokkos::create_mirror_view(a);
+  auto h_b = Kokkos::create_mirror_view(b);
+  Kokkos::deep_copy(h_a, a);
+  Kokkos::deep_copy(h_b, b);
+  for (int k = 0; k < a.extent_int(0); ++k) {
+    if (h_a(k) != h_b(k))
+      return false;
+  }
+  return true;
+}
+
+} // namespace
+
+TEST_CASE("test_checkpoint_restart", "mam4_io") {
+  ekat::Comm comm;
+  ekat::logger::Logger<> logger("io unit tests", ekat::logger::LogLevel::debug,
+                                comm);
+
+  const int ncol = 3, nlev = 72;
+  const int nait = static_cast<int>(ModeIndex::Aitken);
+  const int ih2so4 = static_cast<int>(GasId::H2SO4);
+  const FieldSet fields = fields_accessed<NucleationProcess>();
+  std::vector<Prognostics> progs, restart_progs;
+  std::vector<Diagnostics> diags, restart_diags;
+  for (int icol = 0; icol < ncol; ++icol) {
+    progs.push_back(mam4::testing::create_prognostics(nlev));
+    restart_progs.push_back(mam4::testing::create_prognostics(nlev));
+    diags.push_back(mam4::testing::create_diagnostics(nlev, fields));
+    restart_diags.push_back(mam4::testing::create_diagnostics(nlev, fields));
+    fill(progs[icol].n_mode_i[nait], icol, 0);
+    fill(progs[icol].q_gas[ih2so4], icol, 1);
+    Kokkos::deep_copy(diags[icol].num_skipped_levels, 5 + icol);
+  }
+
+  mam4::io::Checkpoint checkpoint(ncol);
+  checkpoint.store("progs", progs);
+  checkpoint.store("diags", diags);
+  // process state that isn't rebuilt by init()
+  const std::vector<Real> state = {1.0, 2.0, 3.0};
+  checkpoint.store("process/state", state);
+  REQUIRE(checkpoint.has("progs/n_mode_i/1"));
+  REQUIRE(checkpoint.has("diags/num_skipped_levels"));
+  // only allocated views are stored
+  REQUIRE(!checkpoint.has("diags/bc_num"));
+  REQUIRE(!checkpoint.has("diags/active_levels"));
+
+  const std::string filename = "mam4_io_unit_tests.ckpt";
+  checkpoint.write(filename);
+
+  for (const bool memory_map : {false, true}) {
+    logger.debug("reading checkpoint (memory_map = {})", memory_map);
+    mam4::io::ReadOptions options;
+    options.memory_map = memory_map;
+    const auto restart = mam4::io::Checkpoint::read(filename, options);
+    REQUIRE(restart.num_columns() == ncol);
+    REQUIRE(restart.num_fields() == checkpoint.num_fields());
+    restart.load("progs", restart_progs);
+    restart.load("diags", restart_diags);
+    for (int icol = 0; icol < ncol; ++icol) {
+      REQUIRE(same_values(restart_progs[icol].n_mode_i[nait],
+                          progs[icol].n_mode_i[nait]));
+      REQUIRE(same_values(restart_progs[icol].q_gas[ih2so4],
+                          progs[icol].q_gas[ih2so4]));
+      auto h_skipped =
+          Kokkos::create_mirror_view(restart_diags[icol].num_skipped_levels);
+      Kokkos::deep_copy(h_skipped, restart_diags[icol].num_skipped_levels);
+      REQUIRE(h_skipped(0) == 5 + icol);
+    }
+    REQUIRE(restart.values("process/state") == state);
+  }
+
+  // views that aren't in the checkpoint can't be restored
+  std::vector<Diagnostics> all_diags;
+  for (int icol = 0; icol < ncol; ++icol)
+    all_diags.push_back(mam4::testing::create_diagnostics(nlev));
+  REQUIRE_THROWS(checkpoint.load("diags", all_diags));
+
+  // corrupted data are detected
+  {
+    std::fstream file(filename,
+                      std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(-1, std::ios::end);
+    file.put('\x7f');
+  }
+  const auto corrupted =
+      mam4::io::Checkpoint::read(filename, mam4::io::ReadOptions());
+  REQUIRE_THROWS(corrupted.values("process/state"));
+  std::remove(filename.c_str());
+}
+
+TEST_CASE("test_capture_columns", "mam4_io") {
+  const int ncol = 4, nlev = 72;
+  const Real pblh = 1000;
+  const int ih2so4 = static_cast<int>(GasId::H2SO4);
+  const FieldSet fields = fields_accessed<NucleationProcess>();
+  DeviceType::view_1d<Atmosphere> mc_atm("mc_atm", ncol);
+  DeviceType::view_1d<Surface> mc_sfc("mc_sfc", ncol);
+  DeviceType::view_1d<mam4::Prognostics> mc_progs("mc_progs", ncol);
+  DeviceType::view_1d<mam4::Diagnostics> mc_diags("mc_diags", ncol);
+  DeviceType::view_1d<mam4::Tendencies> mc_tends("mc_tends", ncol);
+  const Atmosphere atm = mam4::testing::create_atmosphere(nlev, pblh);
+  const Surface sfc = mam4::testing::create_surface();
+  std::vector<Prognostics> progs;
+  for (int icol = 0; icol < ncol; ++icol) {
+    progs.push_back(mam4::testing::create_prognostics(nlev));
+    fill(progs[icol].q_gas[ih2so4], icol, 0);
+    const mam4::Prognostics p = progs[icol];
+    const mam4::Diagnostics d = mam4::testing::create_diagnostics(nlev, fields);
+    const mam4::Tendencies dqdt = mam4::testing::create_tendencies(nlev);
+    Kokkos::parallel_for(
+        "Load multi-column views", 1, KOKKOS_LAMBDA(const int) {
+          mc_atm(icol) = atm;
+          mc_sfc(icol) = sfc;
+          mc_progs(icol) = p;
+          mc_diags(icol) = d;
+          mc_tends(icol) = dqdt;
+        });
+  }
+
+  // the process runs on all columns, and the inputs of two are captured
+  mam4::AeroConfig mam4_config;
+  mam4_config.number_gauss_points_for_integration = 3;
+  mam4::Nucleation::Config nuc_config;
+  nuc_config.newnuc_method_user_choice = 11;
+  nuc_config.use_rate_table = true;
+  mam4::NucleationProcess process(mam4_config, nuc_config);
+  mam4::io::CaptureOptions capture;
+  capture.filename = "mam4_io_unit_tests.capture";
+  capture.columns = {1, 3};
+  REQUIRE(capture.enabled());
+  REQUIRE(!mam4::io::CaptureOptions().enabled());
+  const Real t = 0.0, dt = 30.0;
+  mam4::io::compute_tendencies(capture, process, mam4_config, ncol, t, dt,
+                               mc_atm, mc_sfc, mc_progs, mc_diags, mc_tends,
+                               nuc_config);
+
+  const auto replay =
+      mam4::io::Checkpoint::read(capture.filename, mam4::io::ReadOptions());
+  REQUIRE(replay.num_columns() == 2);
+  REQUIRE(replay.values("capture/columns") == std::vector<Real>({1, 3}));
+  REQUIRE(replay.values("capture/num_levels")[0] == nlev);
+  REQUIRE(replay.values("capture/time_step")[0] == dt);
+  REQUIRE(replay.has("atm/temperature"));
+  REQUIRE(replay.has("diags/num_skipped_levels"));
+  REQUIRE(!replay.has("diags/bc_num"));
+  REQUIRE(replay.values("atm/planetary_boundary_layer_height") ==
+          std::vector<Real>({pblh, pblh}));
+
+  // the configurations are restored from the capture
+  mam4::AeroConfig replay_config;
+  mam4::Nucleation::Config replay_nuc_config;
+  REQUIRE(mam4::io::load_parameters(replay, "config", replay_config) == 0);
+  REQUIRE(replay_config == mam4_config);
+  REQUIRE(mam4::io::load_parameters(replay, "config", replay_nuc_config) == 0);
+  REQUIRE(replay_nuc_config.newnuc_method_user_choice == 11);
+  REQUIRE(replay_nuc_config.use_rate_table);
+  mam4::WetDeposition::Config wetdep_config;
+  REQUIRE(mam4::io::load_parameters(replay, "config", wetdep_config) == 2);
+
+  // the surface state is captured (it has no fields yet)
+  std::vector<Surface> replay_sfc(2);
+  replay.load("sfc", replay_sfc);
+
+  std::vector<Prognostics> replay_progs;
+  for (int icol = 0; icol < 2; ++icol)
+    replay_progs.push_back(mam4::testing::create_prognostics(nlev));
+  replay.load("progs", replay_progs);
+  REQUIRE(same_values(replay_progs[0].q_gas[ih2so4], progs[1].q_gas[ih2so4]));
+  REQUIRE(same_values(replay_progs[1].q_gas[ih2so4], progs[3].q_gas[ih2so4]));
+  std::remove(capture.filename.c_str());
+
+  // with per_step set, every capture is kept in its own file
+  mam4::io::CaptureOptions step_capture;
+  step_capture.filename = capture.filename;
+  step_capture.columns = capture.columns;
+  step_capture.per_step = true;
+  for (int step = 0; step < 2; ++step) {
+    REQUIRE(step_capture.next_filename() ==
+            capture.filename + "." + std::to_string(step));
+    mam4::io::compute_tendencies(step_capture, process, mam4_config, ncol,
+                                 t + step * dt, dt, mc_atm, mc_sfc, mc_progs,
+                                 mc_diags, mc_tends, nuc_config);
+  }
+  for (int step = 0; step < 2; ++step) {
+    const std::string filename = capture.filename + "." + std::to_string(step);
+    const auto step_replay =
+        mam4::io::Checkpoint::read(filename, mam4::io::ReadOptions());
+    REQUIRE(step_replay.values("capture/time")[0] == t + step * dt);
+    std::remove(filename.c_str());
+  }
+}
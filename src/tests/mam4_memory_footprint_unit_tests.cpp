@@ -0,0 +1,76 @@
+// mam4xx: Copyright (c) 2022,
+// Battelle Memorial Institute and
+// National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "testing.hpp"
+#include <mam4xx/mam4.hpp>
+#include <mam4xx/memory_footprint.hpp>
+
+#include <catch2/catch.hpp>
+#include <ekat/logging/ekat_logger.hpp>
+#include <ekat/mpi/ekat_comm.hpp>
+
+#include <vector>
+
+using namespace haero;
+using namespace mam4;
+
+TEST_CASE("test_memory_footprint", "mam4_memory_footprint") {
+  ekat::Comm comm;
+  ekat::logger::Logger<> logger("memory footprint unit tests",
+                                ekat::logger::LogLevel::debug, comm);
+
+  const int ncol = 2, nlev = 72;
+  const std::size_t column_bytes = nlev * sizeof(Real);
+
+  // state containers count their allocated views
+  std::vector<Prognostics> progs;
+  for (int icol = 0; icol < ncol; ++icol)
+    progs.push_back(mam4::testing::create_prognostics(nlev));
+  const std::size_t progs_bytes = memory_footprint(progs[0]);
+  REQUIRE(progs_bytes > 0);
+  REQUIRE(progs_bytes % column_bytes == 0);
+  REQUIRE(memory_footprint(progs) == ncol * progs_bytes);
+
+  // diagnostics with only the fields used by a process are smaller
+  const Diagnostics all_diags = mam4::testing::create_diagnostics(nlev);
+  const Diagnostics nuc_diags = mam4::testing::create_diagnostics(
+      nlev, fields_accessed<NucleationProcess>());
+  REQUIRE(memory_footprint(nuc_diags) > 0);
+  REQUIRE(memory_footprint(nuc_diags) < memory_footprint(all_diags));
+  const Atmosphere atm = mam4::testing::create_atmosphere(nlev, 1000);
+  REQUIRE(memory_footprint(atm) % column_bytes == 0);
+
+  // processes report the device memory they hold
+  const AeroConfig aero_config;
+  ConvProc convproc;
+  convproc.init(aero_config);
+  REQUIRE(memory_footprint(convproc) >= column_bytes * ConvProc::gas_pcnst);
+  Aging aging;
+  aging.init(aero_config);
+  REQUIRE(memory_footprint(aging) == 0);
+  Nucleation nucleation;
+  nucleation.init(aero_config);
+  REQUIRE(memory_footprint(nucleation) == 0);
+  Nucleation::Config nucleation_config;
+  nucleation_config.use_rate_table = true;
+  nucleation.init(aero_config, nucleation_config);
+  REQUIRE(memory_footprint(nucleation) > 0);
+
+  MemoryReport report;
+  report.add("prognostics", progs);
+  report.add("diagnostics", nuc_diags);
+  report.add("convproc", convproc);
+  report.add("nucleation", nucleation);
+  report.add_bytes("other", 1024);
+  logger.debug("memory footprint:\n{}", report.str());
+  REQUIRE(report.num_entries() == 5);
+  REQUIRE(report.bytes("prognostics") == ncol * progs_bytes);
+  REQUIRE(report.bytes("none") == 0);
+  REQUIRE(report.total_bytes() == ncol * progs_bytes +
+                                      memory_footprint(nuc_diags) +
+                                      memory_footprint(convproc) +
+                                      memory_footprint(nucleation) + 1024);
+  REQUIRE(report.str().find("convproc") != std::string::npos);
+}
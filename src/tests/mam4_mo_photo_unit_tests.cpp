@@ -0,0 +1,151 @@
+// mam4xx: Copyright (c) 2022,
+// Battelle Memorial Institute and
+// National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "testing.hpp"
+#include <mam4xx/mam4.hpp>
+
+#include <catch2/catch.hpp>
+#include <ekat/logging/ekat_logger.hpp>
+#include <ekat/mpi/ekat_comm.hpp>
+
+#include <vector>
+
+using namespace mam4;
+
+TEST_CASE("test_cloud_mod_levels", "mam4_mo_photo") {
+  ekat::Comm comm;
+  ekat::logger::Logger<> logger("mo_photo unit tests",
+                                ekat::logger::LogLevel::debug, comm);
+
+  const Real zen_angle = 0.5, srf_alb = 0.2;
+  // columns of the specialized level counts and of another one
+  for (const int nlev : {72, 128, 100}) {
+    logger.debug("cloud_mod on a column of {} levels", nlev);
+    std::vector<Real> clouds(nlev), lwc(nlev), delp(nlev);
+    for (int k = 0; k < nlev; ++k) {
+      clouds[k] = (k % 3 == 0) ? 0.0 : 0.1 + 0.8 * k / nlev;
+      lwc[k] = 1.0e-4 * (k % 5);
+      delp[k] = 100.0 + 10.0 * k;
+    }
+    std::vector<Real> eff_alb(nlev), cld_mult(nlev);
+    mo_photo::cloud_mod(zen_angle, clouds.data(), lwc.data(), delp.data(),
+                        srf_alb, eff_alb.data(), cld_mult.data(), nlev);
+
+    // the general version gives the same factors as the specializations
+    std::vector<Real> ref_eff_alb(nlev), ref_cld_mult(nlev);
+    mo_photo::cloud_mod<0>(zen_angle, clouds.data(), lwc.data(), delp.data(),
+                           srf_alb, ref_eff_alb.data(), ref_cld_mult.data(),
+                           nlev);
+    for (int k = 0; k < nlev; ++k) {
+      REQUIRE(eff_alb[k] == ref_eff_alb[k]);
+      REQUIRE(cld_mult[k] == ref_cld_mult[k]);
+      REQUIRE(eff_alb[k] >= srf_alb);
+      REQUIRE(eff_alb[k] <= 1.0);
+      REQUIRE(cld_mult[k] >= 0.05);
+    }
+  }
+}
+
+TEST_CASE("test_table_photo_levels", "mam4_mo_photo") {
+  ekat::Comm comm;
+  ekat::logger::Logger<> logger("mo_photo unit tests",
+                                ekat::logger::LogLevel::debug, comm);
+
+  using View1D = mo_photo::View1D;
+  using View2D = mo_photo::View2D;
+
+  // a small photolysis table with one photorate at two wavelengths, on
+  // pressure levels (from the surface up) and zenith angles, o3 ratios and
+  // albedos spanning those of the columns below
+  const int nw = 2, numj = 1, np_xs = 2, nump = 3, numsza = 2, numcolo3 = 2,
+            numalb = 2, num_temperatures = 201;
+  mo_photo::View4D xsqy("xsqy", numj, nw, num_temperatures, np_xs);
+  mo_photo::View5D rsf_tab("rsf_tab", nw, nump, numsza, numcolo3, numalb);
+  View1D prs("prs", np_xs), dprs("dprs", np_xs);
+  View1D sza("sza", numsza), del_sza("del_sza", numsza);
+  View1D alb("alb", numalb), del_alb("del_alb", numalb);
+  View1D press("press", nump), del_p("del_p", nump), colo3("colo3", nump);
+  View1D o3rat("o3rat", numcolo3), del_o3rat("del_o3rat", numcolo3);
+  View1D etfphot("etfphot", nw), pht_alias_mult_1("pht_alias_mult_1", 1);
+  mo_photo::ViewInt1D lng_indexer("lng_indexer", 1);
+  Kokkos::deep_copy(xsqy, 1.0e-20);
+  Kokkos::parallel_for(
+      1, KOKKOS_LAMBDA(const int) {
+        for (int wn = 0; wn < nw; ++wn)
+          for (int ip = 0; ip < nump; ++ip)
+            for (int is = 0; is < numsza; ++is)
+              for (int iv = 0; iv < numcolo3; ++iv)
+                for (int ia = 0; ia < numalb; ++ia)
+                  rsf_tab(wn, ip, is, iv, ia) =
+                      1.0 + 0.1 * (wn + ip + is + iv + ia);
+        prs(0) = 1000.0, prs(1) = 1.0;
+        dprs(0) = dprs(1) = 1.0 / (prs(0) - prs(1));
+        sza(0) = 0.0, sza(1) = 90.0;
+        del_sza(0) = del_sza(1) = 1.0 / 90.0;
+        alb(0) = 0.0, alb(1) = 1.0;
+        del_alb(0) = del_alb(1) = 1.0;
+        press(0) = 1000.0, press(1) = 500.0, press(2) = 1.0;
+        del_p(0) = 1.0 / (press(0) - press(1));
+        del_p(1) = del_p(2) = 1.0 / (press(1) - press(2));
+        colo3(0) = 1.0e19, colo3(1) = 5.0e18, colo3(2) = 1.0e17;
+        o3rat(0) = 0.5, o3rat(1) = 2.0;
+        del_o3rat(0) = del_o3rat(1) = 1.0 / (o3rat(1) - o3rat(0));
+        etfphot(0) = 1.0e14, etfphot(1) = 2.0e14;
+        pht_alias_mult_1(0) = 1.0;
+        lng_indexer(0) = 0;
+      });
+
+  const Real zen_angle = 0.5, srf_alb = 0.2, esfact = 1.0;
+  // columns of the specialized level counts and of another one
+  for (const int nlev : {72, 128, 100}) {
+    logger.debug("table_photo on a column of {} levels", nlev);
+    ColumnView pmid = testing::create_column_view(nlev);
+    ColumnView pdel = testing::create_column_view(nlev);
+    ColumnView temper = testing::create_column_view(nlev);
+    ColumnView colo3_in = testing::create_column_view(nlev);
+    ColumnView lwc = testing::create_column_view(nlev);
+    ColumnView clouds = testing::create_column_view(nlev);
+    Kokkos::parallel_for(
+        1, KOKKOS_LAMBDA(const int) {
+          for (int k = 0; k < nlev; ++k) {
+            pdel(k) = 1.0e5 / nlev;
+            pmid(k) = (k + 0.5) * pdel(k);
+            temper(k) = 200.0 + 80.0 * k / nlev;
+            colo3_in(k) = 1.0e17 + 5.0e18 * k / nlev;
+            clouds(k) = (k % 3 == 0) ? 0.0 : 0.1 + 0.8 * k / nlev;
+            lwc(k) = 1.0e-4 * (k % 5);
+          }
+        });
+
+    // the photorates of the specialized version and of the general one
+    View2D photo("photo", nlev, 1), ref_photo("ref_photo", nlev, 1);
+    View2D lng_prates("lng_prates", numj, nlev), rsf("rsf", nw, nlev),
+        xswk("xswk", numj, nw);
+    View1D psum_l("psum_l", nw), psum_u("psum_u", nw);
+    Kokkos::parallel_for(
+        1, KOKKOS_LAMBDA(const int) {
+          mo_photo::table_photo(
+              photo, pmid, pdel, temper, colo3_in, zen_angle, srf_alb, lwc,
+              clouds, esfact, xsqy, sza, del_sza, alb, press, del_p, colo3,
+              o3rat, del_alb, del_o3rat, etfphot, rsf_tab, prs, dprs, nw, nump,
+              numsza, numcolo3, numalb, np_xs, numj, pht_alias_mult_1,
+              lng_indexer, lng_prates, rsf, xswk, psum_l, psum_u);
+          mo_photo::table_photo<0>(
+              ref_photo, pmid, pdel, temper, colo3_in, zen_angle, srf_alb, lwc,
+              clouds, esfact, xsqy, sza, del_sza, alb, press, del_p, colo3,
+              o3rat, del_alb, del_o3rat, etfphot, rsf_tab, prs, dprs, nw, nump,
+              numsza, numcolo3, numalb, np_xs, numj, pht_alias_mult_1,
+              lng_indexer, lng_prates, rsf, xswk, psum_l, psum_u);
+        });
+    const auto h_photo =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), photo);
+    const auto h_ref_photo =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), ref_photo);
+    for (int k = 0; k < nlev; ++k) {
+      REQUIRE(h_photo(k, 0) == h_ref_photo(k, 0));
+      REQUIRE(h_photo(k, 0) > 0.0);
+    }
+  }
+}
@@ -219,6 +219,98 @@ TEST_CASE("test_explmix", "mam4_ndrop") {
   REQUIRE(FloatingPoint<Real>::equiv(q, 0.9));
 }
 
+TEST_CASE("test_update_from_explmix_levels", "mam4_ndrop") {
+  ekat::Comm comm;
+  ekat::logger::Logger<> logger("ndrop update_from_explmix unit tests",
+                                ekat::logger::LogLevel::debug, comm);
+
+  const int ntot_amode = AeroConfig::num_modes();
+  int nspec_amode[ntot_amode], numptr_amode[ntot_amode];
+  int lspectype_amode[ndrop::maxd_aspectype][ntot_amode];
+  int lmassptr_amode[ndrop::maxd_aspectype][ntot_amode];
+  Real specdens_amode[ndrop::maxd_aspectype], spechygro[ndrop::maxd_aspectype];
+  int mam_idx[ntot_amode][ndrop::nspec_max];
+  int mam_cnst_idx[ntot_amode][ndrop::nspec_max];
+  ndrop::get_e3sm_parameters(nspec_amode, lspectype_amode, lmassptr_amode,
+                             numptr_amode, specdens_amode, spechygro, mam_idx,
+                             mam_cnst_idx);
+  // number mixing ratio of the first mode
+  const int mm = mam_idx[0][0] - 1;
+
+  // columns of the default level count and of others, cloudy at all levels,
+  // in which droplets and aerosols are only mixed, starting from a peak at a
+  // level beyond the 72nd one in the deeper columns
+  const Real dtmicro = 300;
+  for (const int nlev : {72, 100, 128}) {
+    logger.debug("update_from_explmix on a column of {} levels", nlev);
+    const int kpeak = nlev - 5;
+    ColumnView csbot = testing::create_column_view(nlev);
+    ColumnView cldn = testing::create_column_view(nlev);
+    ColumnView zn = testing::create_column_view(nlev);
+    ColumnView zs = testing::create_column_view(nlev);
+    ColumnView eddy_diff = testing::create_column_view(nlev);
+    ColumnView qcld = testing::create_column_view(nlev);
+    Kokkos::deep_copy(csbot, 1.0);
+    Kokkos::deep_copy(cldn, 0.5);
+    Kokkos::deep_copy(zn, 1.0e-2);
+    Kokkos::deep_copy(zs, 1.0e-2);
+    Kokkos::deep_copy(eddy_diff, 10.0);
+    ndrop::View2D nact("nact", nlev, ntot_amode),
+        mact("mact", nlev, ntot_amode);
+    ndrop::View1D raercol[mam4::max_nlev][2], raercol_cw[mam4::max_nlev][2];
+    for (int k = 0; k < nlev; ++k) {
+      for (int n = 0; n < 2; ++n) {
+        raercol[k][n] = ndrop::View1D("raercol", ndrop::ncnst_tot);
+        raercol_cw[k][n] = ndrop::View1D("raercol_cw", ndrop::ncnst_tot);
+      }
+    }
+    ColumnView overlapp = testing::create_column_view(nlev);
+    ColumnView overlapm = testing::create_column_view(nlev);
+    ColumnView eddy_diff_kp = testing::create_column_view(nlev);
+    ColumnView eddy_diff_km = testing::create_column_view(nlev);
+    ColumnView qncld = testing::create_column_view(nlev);
+    ColumnView srcn = testing::create_column_view(nlev);
+    ColumnView source = testing::create_column_view(nlev);
+    // mixed droplet and aerosol numbers at each level
+    ndrop::View2D mixed("mixed", nlev, 2);
+    Kokkos::parallel_for(
+        haero::ThreadTeamPolicy(1, Kokkos::AUTO),
+        KOKKOS_LAMBDA(const haero::ThreadTeam &team) {
+          Kokkos::single(Kokkos::PerTeam(team), [&]() {
+            qcld(kpeak) = 1.0e6;
+            raercol[kpeak][0](mm) = 1.0e8;
+          });
+          team.team_barrier();
+          int nsav = 0, nnew = 1;
+          ndrop::update_from_explmix(
+              team, dtmicro, csbot, cldn, zn, zs, eddy_diff, nact, mact, qcld,
+              raercol, raercol_cw, nsav, nnew, nspec_amode, mam_idx, overlapp,
+              overlapm, eddy_diff_kp, eddy_diff_km, qncld, srcn, source);
+          team.team_barrier();
+          Kokkos::single(Kokkos::PerTeam(team), [&]() {
+            for (int k = 0; k < nlev; ++k) {
+              mixed(k, 0) = qcld(k);
+              mixed(k, 1) = raercol[k][nnew](mm);
+            }
+          });
+        });
+    const auto h_mixed =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), mixed);
+    // the peaks spread to the levels around them, and the columns keep their
+    // droplets and aerosols
+    const Real peak[2] = {1.0e6, 1.0e8};
+    for (int n = 0; n < 2; ++n) {
+      REQUIRE(h_mixed(kpeak, n) < peak[n]);
+      REQUIRE(h_mixed(kpeak - 1, n) > 0.0);
+      REQUIRE(h_mixed(kpeak + 1, n) > 0.0);
+      Real total = 0.0;
+      for (int k = 0; k < nlev; ++k)
+        total += h_mixed(k, n);
+      REQUIRE(haero::abs(total - peak[n]) <= 1.0e-12 * peak[n]);
+    }
+  }
+}
+
 TEST_CASE("test_maxsat", "mam4_ndrop") {
   ekat::Comm comm;
   ekat::logger::Logger<> logger("ndrop maxsat unit tests",
@@ -322,14 +322,54 @@ TEST_CASE("test_wv_sat_svp_trans", "mam4_nucleate_ice_process") {
                                 ekat::logger::LogLevel::debug, comm);
 
   const Real epsilon = ekat::is_single_precision<Real>::value ? 0.01 : 0.0001;
+  // tabulated pressures have relative errors up to svp_table_tolerance
+  const Real rel_epsilon = mam4::svp_table ? mam4::svp_table_tolerance : 0;
   const Real tmelt = haero::Constants::melting_pt_h2o;
   Real temperature = tmelt + 40;
   REQUIRE(std::abs(7373.80964886279 - mam4::wv_sat_methods::wv_sat_svp_trans(
-                                          temperature)) < epsilon);
+                                          temperature)) <
+          epsilon + rel_epsilon * 7373.80964886279);
   temperature = tmelt - 10;
   REQUIRE(std::abs(272.7574754946415 - mam4::wv_sat_methods::wv_sat_svp_trans(
-                                           temperature)) < epsilon);
+                                           temperature)) <
+          epsilon + rel_epsilon * 272.7574754946415);
   temperature = tmelt - 30;
   REQUIRE(std::abs(37.94098622403198 - mam4::wv_sat_methods::wv_sat_svp_trans(
-                                           temperature)) < epsilon);
+                                           temperature)) <
+          epsilon + rel_epsilon * 37.94098622403198);
+}
+
+TEST_CASE("test_tabulated_svp", "mam4_nucleate_ice_process") {
+  using namespace mam4::wv_sat_methods;
+  // the tables meet the configured tolerance, and a finer one
+  constexpr int fine = detail::svp_table_nodes_per_kelvin(1e-8);
+  const Real tolerance = ekat::is_single_precision<Real>::value
+                             ? 1e-5
+                             : mam4::svp_table_tolerance;
+  const Real fine_tolerance =
+      ekat::is_single_precision<Real>::value ? 1e-5 : 1e-8;
+  Real max_error = 0, max_fine_error = 0;
+  for (int i = 0; i <= 20000; ++i) {
+    const Real t = 150 + 0.01 * i;
+    const Real es_water = GoffGratch_svp_water(t);
+    const Real es_ice = GoffGratch_svp_ice(t);
+    max_error =
+        std::max({max_error, std::abs(tabulated_svp_water(t) / es_water - 1),
+                  std::abs(tabulated_svp_ice(t) / es_ice - 1)});
+    max_fine_error = std::max(
+        {max_fine_error, std::abs(tabulated_svp_water<fine>(t) / es_water - 1),
+         std::abs(tabulated_svp_ice<fine>(t) / es_ice - 1)});
+  }
+  REQUIRE(max_error < tolerance);
+  REQUIRE(max_fine_error < fine_tolerance);
+
+  // outside the tables, the formulas are evaluated
+  REQUIRE(tabulated_svp_water(100.0) == GoffGratch_svp_water(100.0));
+  REQUIRE(tabulated_svp_ice(400.0) == GoffGratch_svp_ice(400.0));
+
+  // tolerances below the error of the finest table can't be met
+  constexpr int finest = detail::svp_table_max_nodes_per_kelvin;
+  REQUIRE(detail::svp_table_nodes_per_kelvin(1e-12) == finest);
+  REQUIRE(!detail::svp_table_meets_tolerance(finest, 1e-12));
+  REQUIRE(detail::svp_table_meets_tolerance(finest, 4e-10));
 }
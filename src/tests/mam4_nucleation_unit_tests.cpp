@@ -79,6 +79,12 @@ TEST_CASE("test_compute_tendencies", "mam4_nucleation_process") {
   Kokkos::deep_copy(h_prog_qgas0, prog_qgas0);
   Kokkos::deep_copy(h_tend_qgas0, tend_qgas0);
 
+  // There is no H2SO4 anywhere in the column, so every level is skipped.
+  auto h_num_skipped = Kokkos::create_mirror_view(diags.num_skipped_levels);
+  Kokkos::deep_copy(h_num_skipped, diags.num_skipped_levels);
+  REQUIRE(h_num_skipped(mam4::Diagnostics::nucleation_skipped_levels) ==
+          nlev);
+
   ss << "prog_qgas0 [out]: [ ";
   for (int k = 0; k < nlev; ++k) {
     ss << h_prog_qgas0(k) << " ";
@@ -141,3 +147,123 @@ TEST_CASE("test_multicol_compute_tendencies", "mam4_nucleation_process") {
                                    mc_tends(icol));
       });
 }
+
+TEST_CASE("test_rate_table", "mam4_nucleation_process") {
+  // Compare the tabulated binary nucleation rates against the Vehkamaki et
+  // al (2002) parameterization on a lattice of points that are offset from
+  // the table nodes.
+  mam4::nucleation::RateTable table;
+  table.init(61, 47, 65, 25, 10, 21, 0);
+  REQUIRE(table.has_binary());
+  REQUIRE(!table.has_ternary());
+
+  const int n = 10;
+  const Real ln_nuc_rate_cutoff = -13.82;
+  Real max_err = 0.0;
+  Kokkos::parallel_reduce(
+      "binary_rate_table", n * n * n,
+      KOKKOS_LAMBDA(const int idx, Real &err) {
+        const int i = idx / (n * n), j = (idx / n) % n, k = idx % n;
+        const Real temp = 230.15 + 75.0 * (i + 0.37) / n;
+        const Real rh = exp(log(1.0e-4) * (j + 0.61) / n);
+        const Real so4vol = exp(log(1.0e4) + log(1.0e7) * (k + 0.29) / n);
+
+        Real ratenucl, rateloge, cnum_h2so4, cnum_tot, radius;
+        mam4::nucleation::binary_nuc_vehk2002(temp, rh, so4vol, ratenucl,
+                                              rateloge, cnum_h2so4, cnum_tot,
+                                              radius);
+        Real t_ratenucl, t_rateloge, t_cnum_h2so4, t_cnum_tot, t_radius;
+        table.binary_nuc(temp, rh, so4vol, t_ratenucl, t_rateloge,
+                         t_cnum_h2so4, t_cnum_tot, t_radius);
+        if (rateloge > ln_nuc_rate_cutoff) {
+          err = max(err, abs(t_rateloge - rateloge));
+        }
+      },
+      Kokkos::Max<Real>(max_err));
+  REQUIRE(max_err < 0.1);
+
+  // The table-driven process should produce the same kind of output as the
+  // analytic one.
+  int nlev = 72;
+  Real pblh = 1000;
+  Atmosphere atm = mam4::testing::create_atmosphere(nlev, pblh);
+  Surface sfc = mam4::testing::create_surface();
+  mam4::Prognostics progs = mam4::testing::create_prognostics(nlev);
+  mam4::Diagnostics diags = mam4::testing::create_diagnostics(nlev);
+  mam4::Tendencies tends = mam4::testing::create_tendencies(nlev);
+
+  mam4::AeroConfig mam4_config;
+  mam4::NucleationProcess::ProcessConfig process_config;
+  process_config.use_rate_table = true;
+  mam4::NucleationProcess process(mam4_config, process_config);
+
+  auto team_policy = ThreadTeamPolicy(1u, Kokkos::AUTO);
+  Real t = 0.0, dt = 30.0;
+  Kokkos::parallel_for(
+      team_policy, KOKKOS_LAMBDA(const ThreadTeam &team) {
+        process.compute_tendencies(team, t, dt, atm, sfc, progs, diags, tends);
+      });
+  const auto tend_qgas0 = tends.q_gas[0];
+  auto h_tend_qgas0 = Kokkos::create_mirror_view(tend_qgas0);
+  Kokkos::deep_copy(h_tend_qgas0, tend_qgas0);
+  for (int k = 0; k < nlev; ++k) {
+    CHECK(!isnan(h_tend_qgas0(k)));
+  }
+}
+
+TEST_CASE("test_ternary_rate_table", "mam4_nucleation_process") {
+  // Compare the tabulated ternary nucleation rates and critical cluster
+  // properties against the Merikanto et al (2007) parameterization on a
+  // lattice of points that are offset from the table nodes.
+  mam4::nucleation::RateTable table;
+  table.init(61, 47, 65, 25, 10, 21, 81);
+  REQUIRE(table.has_binary());
+  REQUIRE(table.has_ternary());
+
+  // errors at each point: onset mismatch (0 or 1), |d ln(J)| and largest
+  // relative error in the cluster properties
+  const int n = 8;
+  const Real ln_nuc_rate_cutoff = -13.82;
+  Kokkos::View<Real *[3]> errors("ternary_rate_table_errors", n * n * n * n);
+  Kokkos::parallel_for(
+      "ternary_rate_table", n * n * n * n, KOKKOS_LAMBDA(const int idx) {
+        const int i = idx / (n * n * n), j = (idx / (n * n)) % n,
+                  k = (idx / n) % n, l = idx % n;
+        const Real t = 235.0 + 60.0 * (i + 0.37) / n;
+        const Real rh = 0.05 + 0.9 * (j + 0.61) / n;
+        const Real c2 = exp(log(5.0e4) + log(2.0e4) * (k + 0.29) / n);
+        const Real c3 = exp(log(0.1) + log(1.0e4) * (l + 0.53) / n);
+
+        Real j_log, ntot, nacid, namm, r;
+        mam4::nucleation::ternary_nuc_merik2007(t, rh, c2, c3, j_log, ntot,
+                                                nacid, namm, r);
+        Real t_j_log, t_ntot, t_nacid, t_namm, t_r;
+        table.ternary_nuc(t, rh, c2, c3, t_j_log, t_ntot, t_nacid, t_namm,
+                          t_r);
+        errors(idx, 0) = errors(idx, 1) = errors(idx, 2) = 0;
+        // the onset of nucleation is evaluated exactly
+        if ((j_log == -300.) != (t_j_log == -300.)) {
+          errors(idx, 0) = 1;
+        } else if (j_log > ln_nuc_rate_cutoff) {
+          errors(idx, 1) = abs(t_j_log - j_log);
+          errors(idx, 2) = max(max(abs(t_ntot - ntot) / ntot,
+                                   abs(t_nacid - nacid) / nacid),
+                               max(abs(t_namm - namm) / namm,
+                                   abs(t_r - r) / r));
+        }
+      });
+  auto h_errors = Kokkos::create_mirror_view(errors);
+  Kokkos::deep_copy(h_errors, errors);
+  Real max_err = 0.0, max_rel_err = 0.0;
+  int num_onset_mismatches = 0, num_nucleating = 0;
+  for (int idx = 0; idx < n * n * n * n; ++idx) {
+    num_onset_mismatches += static_cast<int>(h_errors(idx, 0));
+    num_nucleating += (h_errors(idx, 1) > 0);
+    max_err = max(max_err, h_errors(idx, 1));
+    max_rel_err = max(max_rel_err, h_errors(idx, 2));
+  }
+  REQUIRE(num_onset_mismatches == 0);
+  REQUIRE(num_nucleating > 0);
+  REQUIRE(max_err < 0.3);
+  REQUIRE(max_rel_err < 0.013);
+}
@@ -0,0 +1,444 @@
+// mam4xx: Copyright (c) 2022,
+// Battelle Memorial Institute and
+// National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "atmosphere_utils.hpp"
+#include "testing.hpp"
+#include <mam4xx/mam4.hpp>
+
+#include <catch2/catch.hpp>
+#include <ekat/logging/ekat_logger.hpp>
+#include <ekat/mpi/ekat_comm.hpp>
+
+#include <vector>
+
+using namespace haero;
+using namespace mam4;
+
+namespace {
+
+// fields accessed by the processes used in these tests
+const FieldAccess nucleate_ice_access = {
+    field::interstitial_aerosols | field::particle_size,
+    field::ice_nucleation};
+const FieldAccess hetfrz_access = {
+    field::interstitial_aerosols | field::cloudborne_aerosols |
+        field::cloud_state,
+    field::heterogeneous_freezing};
+const FieldAccess nucleation_access = {
+    field::gases | field::interstitial_aerosols | field::gas_aerosol_exchange,
+    field::gases | field::interstitial_aerosols | field::level_work_arrays};
+
+} // namespace
+
+TEST_CASE("test_stages", "mam4_process_scheduler") {
+  mam4::AeroConfig mam4_config;
+  mam4::NucleateIceProcess nucleate_ice(mam4_config);
+  mam4::HetfrzProcess hetfrz(mam4_config);
+  mam4::NucleationProcess nucleation(mam4_config);
+
+  // ice nucleation and heterogeneous freezing only read aerosols, so they
+  // share a stage, and nucleation, which updates aerosols, runs after them
+  const FieldAccess access[3] = {nucleate_ice_access, hetfrz_access,
+                                 nucleation_access};
+  ProcessScheduler<NucleateIceProcess, HetfrzProcess, NucleationProcess>
+      scheduler(access, nucleate_ice, hetfrz, nucleation);
+  REQUIRE(scheduler.num_stages() == 2);
+  REQUIRE(scheduler.stage(0) == 0);
+  REQUIRE(scheduler.stage(1) == 0);
+  REQUIRE(scheduler.stage(2) == 1);
+
+  // a process that runs before the freezing processes and updates aerosols
+  // separates them from one another only through its own stage
+  const FieldAccess access2[3] = {nucleation_access, nucleate_ice_access,
+                                  hetfrz_access};
+  ProcessScheduler<NucleationProcess, NucleateIceProcess, HetfrzProcess>
+      scheduler2(access2, nucleation, nucleate_ice, hetfrz);
+  REQUIRE(scheduler2.num_stages() == 2);
+  REQUIRE(scheduler2.stage(0) == 0);
+  REQUIRE(scheduler2.stage(1) == 1);
+  REQUIRE(scheduler2.stage(2) == 1);
+
+  // a chain of dependent processes has one process per stage
+  const FieldAccess access3[3] = {nucleation_access, nucleation_access,
+                                  nucleate_ice_access};
+  ProcessScheduler<NucleationProcess, NucleationProcess, NucleateIceProcess>
+      scheduler3(access3, nucleation, nucleation, nucleate_ice);
+  REQUIRE(scheduler3.num_stages() == 3);
+  for (int i = 0; i < 3; ++i)
+    REQUIRE(scheduler3.stage(i) == i);
+
+  // readers of the same field don't conflict; a writer conflicts with both
+  REQUIRE(!conflicts(nucleate_ice_access, hetfrz_access));
+  REQUIRE(conflicts(nucleate_ice_access, nucleation_access));
+  REQUIRE(conflicts(nucleation_access, hetfrz_access));
+}
+
+TEST_CASE("test_declared_fields", "mam4_process_scheduler") {
+  mam4::AeroConfig mam4_config;
+  mam4::NucleateIceProcess nucleate_ice(mam4_config);
+  mam4::HetfrzProcess hetfrz(mam4_config);
+  mam4::NucleationProcess nucleation(mam4_config);
+  mam4::CalcSizeProcess calcsize(mam4_config);
+
+  // processes declare the fields they access, and the scheduler uses them
+  ProcessScheduler<CalcSizeProcess, NucleateIceProcess, HetfrzProcess,
+                   NucleationProcess>
+      scheduler(calcsize, nucleate_ice, hetfrz, nucleation);
+  REQUIRE(scheduler.num_stages() == 3);
+  REQUIRE(scheduler.stage(0) == 0);
+  REQUIRE(scheduler.stage(1) == 1);
+  REQUIRE(scheduler.stage(2) == 1);
+  REQUIRE(scheduler.stage(3) == 2);
+
+  constexpr FieldSet fields =
+      fields_accessed<NucleateIceProcess, NucleationProcess>();
+  REQUIRE((fields & field::ice_nucleation));
+  REQUIRE((fields & field::level_work_arrays));
+  REQUIRE(!(fields & field::heterogeneous_freezing));
+  REQUIRE(!(fields & field::dry_deposition));
+  REQUIRE(fields_accessed<CalcSizeProcess, NucleateIceProcess, HetfrzProcess,
+                          NucleationProcess>() ==
+          scheduler.fields_accessed());
+
+  // only the diagnostics needed by the processes are allocated
+  const int nlev = 72;
+  mam4::Diagnostics diags =
+      mam4::testing::create_diagnostics(nlev, fields & diagnostic_fields);
+  REQUIRE(diags.icenuc_num_depnuc.is_allocated());
+  REQUIRE(diags.dry_geometric_mean_diameter_i[0].is_allocated());
+  REQUIRE(diags.active_levels.is_allocated());
+  REQUIRE(!diags.bc_num.is_allocated());
+  REQUIRE(!diags.uptkrate_h2so4.is_allocated());
+  REQUIRE(!diags.dry_deposition_flux_i.is_allocated());
+
+  // every group can be allocated, with the column views held by a storage
+  ColumnStorage storage;
+  constexpr FieldSet wetdep_fields =
+      fields_accessed<WetDepositionProcess>() & diagnostic_fields;
+  mam4::Diagnostics wetdep_diags =
+      mam4::create_diagnostics(nlev, storage, wetdep_fields);
+  REQUIRE(wetdep_diags.tracer_mixing_ratio.extent(0) == nlev);
+  REQUIRE(wetdep_diags.tracer_mixing_ratio.extent(1) == ConvProc::gas_pcnst);
+  REQUIRE(wetdep_diags.d_tracer_mixing_ratio_dt.data() != nullptr);
+  REQUIRE(wetdep_diags.deep_convective_cloud_fraction.data() != nullptr);
+  REQUIRE(wetdep_diags.aerosol_wet_deposition_interstitial.data() != nullptr);
+  REQUIRE(wetdep_diags.wet_geometric_mean_diameter_i[0].data() != nullptr);
+  REQUIRE(wetdep_diags.active_levels.is_allocated());
+  REQUIRE(wetdep_diags.icenuc_num_depnuc.data() == nullptr);
+  REQUIRE(!wetdep_diags.dry_deposition_flux_i.is_allocated());
+
+  // water uptake computes the wet sizes of the modes from their dry sizes
+  constexpr FieldAccess water_uptake = Water_Uptake::field_access();
+  REQUIRE((water_uptake.reads & field::particle_size));
+  REQUIRE((water_uptake.writes & field::particle_size));
+
+  // ModeSize writes the dry diameters CalcSize writes, and water uptake reads
+  // them, so each runs in its own stage, in the given order
+  REQUIRE(conflicts(CalcSize::field_access(), ModeSize::field_access()));
+  mam4::ModeSizeProcess mode_size(mam4_config);
+  mam4::WaterUptakeProcess water_uptake_process(mam4_config);
+  ProcessScheduler<CalcSizeProcess, ModeSizeProcess, WaterUptakeProcess>
+      size_scheduler(calcsize, mode_size, water_uptake_process);
+  REQUIRE(size_scheduler.num_stages() == 3);
+  for (int i = 0; i < 3; ++i)
+    REQUIRE(size_scheduler.stage(i) == i);
+}
+
+TEST_CASE("test_compute_tendencies", "mam4_process_scheduler") {
+  ekat::Comm comm;
+  ekat::logger::Logger<> logger("process scheduler unit tests",
+                                ekat::logger::LogLevel::debug, comm);
+
+  const int ncol = 4;
+  const int nlev = 72;
+  const Real pblh = 1000;
+  DeviceType::view_1d<Atmosphere> mc_atm("mc_atm", ncol);
+  DeviceType::view_1d<Surface> mc_sfc("mc_sfc", ncol);
+  DeviceType::view_1d<mam4::Prognostics> mc_progs("mc_progs", ncol);
+  DeviceType::view_1d<mam4::Diagnostics> mc_diags("mc_diags", ncol);
+  DeviceType::view_1d<mam4::Tendencies> mc_tends("mc_tends", ncol);
+  // a realistic column, so ice nucleation gives finite diagnostics to compare
+  Atmosphere atm = init_atm_const_tv_lapse_rate(nlev, pblh);
+  Surface sfc = mam4::testing::create_surface();
+  const int ih2so4 = static_cast<int>(GasId::H2SO4);
+  auto create_progs = [&]() {
+    mam4::Prognostics progs = mam4::testing::create_prognostics(nlev);
+    Kokkos::deep_copy(progs.q_gas[ih2so4], 1.0e-9);
+    return progs;
+  };
+  // the scheduler updates the prognostics, so each column gets its own
+  // prognostics and tendencies, and diagnostics with only the fields used by
+  // the processes
+  std::vector<mam4::Prognostics> progs;
+  std::vector<mam4::Diagnostics> diags;
+  std::vector<mam4::Tendencies> tends;
+  const FieldSet fields =
+      fields_accessed<NucleationProcess, NucleateIceProcess>();
+  for (int icol = 0; icol < ncol; ++icol) {
+    progs.push_back(create_progs());
+    diags.push_back(mam4::testing::create_diagnostics(nlev, fields));
+    tends.push_back(mam4::testing::create_tendencies(nlev));
+    const mam4::Prognostics p = progs[icol];
+    const mam4::Diagnostics d = diags[icol];
+    const mam4::Tendencies dqdt = tends[icol];
+    Kokkos::parallel_for(
+        "Load multi-column views", 1, KOKKOS_LAMBDA(const int) {
+          mc_atm(icol) = atm;
+          mc_sfc(icol) = sfc;
+          mc_progs(icol) = p;
+          mc_diags(icol) = d;
+          mc_tends(icol) = dqdt;
+        });
+  }
+
+  // nucleation runs twice, so the second one depends on the state left by
+  // the first, and ice nucleation depends on the aerosols both of them update
+  mam4::AeroConfig mam4_config;
+  mam4::NucleateIceProcess nucleate_ice(mam4_config);
+  mam4::NucleationProcess nucleation(mam4_config);
+  ProcessScheduler<NucleationProcess, NucleationProcess, NucleateIceProcess>
+      scheduler(nucleation, nucleation, nucleate_ice);
+  REQUIRE(scheduler.num_stages() == 3);
+  REQUIRE(scheduler.stage_writes(0) ==
+          (field::interstitial_aerosols | field::gases));
+  REQUIRE(scheduler.stage_writes(2) == 0);
+
+  // all processes in one dispatch over all columns
+  const Real t = 0.0, dt = 30.0;
+  scheduler.compute_tendencies(ncol, t, dt, mc_atm, mc_sfc, mc_progs, mc_diags,
+                               mc_tends);
+
+  // the same processes dispatched one by one on a single column, applying the
+  // tendencies of each one before running the next
+  mam4::Prognostics ref_progs = create_progs();
+  mam4::Diagnostics ref_diags = mam4::testing::create_diagnostics(nlev);
+  mam4::Tendencies ref_tends = mam4::testing::create_tendencies(nlev);
+  auto team_policy = ThreadTeamPolicy(1u, Kokkos::AUTO);
+  auto apply_tendencies = [&]() {
+    Kokkos::parallel_for(
+        nlev, KOKKOS_LAMBDA(const int k) {
+          for (int m = 0; m < AeroConfig::num_modes(); ++m) {
+            ref_progs.n_mode_i[m](k) += dt * ref_tends.n_mode_i[m](k);
+            ref_tends.n_mode_i[m](k) = 0;
+            for (int s = 0; s < num_species_mode(m); ++s) {
+              ref_progs.q_aero_i[m][s](k) += dt * ref_tends.q_aero_i[m][s](k);
+              ref_tends.q_aero_i[m][s](k) = 0;
+            }
+          }
+          for (int g = 0; g < AeroConfig::num_gas_ids(); ++g) {
+            ref_progs.q_gas[g](k) += dt * ref_tends.q_gas[g](k);
+            ref_tends.q_gas[g](k) = 0;
+          }
+        });
+  };
+  for (int i = 0; i < 2; ++i) {
+    Kokkos::parallel_for(
+        team_policy, KOKKOS_LAMBDA(const ThreadTeam &team) {
+          nucleation.compute_tendencies(team, t, dt, atm, sfc, ref_progs,
+                                        ref_diags, ref_tends);
+        });
+    apply_tendencies();
+  }
+  Kokkos::parallel_for(
+      team_policy, KOKKOS_LAMBDA(const ThreadTeam &team) {
+        nucleate_ice.compute_tendencies(team, t, dt, atm, sfc, ref_progs,
+                                        ref_diags, ref_tends);
+      });
+
+  auto same_values = [&](const ColumnView a, const ColumnView b) {
+    auto h_a = Kokkos::create_mirror_view(a);
+    auto h_b = Kokkos::create_mirror_view(b);
+    Kokkos::deep_copy(h_a, a);
+    Kokkos::deep_copy(h_b, b);
+    for (int k = 0; k < nlev; ++k) {
+      if (h_a(k) != h_b(k))
+        return false;
+    }
+    return true;
+  };
+  const int nait = static_cast<int>(ModeIndex::Aitken);
+  for (int icol = 0; icol < ncol; ++icol) {
+    logger.debug("checking column {}", icol);
+    REQUIRE(same_values(progs[icol].q_gas[ih2so4], ref_progs.q_gas[ih2so4]));
+    REQUIRE(same_values(progs[icol].n_mode_i[nait], ref_progs.n_mode_i[nait]));
+    REQUIRE(same_values(tends[icol].q_gas[ih2so4], ref_tends.q_gas[ih2so4]));
+    REQUIRE(same_values(tends[icol].n_mode_i[nait], ref_tends.n_mode_i[nait]));
+    REQUIRE(same_values(diags[icol].num_act_aerosol_ice_nucle,
+                        ref_diags.num_act_aerosol_ice_nucle));
+    REQUIRE(same_values(diags[icol].icenuc_num_depnuc,
+                        ref_diags.icenuc_num_depnuc));
+  }
+}
+
+TEST_CASE("test_in_place_process", "mam4_process_scheduler") {
+  // coagulation updates the prognostics in place, so the scheduler must not
+  // apply its tendencies again (nor pass them on to nucleation's stage)
+  REQUIRE(ProcessPrognosticUpdate<CoagulationProcess>::value() ==
+          PrognosticUpdate::in_place);
+  REQUIRE(ProcessPrognosticUpdate<NucleationProcess>::value() ==
+          PrognosticUpdate::tendencies_only);
+
+  const int nlev = 72;
+  const Real pblh = 1000;
+  Atmosphere atm = init_atm_const_tv_lapse_rate(nlev, pblh);
+  Surface sfc = mam4::testing::create_surface();
+  const int ih2so4 = static_cast<int>(GasId::H2SO4);
+  const int iso4 = static_cast<int>(AeroId::SO4);
+  const int nait = static_cast<int>(ModeIndex::Aitken);
+  const int nacc = static_cast<int>(ModeIndex::Accumulation);
+  const int ncor = static_cast<int>(ModeIndex::Coarse);
+  const int npca = static_cast<int>(ModeIndex::PrimaryCarbon);
+  const int ipom =
+      aerosol_index_for_mode(ModeIndex::PrimaryCarbon, AeroId::POM);
+  // particles of nominal sizes in every mode, which coagulate, and sulfuric
+  // acid, which nucleates
+  auto create_state = [&](mam4::Prognostics &progs, mam4::Diagnostics &diags) {
+    progs = mam4::testing::create_prognostics(nlev);
+    diags = mam4::testing::create_diagnostics(nlev);
+    Kokkos::deep_copy(progs.q_gas[ih2so4], 1.0e-9);
+    Kokkos::deep_copy(progs.n_mode_i[nait], 1.0e9);
+    Kokkos::deep_copy(progs.n_mode_i[nacc], 1.0e8);
+    Kokkos::deep_copy(progs.n_mode_i[ncor], 1.0e5);
+    Kokkos::deep_copy(progs.n_mode_i[npca], 1.0e8);
+    Kokkos::deep_copy(progs.q_aero_i[nait][iso4], 1.0e-10);
+    Kokkos::deep_copy(progs.q_aero_i[nacc][iso4], 1.0e-9);
+    Kokkos::deep_copy(progs.q_aero_i[ncor][iso4], 1.0e-9);
+    Kokkos::deep_copy(progs.q_aero_i[npca][ipom], 1.0e-10);
+    for (int m = 0; m < AeroConfig::num_modes(); ++m) {
+      Kokkos::deep_copy(diags.dry_geometric_mean_diameter_i[m],
+                        modes(m).nom_diameter);
+      Kokkos::deep_copy(diags.wet_geometric_mean_diameter_i[m],
+                        modes(m).nom_diameter);
+      Kokkos::deep_copy(diags.wet_density[m], mam4_density_so4);
+    }
+  };
+
+  mam4::AeroConfig mam4_config;
+  mam4::CoagulationProcess coagulation(mam4_config);
+  mam4::NucleationProcess nucleation(mam4_config);
+  ProcessScheduler<CoagulationProcess, NucleationProcess> scheduler(
+      coagulation, nucleation);
+  REQUIRE(scheduler.num_stages() == 2);
+  REQUIRE(scheduler.stage_writes(0) == 0);
+  REQUIRE(scheduler.stage_updates(0) == field::interstitial_aerosols);
+  REQUIRE(scheduler.stage_writes(1) ==
+          (field::interstitial_aerosols | field::gases));
+  REQUIRE(scheduler.stage_updates(1) == 0);
+
+  const Real t = 0.0, dt = 30.0;
+  auto team_policy = ThreadTeamPolicy(1u, Kokkos::AUTO);
+  mam4::Prognostics progs(nlev);
+  mam4::Diagnostics diags(nlev);
+  create_state(progs, diags);
+  mam4::Tendencies tends = mam4::testing::create_tendencies(nlev);
+  Kokkos::parallel_for(
+      team_policy, KOKKOS_LAMBDA(const ThreadTeam &team) {
+        scheduler.compute_tendencies(team, t, dt, atm, sfc, progs, diags,
+                                     tends);
+      });
+
+  // the processes called directly: coagulation leaves the prognostics at the
+  // end of its step, and only nucleation's tendencies are applied
+  mam4::Prognostics ref_progs(nlev);
+  mam4::Diagnostics ref_diags(nlev);
+  create_state(ref_progs, ref_diags);
+  mam4::Tendencies coag_tends = mam4::testing::create_tendencies(nlev);
+  mam4::Tendencies nuc_tends = mam4::testing::create_tendencies(nlev);
+  Kokkos::parallel_for(
+      team_policy, KOKKOS_LAMBDA(const ThreadTeam &team) {
+        coagulation.compute_tendencies(team, t, dt, atm, sfc, ref_progs,
+                                       ref_diags, coag_tends);
+      });
+  Kokkos::parallel_for(
+      team_policy, KOKKOS_LAMBDA(const ThreadTeam &team) {
+        nucleation.compute_tendencies(team, t, dt, atm, sfc, ref_progs,
+                                      ref_diags, nuc_tends);
+      });
+  Kokkos::parallel_for(
+      nlev, KOKKOS_LAMBDA(const int k) {
+        for (int m = 0; m < AeroConfig::num_modes(); ++m) {
+          ref_progs.n_mode_i[m](k) += dt * nuc_tends.n_mode_i[m](k);
+          for (int s = 0; s < num_species_mode(m); ++s)
+            ref_progs.q_aero_i[m][s](k) += dt * nuc_tends.q_aero_i[m][s](k);
+        }
+        for (int g = 0; g < AeroConfig::num_gas_ids(); ++g)
+          ref_progs.q_gas[g](k) += dt * nuc_tends.q_gas[g](k);
+      });
+
+  auto values = [&](const ColumnView v) {
+    auto h_v = Kokkos::create_mirror_view(v);
+    Kokkos::deep_copy(h_v, v);
+    return h_v;
+  };
+  // coagulation moved aitken particles into the accumulation mode
+  auto coag_dn = values(coag_tends.n_mode_i[nait]);
+  REQUIRE(coag_dn(0) < 0);
+  for (int m = 0; m < AeroConfig::num_modes(); ++m) {
+    auto n = values(progs.n_mode_i[m]);
+    auto ref_n = values(ref_progs.n_mode_i[m]);
+    auto dn = values(tends.n_mode_i[m]);
+    for (int k = 0; k < nlev; ++k) {
+      REQUIRE(n(k) == ref_n(k));
+      REQUIRE(dn(k) == 0);
+    }
+    for (int s = 0; s < num_species_mode(m); ++s) {
+      auto q = values(progs.q_aero_i[m][s]);
+      auto ref_q = values(ref_progs.q_aero_i[m][s]);
+      auto dq = values(tends.q_aero_i[m][s]);
+      for (int k = 0; k < nlev; ++k) {
+        REQUIRE(q(k) == ref_q(k));
+        REQUIRE(dq(k) == 0);
+      }
+    }
+  }
+  auto q_h2so4 = values(progs.q_gas[ih2so4]);
+  auto ref_q_h2so4 = values(ref_progs.q_gas[ih2so4]);
+  for (int k = 0; k < nlev; ++k)
+    REQUIRE(q_h2so4(k) == ref_q_h2so4(k));
+}
+
+TEST_CASE("test_apply_tendencies", "mam4_process_scheduler") {
+  const int nlev = 72;
+  const Real dt = 30.0;
+  mam4::Prognostics progs = mam4::testing::create_prognostics(nlev);
+  mam4::Tendencies tends = mam4::testing::create_tendencies(nlev);
+  const int nait = static_cast<int>(ModeIndex::Aitken);
+  const int ih2so4 = static_cast<int>(GasId::H2SO4);
+  Kokkos::deep_copy(progs.n_mode_i[nait], 1.0e8);
+  Kokkos::deep_copy(progs.n_mode_c[nait], 1.0e7);
+  Kokkos::deep_copy(progs.q_gas[ih2so4], 1.0e-9);
+  Kokkos::deep_copy(tends.n_mode_i[nait], 1.0e5);
+  Kokkos::deep_copy(tends.n_mode_c[nait], 1.0e4);
+  Kokkos::deep_copy(tends.q_gas[ih2so4], -1.0e-12);
+
+  // only the tendencies of the given groups are applied and reset
+  Kokkos::parallel_for(
+      ThreadTeamPolicy(1u, Kokkos::AUTO),
+      KOKKOS_LAMBDA(const ThreadTeam &team) {
+        scheduler::apply_tendencies(
+            team, field::interstitial_aerosols | field::gases, dt, progs,
+            tends);
+      });
+
+  auto values = [&](const ColumnView v) {
+    auto h_v = Kokkos::create_mirror_view(v);
+    Kokkos::deep_copy(h_v, v);
+    return h_v;
+  };
+  auto n_i = values(progs.n_mode_i[nait]);
+  auto n_c = values(progs.n_mode_c[nait]);
+  auto q = values(progs.q_gas[ih2so4]);
+  auto dn_i = values(tends.n_mode_i[nait]);
+  auto dn_c = values(tends.n_mode_c[nait]);
+  auto dq = values(tends.q_gas[ih2so4]);
+  for (int k = 0; k < nlev; ++k) {
+    REQUIRE(n_i(k) == 1.0e8 + dt * 1.0e5);
+    REQUIRE(q(k) == 1.0e-9 - dt * 1.0e-12);
+    REQUIRE(dn_i(k) == 0.0);
+    REQUIRE(dq(k) == 0.0);
+    REQUIRE(n_c(k) == 1.0e7);
+    REQUIRE(dn_c(k) == 1.0e4);
+  }
+}
@@ -3,6 +3,7 @@
 // National Technology & Engineering Solutions of Sandia, LLC (NTESS)
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include "testing.hpp"
 #include <mam4xx/mam4.hpp>
 #include <mam4xx/utils.hpp>
 
@@ -69,3 +70,45 @@ TEST_CASE("test_compute_tail_fraction", "mam4_rename_process") {
                                       tail_fraction);
   CHECK(!isnan(tail_fraction));
 }
+
+TEST_CASE("test_skipped_levels", "mam4_rename_process") {
+  mam4::AeroConfig mam4_config;
+  mam4::RenameProcess process(mam4_config);
+
+  const int nlev = 72;
+  const Real pblh = 1000;
+  Atmosphere atm = mam4::testing::create_atmosphere(nlev, pblh);
+  Surface sfc = mam4::testing::create_surface();
+  mam4::Prognostics progs = mam4::testing::create_prognostics(nlev);
+  mam4::Diagnostics diags = mam4::testing::create_diagnostics(nlev);
+  mam4::Tendencies tends = mam4::testing::create_tendencies(nlev);
+
+  // The prognostics already include the growth given by the tendencies, so
+  // the Aitken sulfate of the lowest quarter of the column, small but above
+  // the smallest dry volume, is renamed although it grew from much more (a
+  // large negative tendency). The rest of the column holds none, although it
+  // grew (a positive tendency), and is skipped.
+  const int iait = static_cast<int>(mam4::ModeIndex::Aitken);
+  const int iso4 =
+      mam4::aerosol_index_for_mode(mam4::ModeIndex::Aitken, mam4::AeroId::SO4);
+  auto h_q = Kokkos::create_mirror_view(progs.q_aero_i[iait][iso4]);
+  auto h_dqdt = Kokkos::create_mirror_view(tends.q_aero_i[iait][iso4]);
+  for (int k = 0; k < nlev; ++k) {
+    h_q(k) = (k < nlev / 4) ? 1.0e-20 : 0.0;
+    h_dqdt(k) = (k < nlev / 4) ? -1.0e-10 : 1.0e-10;
+  }
+  Kokkos::deep_copy(progs.q_aero_i[iait][iso4], h_q);
+  Kokkos::deep_copy(tends.q_aero_i[iait][iso4], h_dqdt);
+
+  auto team_policy = ThreadTeamPolicy(1u, Kokkos::AUTO);
+  Real t = 0.0, dt = 30.0;
+  Kokkos::parallel_for(
+      team_policy, KOKKOS_LAMBDA(const ThreadTeam &team) {
+        process.compute_tendencies(team, t, dt, atm, sfc, progs, diags, tends);
+      });
+
+  auto h_num_skipped = Kokkos::create_mirror_view(diags.num_skipped_levels);
+  Kokkos::deep_copy(h_num_skipped, diags.num_skipped_levels);
+  REQUIRE(h_num_skipped(mam4::Diagnostics::rename_skipped_levels) ==
+          nlev - nlev / 4);
+}
@@ -432,3 +432,147 @@ TEST_CASE("fprecn_resusp_vs_fprec_evap_mpln(", "mam4_wet_deposition_process") {
 }
 });
 }
+
+TEST_CASE("bcscavcoef_table", "mam4_wet_deposition_process") {
+  const int num_modes = AeroConfig::num_modes();
+  Real scavimptblnum[aero_model::nimptblgrow_total][num_modes];
+  Real scavimptblvol[aero_model::nimptblgrow_total][num_modes];
+
+  // WetDeposition's mode parameters load the table generated at build time,
+  // which must be bitwise identical to the integrated one
+  Real dgnum_amode[num_modes], sigmag_amode[num_modes], density[num_modes];
+  aero_model::bcscavcoef_mode_parameters(dgnum_amode, sigmag_amode, density);
+  const aero_model::BcScavCoefTable &default_table =
+      aero_model::default_bcscavcoef_table();
+  REQUIRE(default_table.matches(dgnum_amode, sigmag_amode, density));
+  REQUIRE(&aero_model::bcscavcoef_table(dgnum_amode, sigmag_amode, density) ==
+          &default_table);
+  aero_model::modal_aero_bcscavcoef_init(dgnum_amode, sigmag_amode, density,
+                                         scavimptblnum, scavimptblvol);
+  for (int jgrow = 0; jgrow < aero_model::nimptblgrow_total; ++jgrow) {
+    for (int imode = 0; imode < num_modes; ++imode) {
+      REQUIRE(default_table.scavimptblnum[jgrow][imode] ==
+              scavimptblnum[jgrow][imode]);
+      REQUIRE(default_table.scavimptblvol[jgrow][imode] ==
+              scavimptblvol[jgrow][imode]);
+    }
+  }
+
+  // the table of other mode parameters is integrated once and shared by later
+  // callers
+  for (int i = 0; i < num_modes; ++i)
+    density[i] = mam4::mam4_density_so4;
+  const aero_model::BcScavCoefTable &table =
+      aero_model::bcscavcoef_table(dgnum_amode, sigmag_amode, density);
+  REQUIRE(&table != &default_table);
+  REQUIRE(&aero_model::bcscavcoef_table(dgnum_amode, sigmag_amode, density) ==
+          &table);
+  aero_model::modal_aero_bcscavcoef_init(dgnum_amode, sigmag_amode, density,
+                                         scavimptblnum, scavimptblvol);
+  for (int jgrow = 0; jgrow < aero_model::nimptblgrow_total; ++jgrow) {
+    for (int imode = 0; imode < num_modes; ++imode) {
+      REQUIRE(table.scavimptblnum[jgrow][imode] == scavimptblnum[jgrow][imode]);
+      REQUIRE(table.scavimptblvol[jgrow][imode] == scavimptblvol[jgrow][imode]);
+    }
+  }
+
+  // and so are the tables of further parameters
+  density[2] = mam4::mam4_density_dst;
+  const aero_model::BcScavCoefTable &dust_table =
+      aero_model::bcscavcoef_table(dgnum_amode, sigmag_amode, density);
+  REQUIRE(&dust_table != &table);
+  REQUIRE(dust_table.matches(dgnum_amode, sigmag_amode, density));
+  REQUIRE(!table.matches(dgnum_amode, sigmag_amode, density));
+}
+
+TEST_CASE("precipitation_free_levels", "mam4_wet_deposition_process") {
+  // columns without precipitation are skipped, and so are the levels above
+  // the highest precipitating level
+  const int nlev = mam4::nlev;
+  const int gas_pcnst = 40;
+  Atmosphere atm = mam4::testing::create_atmosphere(nlev, 1000);
+  Surface sfc = mam4::testing::create_surface();
+  mam4::Prognostics progs = mam4::testing::create_prognostics(nlev);
+  mam4::Diagnostics diags = mam4::testing::create_diagnostics(nlev);
+  mam4::Tendencies tends = mam4::testing::create_tendencies(nlev);
+  mam4::AeroConfig aero_config;
+  mam4::WetDeposition wetdep;
+  wetdep.init(aero_config, mam4::WetDeposition::Config());
+
+  ColumnView *columns[] = {
+      &diags.deep_convective_cloud_fraction,
+      &diags.shallow_convective_cloud_fraction,
+      &diags.deep_convective_cloud_condensate,
+      &diags.shallow_convective_cloud_condensate,
+      &diags.deep_convective_precipitation_production,
+      &diags.shallow_convective_precipitation_production,
+      &diags.deep_convective_precipitation_evaporation,
+      &diags.shallow_convective_precipitation_evaporation,
+      &diags.total_convective_detrainment,
+      &diags.evaporation_of_falling_precipitation,
+      &diags.aerosol_wet_deposition_interstitial,
+      &diags.aerosol_wet_deposition_cloud_water};
+  for (ColumnView *column : columns) {
+    *column = mam4::testing::create_column_view(nlev);
+    Kokkos::deep_copy(*column, 0.0);
+  }
+  for (int i = 0; i < AeroConfig::num_modes(); ++i)
+    Kokkos::deep_copy(diags.wet_geometric_mean_diameter_i[i],
+                      modes(i).nom_diameter);
+  ColumnView q = mam4::testing::create_column_view(nlev * gas_pcnst);
+  ColumnView dqdt = mam4::testing::create_column_view(nlev * gas_pcnst);
+  Kokkos::deep_copy(q, 1.0e-9);
+  diags.tracer_mixing_ratio =
+      Diagnostics::ColumnTracerView(q.data(), nlev, gas_pcnst);
+  diags.d_tracer_mixing_ratio_dt =
+      Diagnostics::ColumnTracerView(dqdt.data(), nlev, gas_pcnst);
+
+  const Real t = 0, dt = 3600;
+  auto run = [&]() {
+    Kokkos::deep_copy(dqdt, 1.0e-12);
+    Kokkos::deep_copy(diags.aerosol_wet_deposition_interstitial, 1.0);
+    Kokkos::deep_copy(diags.aerosol_wet_deposition_cloud_water, 1.0);
+    Kokkos::parallel_for(
+        ThreadTeamPolicy(1u, 1u), KOKKOS_LAMBDA(const ThreadTeam &team) {
+          wetdep.compute_tendencies(aero_config, team, t, dt, atm, sfc, progs,
+                                    diags, tends);
+        });
+    Kokkos::fence();
+  };
+
+  // a dry column leaves the tendencies alone and deposits nothing
+  run();
+  auto h_dqdt = Kokkos::create_mirror_view(dqdt);
+  auto h_aerdepwetis =
+      Kokkos::create_mirror_view(diags.aerosol_wet_deposition_interstitial);
+  auto h_skipped_columns =
+      Kokkos::create_mirror_view(diags.num_skipped_columns);
+  auto h_skipped_levels = Kokkos::create_mirror_view(diags.num_skipped_levels);
+  Kokkos::deep_copy(h_dqdt, dqdt);
+  Kokkos::deep_copy(h_aerdepwetis, diags.aerosol_wet_deposition_interstitial);
+  Kokkos::deep_copy(h_skipped_columns, diags.num_skipped_columns);
+  Kokkos::deep_copy(h_skipped_levels, diags.num_skipped_levels);
+  for (int i = 0; i < nlev * gas_pcnst; ++i)
+    REQUIRE(h_dqdt(i) == 1.0e-12);
+  for (int k = 0; k < nlev; ++k)
+    REQUIRE(h_aerdepwetis(k) == 0.0);
+  REQUIRE(h_skipped_columns(Diagnostics::wetdep_skipped_columns) == 1);
+  REQUIRE(h_skipped_levels(Diagnostics::wetdep_skipped_levels) == 0);
+
+  // deep convection rains out in the lower half of the column only
+  const int ktop = nlev / 2;
+  ColumnView rprddp = diags.deep_convective_precipitation_production;
+  auto h_rprddp = Kokkos::create_mirror_view(rprddp);
+  for (int k = 0; k < nlev; ++k)
+    h_rprddp(k) = (k < ktop) ? 0.0 : 1.0e-8;
+  Kokkos::deep_copy(rprddp, h_rprddp);
+  Kokkos::deep_copy(diags.deep_convective_cloud_fraction, 0.1);
+  run();
+  Kokkos::deep_copy(h_dqdt, dqdt);
+  Kokkos::deep_copy(h_skipped_columns, diags.num_skipped_columns);
+  Kokkos::deep_copy(h_skipped_levels, diags.num_skipped_levels);
+  for (int i = 0; i < ktop * gas_pcnst; ++i)
+    REQUIRE(h_dqdt(i) == 1.0e-12);
+  REQUIRE(h_skipped_columns(Diagnostics::wetdep_skipped_columns) == 1);
+  REQUIRE(h_skipped_levels(Diagnostics::wetdep_skipped_levels) == ktop);
+}
@@ -12,7 +12,9 @@
 #include <mam4xx/mam4_types.hpp>
 #include <mam4xx/mode_dry_particle_size.hpp>
 #include <mam4xx/mode_hygroscopicity.hpp>
+#include <mam4xx/mode_size_state.hpp>
 #include <mam4xx/mode_wet_particle_size.hpp>
+#include <mam4xx/water_uptake.hpp>
 
 #include <haero/atmosphere.hpp>
 #include <haero/floating_point.hpp>
@@ -22,6 +24,8 @@
 #include <ekat/logging/ekat_logger.hpp>
 #include <ekat/mpi/ekat_comm.hpp>
 
+#include <vector>
+
 using namespace mam4;
 
 TEST_CASE("modal_averages", "") {
@@ -256,4 +260,145 @@ TEST_CASE("modal_averages", "") {
     }
 
   } // section wet particle size
+
+  SECTION("mode size state") {
+    // the lognormal factors match the conversions they replace
+    const ModeLognormalFactors factors;
+    for (int m = 0; m < 4; ++m) {
+      const Real vol = 1e-21;
+      const Real diam = conversions::mean_particle_diameter_from_volume(
+          vol, modes(m).mean_std_dev);
+      REQUIRE(FloatingPoint<Real>::equiv(factors.diameter_from_volume(m, vol),
+                                         diam));
+      REQUIRE(FloatingPoint<Real>::equiv(
+          factors.volume_from_diameter(m, diam),
+          conversions::mean_particle_volume_from_diameter(
+              diam, modes(m).mean_std_dev)));
+    }
+
+    // dry volumes and hygroscopicities, with species properties by AeroId,
+    // and diameters kept within the bounds of each mode as in CalcSize
+    auto bounded = [](const int m, const Real diam) {
+      return haero::min(haero::max(diam, modes(m).min_diameter),
+                        modes(m).max_diameter);
+    };
+    Real dry_diam[4], dry_diam_total[4], hygro[4], dry_density[4];
+    for (int m = 0; m < 4; ++m) {
+      Real dry_vol = 0.0, hyg = 0.0;
+      for (int s = 0; s < num_species_mode(m); ++s) {
+        const AeroSpecies species =
+            aero_species(static_cast<int>(mode_aero_species(m, s)));
+        dry_vol += mass_mixing_ratio / species.density;
+        hyg += mass_mixing_ratio * species.hygroscopicity / species.density;
+      }
+      const Real mean_vol = dry_vol / number_mixing_ratio;
+      dry_diam[m] =
+          bounded(m, conversions::mean_particle_diameter_from_volume(
+                         mean_vol, modes(m).mean_std_dev));
+      dry_diam_total[m] =
+          bounded(m, conversions::mean_particle_diameter_from_volume(
+                         2 * mean_vol, modes(m).mean_std_dev));
+      hygro[m] = hyg / dry_vol;
+      dry_density[m] = num_species_mode(m) * mass_mixing_ratio / dry_vol;
+    }
+
+    // a humid column, as above
+    const Real Tv0 = 300;
+    const Real Gammav = 0.01;
+    const Real qv0 = 0.015;
+    const Real qv1 = 7.5e-4;
+    const Real pblh = 0;
+    Atmosphere atm =
+        init_atm_const_tv_lapse_rate(nlev, pblh, Tv0, Gammav, qv0, qv1);
+    Surface sfc = testing::create_surface();
+    Tendencies tends = testing::create_tendencies(nlev);
+
+    const AeroConfig aero_config;
+    ModeSize process;
+    process.init(aero_config);
+    Kokkos::parallel_for(
+        haero::ThreadTeamPolicy(1u, Kokkos::AUTO),
+        KOKKOS_LAMBDA(const ThreadTeam &team) {
+          process.compute_tendencies(aero_config, team, 0, 0, atm, sfc, progs,
+                                     diags, tends);
+        });
+
+    std::vector<Real> state_wet_diam[4], state_wet_density[4];
+    for (int m = 0; m < 4; ++m) {
+      auto h_diam_i =
+          Kokkos::create_mirror_view(diags.dry_geometric_mean_diameter_i[m]);
+      auto h_diam_total = Kokkos::create_mirror_view(
+          diags.dry_geometric_mean_diameter_total[m]);
+      auto h_hyg = Kokkos::create_mirror_view(diags.hygroscopicity[m]);
+      auto h_wet_diam =
+          Kokkos::create_mirror_view(diags.wet_geometric_mean_diameter_i[m]);
+      auto h_wet_density = Kokkos::create_mirror_view(diags.wet_density[m]);
+      Kokkos::deep_copy(h_diam_i, diags.dry_geometric_mean_diameter_i[m]);
+      Kokkos::deep_copy(h_diam_total,
+                        diags.dry_geometric_mean_diameter_total[m]);
+      Kokkos::deep_copy(h_hyg, diags.hygroscopicity[m]);
+      Kokkos::deep_copy(h_wet_diam, diags.wet_geometric_mean_diameter_i[m]);
+      Kokkos::deep_copy(h_wet_density, diags.wet_density[m]);
+
+      const Real rho_h2o = Constants::density_h2o;
+      for (int k = 0; k < nlev; ++k) {
+        REQUIRE(FloatingPoint<Real>::equiv(h_diam_i(k), dry_diam[m]));
+        REQUIRE(FloatingPoint<Real>::equiv(h_diam_total(k), dry_diam_total[m]));
+        REQUIRE(FloatingPoint<Real>::equiv(h_hyg(k), hygro[m]));
+        REQUIRE(h_wet_diam(k) >= h_diam_i(k));
+        state_wet_diam[m].push_back(h_wet_diam(k));
+        state_wet_density[m].push_back(h_wet_density(k));
+        if (h_wet_diam(k) == h_diam_i(k)) {
+          REQUIRE(h_wet_density(k) == Approx(dry_density[m]));
+        } else {
+          // water dilutes the particles toward its own density
+          REQUIRE(haero::min(rho_h2o, dry_density[m]) < h_wet_density(k));
+          REQUIRE(h_wet_density(k) < haero::max(rho_h2o, dry_density[m]));
+        }
+      }
+    }
+
+    // water uptake from the state gives the wet diameters of water uptake
+    // from the diagnostics
+    Kokkos::parallel_for(
+        "compute_wet_particle_size", nlev, KOKKOS_LAMBDA(const int k) {
+          mode_avg_wet_particle_diam_water_uptake(diags, atm, k);
+        });
+    for (int m = 0; m < 4; ++m) {
+      auto h_wet_diam =
+          Kokkos::create_mirror_view(diags.wet_geometric_mean_diameter_i[m]);
+      Kokkos::deep_copy(h_wet_diam, diags.wet_geometric_mean_diameter_i[m]);
+      for (int k = 0; k < nlev; ++k)
+        REQUIRE(h_wet_diam(k) == state_wet_diam[m][k]);
+    }
+
+    // the water uptake process, run on the dry diameters ModeSize leaves in
+    // the diagnostics, gives the same wet sizes from the shared state
+    ModeSize::Config dry_config;
+    dry_config.water_uptake = false;
+    ModeSize dry_process;
+    dry_process.init(aero_config, dry_config);
+    Water_Uptake water_uptake;
+    water_uptake.init(aero_config);
+    Kokkos::parallel_for(
+        haero::ThreadTeamPolicy(1u, Kokkos::AUTO),
+        KOKKOS_LAMBDA(const ThreadTeam &team) {
+          dry_process.compute_tendencies(aero_config, team, 0, 0, atm, sfc,
+                                         progs, diags, tends);
+          team.team_barrier();
+          water_uptake.compute_tendencies(aero_config, team, 0, 0, atm, sfc,
+                                          progs, diags, tends);
+        });
+    for (int m = 0; m < 4; ++m) {
+      auto h_wet_diam =
+          Kokkos::create_mirror_view(diags.wet_geometric_mean_diameter_i[m]);
+      auto h_wet_density = Kokkos::create_mirror_view(diags.wet_density[m]);
+      Kokkos::deep_copy(h_wet_diam, diags.wet_geometric_mean_diameter_i[m]);
+      Kokkos::deep_copy(h_wet_density, diags.wet_density[m]);
+      for (int k = 0; k < nlev; ++k) {
+        REQUIRE(h_wet_diam(k) == state_wet_diam[m][k]);
+        REQUIRE(h_wet_density(k) == state_wet_density[m][k]);
+      }
+    }
+  } // section mode size state
 } // test case
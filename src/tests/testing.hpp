@@ -27,6 +27,12 @@ Prognostics create_prognostics(int num_levels);
 // pool
 Diagnostics create_diagnostics(int num_levels);
 
+// creates a Diagnostics object with the given number of vertical levels in
+// which only the views in the given groups of diagnostic fields are allocated
+// (see mam4::create_diagnostics), with column views from Haero's testing
+// column data pool
+Diagnostics create_diagnostics(int num_levels, FieldSet fields);
+
 // creates a Tendencies object with the given number of vertical levels and
 // a set of newly-allocated views, managed using Haero's testing column data
 // pool
@@ -17,11 +17,6 @@ void modal_aero_bcscavcoef_init(Ensemble *ensemble) {
     auto dgnum_amode = input.get_array("dgnum_amode");
     auto sigmag_amode = input.get_array("sigmag_amode");
 
-    Real scavimptblnum[aero_model::nimptblgrow_total][AeroConfig::num_modes()] =
-        {{}};
-    Real scavimptblvol[aero_model::nimptblgrow_total][AeroConfig::num_modes()] =
-        {{}};
-
     Real aerosol_dry_density[AeroConfig::num_modes()] = {};
     // Note: Original code uses the following aerosol densities.
     // sulfate, sulfate, dust, p-organic
@@ -30,16 +25,17 @@ void modal_aero_bcscavcoef_init(Ensemble *ensemble) {
     aerosol_dry_density[2] = mam4::mam4_density_dst;
     aerosol_dry_density[3] = mam4::mam4_density_pom;
 
-    aero_model::modal_aero_bcscavcoef_init(
-        dgnum_amode.data(), sigmag_amode.data(), aerosol_dry_density,
-        scavimptblnum, scavimptblvol);
+    // the table WetDeposition loads: the one generated at build time for its
+    // mode parameters, or the integrated one for other parameters
+    const aero_model::BcScavCoefTable &table = aero_model::bcscavcoef_table(
+        dgnum_amode.data(), sigmag_amode.data(), aerosol_dry_density);
     // Note:  scavimptblnum and scavimptblvol were written in row-major order.
     std::vector<Real> values_scavimptblvol;
     std::vector<Real> values_scavimptblnum;
     for (int imode = 0; imode < AeroConfig::num_modes(); ++imode) {
       for (int m = 0; m < aero_model::nimptblgrow_total; ++m) {
-        values_scavimptblnum.push_back(scavimptblnum[m][imode]);
-        values_scavimptblvol.push_back(scavimptblvol[m][imode]);
+        values_scavimptblnum.push_back(table.scavimptblnum[m][imode]);
+        values_scavimptblvol.push_back(table.scavimptblvol[m][imode]);
       }
     }
 
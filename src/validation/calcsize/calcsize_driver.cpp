@@ -6,6 +6,7 @@
 #include <mam4xx/calcsize.hpp>
 
 #include <iostream>
+#include <memory>
 #include <skywalker.hpp>
 #include <validation.hpp>
 
@@ -27,7 +28,7 @@ using namespace mam4;
 // Parameterizations used by the calcsize process.
 void compute_dry_volume_k(Ensemble *ensemble);
 void adjust_num_sizes(Ensemble *ensemble);
-void compute_tendencies(Ensemble *ensemble);
+void compute_tendencies(Ensemble *ensemble, validation::NpyWriter *npy_writer);
 void aitken_accum_exchange(Ensemble *ensemble);
 
 int main(int argc, char **argv) {
@@ -49,15 +50,31 @@ int main(int argc, char **argv) {
     exit(1);
   }
 
-  // Dispatch to the requested function.
+  // Outputs go to a Python module or, with "output_format: npy", are streamed
+  // to NumPy files instead, without being stored in the ensemble. Only
+  // compute_tendencies supports the latter.
   auto func_name = settings.get("function");
+  std::unique_ptr<validation::NpyWriter> npy_writer;
+  if (settings.has("output_format") && settings.get("output_format") == "npy") {
+    if (func_name == "compute_tendencies") {
+      npy_writer = std::make_unique<validation::NpyWriter>(
+          validation::npy_output_prefix(input_file));
+    } else {
+      std::cerr << argv[0] << ": " << func_name
+                << " does not support output_format: npy, writing a Python "
+                   "module instead"
+                << std::endl;
+    }
+  }
+
+  // Dispatch to the requested function.
   try {
     if (func_name == "compute_dry_volume") {
       compute_dry_volume_k(ensemble);
     } else if (func_name == "adjust_num_sizes") {
       adjust_num_sizes(ensemble);
     } else if (func_name == "compute_tendencies") {
-      compute_tendencies(ensemble);
+      compute_tendencies(ensemble, npy_writer.get());
     } else if (func_name == "aitken_accum_exchange") {
       aitken_accum_exchange(ensemble);
     }
@@ -65,9 +82,16 @@ int main(int argc, char **argv) {
     std::cerr << argv[0] << ": Error: " << e.what() << std::endl;
   }
 
-  // Write out a Python module.
-  std::cout << argv[0] << ": writing " << output_file << std::endl;
-  ensemble->write(output_file);
+  if (npy_writer) {
+    std::cout << argv[0] << ": writing "
+              << validation::npy_output_prefix(input_file) << "_*.npy"
+              << std::endl;
+    npy_writer->close();
+  } else {
+    // Write out a Python module.
+    std::cout << argv[0] << ": writing " << output_file << std::endl;
+    ensemble->write(output_file);
+  }
 
   // Clean up.
   delete ensemble;
@@ -13,139 +13,159 @@ using namespace skywalker;
 using namespace mam4;
 using namespace haero;
 
-void compute_tendencies(Ensemble *ensemble) {
+// This function runs the ensemble in batches of consecutive members, each a
+// single-level column with its own time step, which are processed with one
+// kernel launch per batch (see validation::BatchColumns). If given an
+// NpyWriter, it streams the outputs of each member to it as soon as the
+// member's batch completes, and neither keeps them nor stores them in the
+// ensemble; otherwise the outputs of all members are stored in the ensemble
+// (for the Python module) at the end.
+void compute_tendencies(Ensemble *ensemble, validation::NpyWriter *npy_writer) {
 
   // We don't need any settings for this particular test.
   // Settings settings = ensemble->settings();
 
-  // Run the ensemble.
-  ensemble->process([=](const Input &input, Output &output) {
-    // Fetch ensemble parameters
-
-    Real dt = input.get("dt");
-    Real t = 0;
-
-    int nlev = 1;
-    Real pblh = 1000;
-    Atmosphere atm = validation::create_atmosphere(nlev, pblh);
-    Surface sfc = validation::create_surface();
-    mam4::Prognostics progs = validation::create_prognostics(nlev);
-    mam4::Diagnostics diags = validation::create_diagnostics(nlev);
-    mam4::Tendencies tends = validation::create_tendencies(nlev);
-
-    mam4::AeroConfig mam4_config;
-    mam4::CalcSizeProcess process(mam4_config);
-    const auto nmodes = mam4_config.num_modes();
-
-    auto q_i = input.get_array("interstitial");
-    auto n_i = input.get_array("interstitial_num");
-    auto q_c = input.get_array("cloud_borne");
-    auto n_c = input.get_array("cloud_borne_num");
-
-    int count = 0;
-    for (int imode = 0; imode < nmodes; ++imode) {
-
-      auto h_prog_n_mode_i = Kokkos::create_mirror_view(progs.n_mode_i[imode]);
-      h_prog_n_mode_i(0) = n_i[imode];
-      Kokkos::deep_copy(progs.n_mode_i[imode], h_prog_n_mode_i);
-
-      auto h_prog_n_mode_c = Kokkos::create_mirror_view(progs.n_mode_c[imode]);
-      h_prog_n_mode_c(0) = n_c[imode];
-      Kokkos::deep_copy(progs.n_mode_c[imode], h_prog_n_mode_c);
-
-      const auto n_spec = num_species_mode(imode);
-      for (int isp = 0; isp < n_spec; ++isp) {
-        // correcting index for inputs.
-        const int isp_mam4xx =
-            validation::e3sm_to_mam4xx_aerosol_idx[imode][isp];
-        auto h_prog_aero_i =
-            Kokkos::create_mirror_view(progs.q_aero_i[imode][isp_mam4xx]);
-        h_prog_aero_i(0) = q_i[count];
-        Kokkos::deep_copy(progs.q_aero_i[imode][isp_mam4xx], h_prog_aero_i);
-
-        auto h_prog_aero_c =
-            Kokkos::create_mirror_view(progs.q_aero_c[imode][isp_mam4xx]);
-        h_prog_aero_c(0) = q_c[count];
-        Kokkos::deep_copy(progs.q_aero_c[imode][isp_mam4xx], h_prog_aero_c);
-
-        count++;
-      } // end species
-    }   // end modes
-
-    auto team_policy = ThreadTeamPolicy(1u, Kokkos::AUTO);
+  mam4::AeroConfig mam4_config;
+  const auto nmodes = mam4_config.num_modes();
+
+  // Outputs from e3sm are saved in 1D array of 21 inputs.
+  int total_number_of_species = 0;
+  for (int imode = 0; imode < nmodes; ++imode) {
+    total_number_of_species += num_species_mode(imode);
+  } // end mode
+
+  // Gather the inputs of all members.
+  std::vector<Real> dt_values;
+  std::vector<std::vector<Real>> q_i, n_i, q_c, n_c;
+  ensemble->process([&](const Input &input, Output &output) {
+    dt_values.push_back(input.get("dt"));
+    q_i.push_back(input.get_array("interstitial"));
+    n_i.push_back(input.get_array("interstitial_num"));
+    q_c.push_back(input.get_array("cloud_borne"));
+    n_c.push_back(input.get_array("cloud_borne_num"));
+  });
+  const int num_members = static_cast<int>(dt_values.size());
+
+  // outputs of all members, kept for the ensemble unless they are streamed
+  std::vector<std::vector<Real>> tend_aero_i_out, tend_aero_c_out;
+  std::vector<std::vector<Real>> tend_n_mode_i_out, tend_n_mode_c_out;
+  std::vector<std::vector<Real>> diags_dgncur_i;
+
+  // one single-level column per member
+  const int nlev = 1;
+  const Real pblh = 1000;
+  validation::BatchColumns columns(nlev, pblh,
+                                   fields_accessed<mam4::CalcSizeProcess>());
+  const auto atm = columns.atm;
+  const auto sfc = columns.sfc;
+  const auto progs = columns.progs;
+  const auto diags = columns.diags;
+  const auto tends = columns.tends;
+  DeviceType::view_1d<Real> dt("dt", validation::max_batch_size);
+  auto h_dt = Kokkos::create_mirror_view(dt);
+  const Real t = 0;
+  mam4::CalcSizeProcess process(mam4_config);
+
+  for (const validation::MemberBatch &batch :
+       validation::member_batches(num_members)) {
+    columns.pool.zero_host();
+    for (int icol = 0; icol < batch.size(); ++icol) {
+      const int member = batch.begin + icol;
+      const mam4::Prognostics &p = columns.h_progs(icol);
+      h_dt(icol) = dt_values[member];
+      int count = 0;
+      for (int imode = 0; imode < nmodes; ++imode) {
+        *columns.pool.host(p.n_mode_i[imode]) = n_i[member][imode];
+        *columns.pool.host(p.n_mode_c[imode]) = n_c[member][imode];
+
+        const auto n_spec = num_species_mode(imode);
+        for (int isp = 0; isp < n_spec; ++isp) {
+          // correcting index for inputs.
+          const int isp_mam4xx =
+              validation::e3sm_to_mam4xx_aerosol_idx[imode][isp];
+          *columns.pool.host(p.q_aero_i[imode][isp_mam4xx]) =
+              q_i[member][count];
+          *columns.pool.host(p.q_aero_c[imode][isp_mam4xx]) =
+              q_c[member][count];
+          count++;
+        } // end species
+      }   // end modes
+    }
+    columns.pool.copy_to_device();
+    Kokkos::deep_copy(dt, h_dt);
+
+    auto team_policy = ThreadTeamPolicy(batch.size(), Kokkos::AUTO);
     Kokkos::parallel_for(
         team_policy, KOKKOS_LAMBDA(const ThreadTeam &team) {
-          process.compute_tendencies(team, t, dt, atm, sfc, progs, diags,
-                                     tends);
+          const int icol = team.league_rank();
+          process.compute_tendencies(team, t, dt(icol), atm(icol), sfc(icol),
+                                     progs(icol), diags(icol), tends(icol));
         });
-
-    // Outputs from e3sm are saved in 1D array of 21 inputs.
-    int total_number_of_species = 0;
-    for (int imode = 0; imode < nmodes; ++imode) {
-      total_number_of_species += num_species_mode(imode);
-    } // end mode
-
-    std::vector<Real> tend_aero_i_out(total_number_of_species, -1);
-    std::vector<Real> tend_n_mode_i_out;
-
-    std::vector<Real> tend_aero_c_out(total_number_of_species, -1);
-    std::vector<Real> tend_n_mode_c_out;
-
-    std::vector<Real> diags_dgncur_i;
-    std::vector<Real> diags_dgncur_c;
-
-    int count_species = 0;
-    for (int imode = 0; imode < nmodes; ++imode) {
-
-      auto h_tend_num_i = Kokkos::create_mirror_view(tends.n_mode_i[imode]);
-      Kokkos::deep_copy(h_tend_num_i, tends.n_mode_i[imode]);
-      tend_n_mode_i_out.push_back(h_tend_num_i(0));
-
-      auto h_tend_num_c = Kokkos::create_mirror_view(tends.n_mode_c[imode]);
-      Kokkos::deep_copy(h_tend_num_c, tends.n_mode_c[imode]);
-      tend_n_mode_c_out.push_back(h_tend_num_c(0));
-
-      const auto n_spec = num_species_mode(imode);
-      for (int isp = 0; isp < n_spec; ++isp) {
-
-        // save outputs using the same indexing from e3sm.
-        const int isp_mam4xx =
-            count_species + validation::mam4xx_to_e3sm_aerosol_idx[imode][isp];
-
-        auto h_tend_aero_i =
-            Kokkos::create_mirror_view(tends.q_aero_i[imode][isp]);
-        Kokkos::deep_copy(h_tend_aero_i, tends.q_aero_i[imode][isp]);
-        tend_aero_i_out[isp_mam4xx] = h_tend_aero_i(0);
-
-        auto h_tend_aero_c =
-            Kokkos::create_mirror_view(tends.q_aero_c[imode][isp]);
-        Kokkos::deep_copy(h_tend_aero_c, tends.q_aero_c[imode][isp]);
-        tend_aero_c_out[isp_mam4xx] = h_tend_aero_c(0);
-      } // end species
-      count_species += n_spec;
-
-      // diameter interstitial
-      auto h_dgncur_i = Kokkos::create_mirror_view(
-          diags.dry_geometric_mean_diameter_i[imode]);
-      Kokkos::deep_copy(h_dgncur_i, diags.dry_geometric_mean_diameter_i[imode]);
-      diags_dgncur_i.push_back(h_dgncur_i(0));
-
-      // diameter cloud_borne
-      auto h_dgncur_c = Kokkos::create_mirror_view(
-          diags.dry_geometric_mean_diameter_c[imode]);
-      Kokkos::deep_copy(h_dgncur_c, diags.dry_geometric_mean_diameter_c[imode]);
-      diags_dgncur_c.push_back(h_dgncur_c(0));
-
-    } // end mode
-
-    output.set("interstitial_ptend", tend_aero_i_out);
-    output.set("interstitial_ptend_num", tend_n_mode_i_out);
-
-    output.set("cloud_borne_ptend_num", tend_n_mode_c_out);
-    output.set("cloud_borne_ptend", tend_aero_c_out);
-
-    output.set("diameter", diags_dgncur_i);
+    columns.pool.copy_to_host();
+
+    for (int icol = 0; icol < batch.size(); ++icol) {
+      const mam4::Tendencies &dqdt = columns.h_tends(icol);
+      const mam4::Diagnostics &d = columns.h_diags(icol);
+      std::vector<Real> tend_aero_i(total_number_of_species, -1);
+      std::vector<Real> tend_aero_c(total_number_of_species, -1);
+      std::vector<Real> tend_n_mode_i, tend_n_mode_c, dgncur_i;
+      int count_species = 0;
+      for (int imode = 0; imode < nmodes; ++imode) {
+        tend_n_mode_i.push_back(*columns.pool.host(dqdt.n_mode_i[imode]));
+        tend_n_mode_c.push_back(*columns.pool.host(dqdt.n_mode_c[imode]));
+        // diameter interstitial
+        dgncur_i.push_back(
+            *columns.pool.host(d.dry_geometric_mean_diameter_i[imode]));
+
+        const auto n_spec = num_species_mode(imode);
+        for (int isp = 0; isp < n_spec; ++isp) {
+          // save outputs using the same indexing from e3sm.
+          const int isp_mam4xx =
+              count_species +
+              validation::mam4xx_to_e3sm_aerosol_idx[imode][isp];
+          tend_aero_i[isp_mam4xx] =
+              *columns.pool.host(dqdt.q_aero_i[imode][isp]);
+          tend_aero_c[isp_mam4xx] =
+              *columns.pool.host(dqdt.q_aero_c[imode][isp]);
+        } // end species
+        count_species += n_spec;
+      } // end mode
+
+      if (npy_writer) {
+        // stream the member's outputs as soon as they are available
+        npy_writer->append("interstitial_ptend", tend_aero_i);
+        npy_writer->append("interstitial_ptend_num", tend_n_mode_i);
+        npy_writer->append("cloud_borne_ptend_num", tend_n_mode_c);
+        npy_writer->append("cloud_borne_ptend", tend_aero_c);
+        npy_writer->append("diameter", dgncur_i);
+      } else {
+        // members are processed in order
+        tend_aero_i_out.push_back(std::move(tend_aero_i));
+        tend_aero_c_out.push_back(std::move(tend_aero_c));
+        tend_n_mode_i_out.push_back(std::move(tend_n_mode_i));
+        tend_n_mode_c_out.push_back(std::move(tend_n_mode_c));
+        diags_dgncur_i.push_back(std::move(dgncur_i));
+      }
+    }
+  }
+
+  // the streamed outputs are not written to a Python module
+  if (npy_writer) {
+    return;
+  }
+
+  // Scatter the outputs to the members.
+  int member = 0;
+  ensemble->process([&](const Input &input, Output &output) {
+    output.set("interstitial_ptend", tend_aero_i_out[member]);
+    output.set("interstitial_ptend_num", tend_n_mode_i_out[member]);
+
+    output.set("cloud_borne_ptend_num", tend_n_mode_c_out[member]);
+    output.set("cloud_borne_ptend", tend_aero_c_out[member]);
+
+    output.set("diameter", diags_dgncur_i[member]);
 
     // add more outputs (diagnostics)
+    ++member;
   });
 }
@@ -21,14 +21,12 @@ void get_input(const Input &input, const std::string &name, const int size,
     host_view[n] = host[n];
   Kokkos::deep_copy(dev, host_view);
 }
-void get_input(
-    const Input &input, const std::string &name, const int rows, const int cols,
-    std::vector<Real> &host,
-    Kokkos::View<Real * [ConvProc::pcnst_extd], Kokkos::MemoryUnmanaged> &dev) {
+void get_input(const Input &input, const std::string &name, const int rows,
+               const int cols, std::vector<Real> &host,
+               convproc::Kokkos_2D_View &dev) {
   host = input.get_array(name);
   ColumnView col_view = mam4::validation::create_column_view(rows * cols);
-  dev = Kokkos::View<Real * [ConvProc::pcnst_extd], Kokkos::MemoryUnmanaged>(
-      col_view.data(), rows, cols);
+  dev = convproc::Kokkos_2D_View(col_view.data(), rows, cols);
   EKAT_ASSERT(host.size() == rows * cols);
   {
     std::vector<std::vector<Real>> matrix(rows, std::vector<Real>(cols));
@@ -77,9 +75,8 @@ void compute_column_tendency(Ensemble *ensemble) {
     std::vector<Real> dconudt_activa_host, dconudt_wetdep_host,
         dcondt_resusp_host, dcondt_prevap_host, dcondt_prevap_hist_host,
         fa_u_host, dpdry_i_host;
-    Kokkos::View<Real *[pcnst_extd], Kokkos::MemoryUnmanaged>
-        dconudt_activa_dev, dconudt_wetdep_dev, dcondt_resusp_dev,
-        dcondt_prevap_dev, dcondt_prevap_hist_dev;
+    convproc::Kokkos_2D_View dconudt_activa_dev, dconudt_wetdep_dev,
+        dcondt_resusp_dev, dcondt_prevap_dev, dcondt_prevap_hist_dev;
     ColumnView fa_u_dev, dpdry_i_dev;
     get_input(input, "dconudt_activa", nlevp, pcnst_extd, dconudt_activa_host,
               dconudt_activa_dev);
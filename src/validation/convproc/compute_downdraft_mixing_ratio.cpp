@@ -24,15 +24,13 @@ void get_input(const Input &input, const std::string &name, const int size,
     host_view[n] = host[n];
   Kokkos::deep_copy(dev, host_view);
 }
-void get_input(
-    const Input &input, const std::string &name, const int rows, const int cols,
-    std::vector<Real> &host,
-    Kokkos::View<Real * [ConvProc::pcnst_extd], Kokkos::MemoryUnmanaged> &dev) {
+void get_input(const Input &input, const std::string &name, const int rows,
+               const int cols, std::vector<Real> &host,
+               convproc::Kokkos_2D_View &dev) {
   host = input.get_array(name);
   EKAT_ASSERT(host.size() == rows * cols);
   ColumnView col_view = mam4::validation::create_column_view(rows * cols);
-  dev = Kokkos::View<Real **, Kokkos::MemoryUnmanaged>(col_view.data(), rows,
-                                                       cols);
+  dev = convproc::Kokkos_2D_View(col_view.data(), rows, cols);
   {
     std::vector<std::vector<Real>> matrix(rows, std::vector<Real>(cols));
     // Col Major layout
@@ -48,8 +46,7 @@ void get_input(
 }
 void set_output(Output &output, const std::string &name, const int rows,
                 const int cols, std::vector<Real> &host,
-                const Kokkos::View<Real * [ConvProc::pcnst_extd],
-                                   Kokkos::MemoryUnmanaged> &dev) {
+                const convproc::Kokkos_2D_View &dev) {
   host.resize(rows * cols);
   auto host_view = Kokkos::create_mirror_view(dev);
   Kokkos::deep_copy(host_view, dev);
@@ -76,8 +73,7 @@ void compute_downdraft_mixing_ratio(Ensemble *ensemble) {
     std::vector<Real> doconvproc_extd_host, md_i_host, eddp_host, gath_host,
         cond_host;
     ColumnView doconvproc_extd_dev, md_i_dev, eddp_dev;
-    Kokkos::View<Real *[pcnst_extd], Kokkos::MemoryUnmanaged> gath_dev,
-        cond_dev;
+    convproc::Kokkos_2D_View gath_dev, cond_dev;
 
     get_input(input, "doconvproc_extd", pcnst_extd, doconvproc_extd_host,
               doconvproc_extd_dev);
@@ -4,220 +4,131 @@
 // SPDX-License-Identifier: BSD-3-Clause
 
 #include "Kokkos_Core.hpp"
-#include <catch2/catch.hpp>
-#include <iomanip>
-#include <iostream>
 #include <mam4xx/convproc.hpp>
+#include <mam4xx/mam4.hpp>
 #include <skywalker.hpp>
 #include <validation.hpp>
 
 using namespace skywalker;
 using namespace mam4;
 
-namespace {
-void get_input(const Input &input, const std::string &name, const int size,
-               std::vector<Real> &host, ColumnView &dev) {
-  host = input.get_array(name);
-  dev = mam4::validation::create_column_view(size);
-
-  EKAT_ASSERT(host.size() == size);
-  auto host_view = Kokkos::create_mirror_view(dev);
-  for (int n = 0; n < size; ++n)
-    host_view[n] = host[n];
-  Kokkos::deep_copy(dev, host_view);
-}
-void get_input(const Input &input, const std::string &name, const int rows,
-               const int cols, std::vector<Real> &host,
-               Diagnostics::ColumnTracerView &dev) {
-  host = input.get_array(name);
-  ColumnView col_view = mam4::validation::create_column_view(rows * cols);
-  dev = Diagnostics::ColumnTracerView(col_view.data(), rows, cols);
-  EKAT_ASSERT(host.size() == rows * cols);
-  {
-    std::vector<std::vector<Real>> matrix(rows, std::vector<Real>(cols));
-    for (int j = 0, n = 0; j < cols; ++j)
-      for (int i = 0; i < rows; ++i, ++n)
-        matrix[i][j] = host[n];
-    auto host_view = Kokkos::create_mirror_view(dev);
-    for (int i = 0; i < rows; ++i)
-      for (int j = 0; j < cols; ++j)
-        host_view(i, j) = matrix[i][j];
-    Kokkos::deep_copy(dev, host_view);
-  }
-}
-void set_output(Output &output, const std::string &name, const int rows,
-                const int cols, std::vector<Real> &host,
-                const Diagnostics::ColumnTracerView &dev) {
-  host.resize(rows * cols);
-  auto host_view = Kokkos::create_mirror_view(dev);
-  Kokkos::deep_copy(host_view, dev);
-  for (int j = 0, n = 0; j < cols; ++j)
-    for (int i = 0; i < rows; ++i, ++n) {
-      host[n] = host_view(i, j);
-    }
-  output.set(name, host);
-}
-} // namespace
+// This function runs the ensemble in batches of consecutive members, each a
+// column with its own ConvProc (configured with the member's species classes,
+// and holding the column's work arrays), which are processed with one kernel
+// launch per batch (see validation::BatchColumns).
 void compute_tendencies(Ensemble *ensemble) {
   // We don't need any settings for this particular test.
   // Settings settings = ensemble->settings();
-  // Run the ensemble.
-  ensemble->process([=](const Input &input, Output &output) {
-    const int nlev = 72;
-    const int ktop = 47;
-    const int kbot = 71;
-    const Real t = 0;
-    const Real dt = 36000;
-    const Real pblh = 1000;
-    // const int pcnst_extd = ConvProc::pcnst_extd;
-    const int pcnst = ConvProc::gas_pcnst;
-    // Fetch ensemble parameters
-    // Convert to C++ index by subtracting one.
-    // ktop is jt(il1g) to jt(il2g) in Fortran
-    // but jt is just a scalar and il1g=il2g=48;
-    // kbot is mx(il1g) to jt(il2g) in Fortran
-    // but mx is just a scalar iand l1g=il2g=71;
+  const int nlev = 72;
+  const int ktop = 47;
+  const int kbot = 71;
+  const Real t = 0;
+  const Real dt = 36000;
+  const Real pblh = 1000;
+  // const int pcnst_extd = ConvProc::pcnst_extd;
+  const int pcnst = ConvProc::gas_pcnst;
+  // Fetch ensemble parameters
+  // Convert to C++ index by subtracting one.
+  // ktop is jt(il1g) to jt(il2g) in Fortran
+  // but jt is just a scalar and il1g=il2g=48;
+  // kbot is mx(il1g) to jt(il2g) in Fortran
+  // but mx is just a scalar iand l1g=il2g=71;
+  int mmtoo_prevap_resusp[pcnst];
+  {
+    const int resusp[pcnst] = {0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+                               0,  0,  0,  0,  0,  31, 33, 34, 32, 29,
+                               30, 35, -2, 31, 34, 30, 35, -2, 29, 30,
+                               31, 32, 33, 34, 35, -2, 33, 32, 35, -2};
+    for (int i = 0; i < pcnst; ++i)
+      mmtoo_prevap_resusp[i] = resusp[i] - 1;
+  }
+
+  // Gather the inputs of all members.
+  std::vector<Input> inputs;
+  ensemble->process([&](const Input &input, Output &output) {
     EKAT_ASSERT(input.get("dt") == 3600);
     EKAT_ASSERT(input.get("jt") == 72);
+    inputs.push_back(input);
+  });
+  const int num_members = static_cast<int>(inputs.size());
+  std::vector<std::vector<Real>> dqdt(num_members);
 
-    int mmtoo_prevap_resusp[pcnst];
-    {
-      const int resusp[pcnst] = {0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-                                 0,  0,  0,  0,  0,  31, 33, 34, 32, 29,
-                                 30, 35, -2, 31, 34, 30, 35, -2, 29, 30,
-                                 31, 32, 33, 34, 35, -2, 33, 32, 35, -2};
-      for (int i = 0; i < pcnst; ++i)
-        mmtoo_prevap_resusp[i] = resusp[i] - 1;
-    }
-
-    Atmosphere atmosphere = validation::create_atmosphere(nlev, pblh);
-    Surface surface = validation::create_surface();
-    mam4::Prognostics prognostics = validation::create_prognostics(nlev);
-    mam4::Diagnostics diagnostics = validation::create_diagnostics(nlev);
-    mam4::Tendencies tendencies = validation::create_tendencies(nlev);
-    mam4::AeroConfig aero_config;
-    mam4::ConvProc::Config convproc_config;
-    convproc_config.convproc_do_aer = true;
-    convproc_config.convproc_do_gas = false;
-    convproc_config.nlev = nlev;
-    convproc_config.ktop = ktop;
-    convproc_config.kbot = kbot;
-
-    std::vector<Real> species_class_host;
-    ColumnView species_class_dev;
-    get_input(input, "species_class", pcnst, species_class_host,
-              species_class_dev);
-    for (int i = 0; i < pcnst; ++i)
-      convproc_config.species_class[i] = species_class_host[i];
-    for (int i = 0; i < pcnst; ++i)
-      convproc_config.mmtoo_prevap_resusp[i] = mmtoo_prevap_resusp[i];
-
-    mam4::ConvProc convproc;
-    convproc.init(aero_config, convproc_config);
+  mam4::AeroConfig aero_config;
+  validation::BatchColumns columns(nlev, pblh,
+                                   fields_accessed<mam4::ConvProcProcess>());
+  const auto atm = columns.atm;
+  const auto progs = columns.progs;
+  const auto diags = columns.diags;
+  const auto tends = columns.tends;
+  DeviceType::view_1d<mam4::ConvProc> convproc("convproc",
+                                               validation::max_batch_size);
+  auto h_convproc = Kokkos::create_mirror_view(convproc);
 
-    diagnostics.hydrostatic_dry_dp = mam4::validation::create_column_view(nlev);
-    diagnostics.deep_convective_cloud_fraction =
-        mam4::validation::create_column_view(nlev);
-    diagnostics.shallow_convective_cloud_fraction =
-        mam4::validation::create_column_view(nlev);
-    diagnostics.deep_convective_cloud_condensate =
-        mam4::validation::create_column_view(nlev);
-    diagnostics.shallow_convective_cloud_condensate =
-        mam4::validation::create_column_view(nlev);
-    diagnostics.deep_convective_precipitation_production =
-        mam4::validation::create_column_view(nlev);
-    diagnostics.shallow_convective_precipitation_production =
-        mam4::validation::create_column_view(nlev);
-    diagnostics.deep_convective_precipitation_evaporation =
-        mam4::validation::create_column_view(nlev);
-    diagnostics.shallow_convective_precipitation_evaporation =
-        mam4::validation::create_column_view(nlev);
-    diagnostics.total_convective_detrainment =
-        mam4::validation::create_column_view(nlev);
-    diagnostics.shallow_convective_detrainment =
-        mam4::validation::create_column_view(nlev);
-    diagnostics.shallow_convective_ratio =
-        mam4::validation::create_column_view(nlev);
-    diagnostics.mass_entrain_rate_into_updraft =
-        mam4::validation::create_column_view(nlev);
-    diagnostics.mass_entrain_rate_into_downdraft =
-        mam4::validation::create_column_view(nlev);
-    diagnostics.mass_detrain_rate_from_updraft =
-        mam4::validation::create_column_view(nlev);
-    diagnostics.delta_pressure = mam4::validation::create_column_view(nlev);
-    auto mixing_ratio =
-        mam4::validation::create_column_view(nlev * ConvProc::gas_pcnst);
-    diagnostics.tracer_mixing_ratio = Diagnostics::ColumnTracerView(
-        mixing_ratio.data(), nlev, ConvProc::gas_pcnst);
-    auto mixing_ratio_dt =
-        mam4::validation::create_column_view(nlev * ConvProc::gas_pcnst);
-    diagnostics.d_tracer_mixing_ratio_dt = Diagnostics::ColumnTracerView(
-        mixing_ratio_dt.data(), nlev, ConvProc::gas_pcnst);
-    Kokkos::parallel_for(
-        "init_column_views", nlev, KOKKOS_LAMBDA(int i) {
-          diagnostics.hydrostatic_dry_dp[i] = 0;
-          diagnostics.deep_convective_cloud_fraction[i] = 0;
-          diagnostics.shallow_convective_cloud_fraction[i] = 0;
-          diagnostics.deep_convective_cloud_condensate[i] = 0;
-          diagnostics.shallow_convective_cloud_condensate[i] = 0;
-          diagnostics.deep_convective_precipitation_production[i] = 0;
-          diagnostics.shallow_convective_precipitation_production[i] = 0;
-          diagnostics.deep_convective_precipitation_evaporation[i] = 0;
-          diagnostics.shallow_convective_precipitation_evaporation[i] = 0;
-          diagnostics.total_convective_detrainment[i] = 0;
-          diagnostics.shallow_convective_detrainment[i] = 0;
-          diagnostics.shallow_convective_ratio[i] = 0;
-          diagnostics.mass_entrain_rate_into_updraft[i] = 0;
-          diagnostics.mass_entrain_rate_into_downdraft[i] = 0;
-          diagnostics.mass_detrain_rate_from_updraft[i] = 0;
-          diagnostics.delta_pressure[i] = 0;
-          for (int j = 0; j < ConvProc::gas_pcnst; ++j) {
-            diagnostics.tracer_mixing_ratio(i, j) = 0;
-            diagnostics.d_tracer_mixing_ratio_dt(i, j) = 0;
-          }
-        });
-    Kokkos::fence();
-    std::vector<Real> temperature_host, pmid_host, du_host, eu_host, ed_host,
-        dp_host, dpdry_host, cldfrac_host, icwmr_host, rprd_host, evapc_host,
-        dqdt_host;
-    ColumnView temperature_dev, pmid_dev;
+  for (const validation::MemberBatch &batch :
+       validation::member_batches(num_members)) {
+    columns.pool.zero_host();
+    for (int icol = 0; icol < batch.size(); ++icol) {
+      const Input &input = inputs[batch.begin + icol];
+      mam4::ConvProc::Config convproc_config;
+      convproc_config.convproc_do_aer = true;
+      convproc_config.convproc_do_gas = false;
+      convproc_config.nlev = nlev;
+      convproc_config.ktop = ktop;
+      convproc_config.kbot = kbot;
+      const std::vector<Real> species_class = input.get_array("species_class");
+      EKAT_ASSERT(species_class.size() == pcnst);
+      for (int i = 0; i < pcnst; ++i)
+        convproc_config.species_class[i] = species_class[i];
+      for (int i = 0; i < pcnst; ++i)
+        convproc_config.mmtoo_prevap_resusp[i] = mmtoo_prevap_resusp[i];
+      h_convproc(icol).init(aero_config, convproc_config);
 
-    get_input(input, "state_pdeldry", nlev, dpdry_host,
-              diagnostics.hydrostatic_dry_dp);
-    get_input(input, "state_t", nlev, temperature_host, temperature_dev);
-    atmosphere.temperature = temperature_dev;
-    get_input(input, "state_pmid", nlev, pmid_host, pmid_dev);
-    atmosphere.pressure = pmid_dev;
-    get_input(input, "dp_frac", nlev, cldfrac_host,
-              diagnostics.deep_convective_cloud_fraction);
-    get_input(input, "cldfrac", nlev, cldfrac_host,
-              diagnostics.total_convective_detrainment);
-    get_input(input, "icwmrdp", nlev, icwmr_host,
-              diagnostics.deep_convective_cloud_condensate);
-    get_input(input, "rprddp", nlev, rprd_host,
-              diagnostics.deep_convective_precipitation_production);
-    get_input(input, "evapcdp", nlev, evapc_host,
-              diagnostics.deep_convective_precipitation_evaporation);
-    get_input(input, "du", nlev, du_host,
-              diagnostics.mass_detrain_rate_from_updraft);
-    get_input(input, "eu", nlev, eu_host,
-              diagnostics.mass_entrain_rate_into_updraft);
-    get_input(input, "ed", nlev, ed_host,
-              diagnostics.mass_entrain_rate_into_downdraft);
-    get_input(input, "dp", nlev, dp_host, diagnostics.delta_pressure);
-    get_input(input, "qnew", nlev, pcnst, dp_host,
-              diagnostics.tracer_mixing_ratio);
+      const Atmosphere &a = columns.h_atm(icol);
+      const mam4::Diagnostics &d = columns.h_diags(icol);
+      const validation::ColumnPool &pool = columns.pool;
+      pool.set_host(d.hydrostatic_dry_dp, input.get_array("state_pdeldry"));
+      pool.set_host(a.temperature, input.get_array("state_t"));
+      pool.set_host(a.pressure, input.get_array("state_pmid"));
+      pool.set_host(d.deep_convective_cloud_fraction,
+                    input.get_array("dp_frac"));
+      pool.set_host(d.total_convective_detrainment,
+                    input.get_array("cldfrac"));
+      pool.set_host(d.deep_convective_cloud_condensate,
+                    input.get_array("icwmrdp"));
+      pool.set_host(d.deep_convective_precipitation_production,
+                    input.get_array("rprddp"));
+      pool.set_host(d.deep_convective_precipitation_evaporation,
+                    input.get_array("evapcdp"));
+      pool.set_host(d.mass_detrain_rate_from_updraft, input.get_array("du"));
+      pool.set_host(d.mass_entrain_rate_into_updraft, input.get_array("eu"));
+      pool.set_host(d.mass_entrain_rate_into_downdraft, input.get_array("ed"));
+      pool.set_host(d.delta_pressure, input.get_array("dp"));
+      pool.set_host_tracers(d.tracer_mixing_ratio, input.get_array("qnew"));
+    }
+    columns.pool.copy_to_device();
+    Kokkos::deep_copy(convproc, h_convproc);
 
     // NOTE: we haven't parallelized convproc over vertical levels because of
-    // NOTE: data dependencies, so we run this serially
-    auto team_policy = haero::ThreadTeamPolicy(1u, 1u);
+    // NOTE: data dependencies, so each column runs serially
+    auto team_policy = haero::ThreadTeamPolicy(batch.size(), 1u);
     Kokkos::parallel_for(
         team_policy, KOKKOS_LAMBDA(const ThreadTeam &team) {
-          convproc.compute_tendencies(aero_config, team, t, dt, atmosphere,
-                                      prognostics, diagnostics, tendencies);
+          const int icol = team.league_rank();
+          convproc(icol).compute_tendencies(aero_config, team, t, dt,
+                                            atm(icol), progs(icol),
+                                            diags(icol), tends(icol));
         });
     Kokkos::fence();
-    set_output(output, "dqdt", nlev, pcnst, dqdt_host,
-               diagnostics.d_tracer_mixing_ratio_dt);
+    columns.pool.copy_to_host();
+    for (int icol = 0; icol < batch.size(); ++icol)
+      dqdt[batch.begin + icol] = columns.pool.get_host_tracers(
+          columns.h_diags(icol).d_tracer_mixing_ratio_dt);
+  }
+
+  // Scatter the outputs to the members.
+  int member = 0;
+  ensemble->process([&](const Input &input, Output &output) {
+    output.set("dqdt", dqdt[member]);
+    ++member;
   });
 }
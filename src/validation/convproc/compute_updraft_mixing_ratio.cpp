@@ -24,15 +24,13 @@ void get_input(const Input &input, const std::string &name, const int size,
     host_view[n] = host[n];
   Kokkos::deep_copy(dev, host_view);
 }
-void get_input(
-    const Input &input, const std::string &name, const int rows, const int cols,
-    std::vector<Real> &host,
-    Kokkos::View<Real * [ConvProc::pcnst_extd], Kokkos::MemoryUnmanaged> &dev) {
+void get_input(const Input &input, const std::string &name, const int rows,
+               const int cols, std::vector<Real> &host,
+               convproc::Kokkos_2D_View &dev) {
   host = input.get_array(name);
   EKAT_ASSERT(host.size() == rows * cols);
   ColumnView col_view = mam4::validation::create_column_view(rows * cols);
-  dev = Kokkos::View<Real * [ConvProc::pcnst_extd], Kokkos::MemoryUnmanaged>(
-      col_view.data(), rows, cols);
+  dev = convproc::Kokkos_2D_View(col_view.data(), rows, cols);
   {
     std::vector<std::vector<Real>> matrix(rows, std::vector<Real>(cols));
     // Col Major layout
@@ -57,8 +55,7 @@ void set_output(Output &output, const std::string &name, const int rows,
 }
 void set_output(Output &output, const std::string &name, const int rows,
                 const int cols, std::vector<Real> &host,
-                const Kokkos::View<Real * [ConvProc::pcnst_extd],
-                                   Kokkos::MemoryUnmanaged> &dev) {
+                const convproc::Kokkos_2D_View &dev) {
   host.resize(rows * cols);
   auto host_view = Kokkos::create_mirror_view(dev);
   Kokkos::deep_copy(host_view, dev);
@@ -100,8 +97,8 @@ void compute_updraft_mixing_ratio(Ensemble *ensemble) {
     ColumnView doconvproc_extd_dev, dp_i_dev, dpdry_i_dev, cldfrac_dev,
         rhoair_i_dev, zmagl_dev, mu_i_dev, eudp_dev, temperature_dev,
         aqfrac_dev, icwmr_dev, rprd_dev, fa_u_dev, scalars_dev;
-    Kokkos::View<Real *[pcnst_extd], Kokkos::MemoryUnmanaged> gath_dev,
-        dconudt_wetdep_dev, dconudt_activa_dev, conu_dev;
+    convproc::Kokkos_2D_View gath_dev, dconudt_wetdep_dev, dconudt_activa_dev,
+        conu_dev;
 
     get_input(input, "doconvproc_extd", pcnst_extd, doconvproc_extd_host,
               doconvproc_extd_dev);
@@ -127,16 +124,14 @@ void compute_updraft_mixing_ratio(Ensemble *ensemble) {
       ColumnView dev =
           mam4::validation::create_column_view((nlev + 1) * pcnst_extd);
       dconudt_wetdep_dev =
-          Kokkos::View<Real *[pcnst_extd], Kokkos::MemoryUnmanaged>(
-              dev.data(), nlev + 1, pcnst_extd);
+          convproc::Kokkos_2D_View(dev.data(), nlev + 1, pcnst_extd);
     }
     {
       dconudt_activa_host.resize((nlev + 1) * pcnst_extd);
       ColumnView dev =
           mam4::validation::create_column_view((nlev + 1) * pcnst_extd);
       dconudt_activa_dev =
-          Kokkos::View<Real *[pcnst_extd], Kokkos::MemoryUnmanaged>(
-              dev.data(), nlev + 1, pcnst_extd);
+          convproc::Kokkos_2D_View(dev.data(), nlev + 1, pcnst_extd);
     }
 
     scalars_dev = mam4::validation::create_column_view(2);
@@ -24,15 +24,13 @@ void get_input(const Input &input, const std::string &name, const int size,
     host_view[n] = host[n];
   Kokkos::deep_copy(dev, host_view);
 }
-void get_input(
-    const Input &input, const std::string &name, const int rows, const int cols,
-    std::vector<Real> &host,
-    Kokkos::View<Real * [ConvProc::pcnst_extd], Kokkos::MemoryUnmanaged> &dev) {
+void get_input(const Input &input, const std::string &name, const int rows,
+               const int cols, std::vector<Real> &host,
+               convproc::Kokkos_2D_View &dev) {
   host = input.get_array(name);
   EKAT_ASSERT(host.size() == rows * cols);
   ColumnView col_view = mam4::validation::create_column_view(rows * cols);
-  dev = Kokkos::View<Real * [ConvProc::pcnst_extd], Kokkos::MemoryUnmanaged>(
-      col_view.data(), rows, cols);
+  dev = convproc::Kokkos_2D_View(col_view.data(), rows, cols);
   {
     std::vector<std::vector<Real>> matrix(rows, std::vector<Real>(cols));
     // Col Major layout
@@ -48,8 +46,7 @@ void get_input(
 }
 void set_output(Output &output, const std::string &name, const int rows,
                 const int cols, std::vector<Real> &host,
-                const Kokkos::View<Real * [ConvProc::pcnst_extd],
-                                   Kokkos::MemoryUnmanaged> &dev) {
+                const convproc::Kokkos_2D_View &dev) {
   host.resize(rows * cols);
   auto host_view = Kokkos::create_mirror_view(dev);
   Kokkos::deep_copy(host_view, dev);
@@ -59,9 +56,7 @@ void set_output(Output &output, const std::string &name, const int rows,
   output.set(name, host);
 }
 void set_host(const std::string &name, const int rows, const int cols,
-              std::vector<Real> &host,
-              const Kokkos::View<Real * [ConvProc::pcnst_extd],
-                                 Kokkos::MemoryUnmanaged> &dev) {
+              std::vector<Real> &host, const convproc::Kokkos_2D_View &dev) {
   host.resize(rows * cols);
   auto host_view = Kokkos::create_mirror_view(dev);
   Kokkos::deep_copy(host_view, dev);
@@ -91,9 +86,8 @@ void initialize_dcondt(Ensemble *ensemble) {
         eudp_host, eddp_host, dcondt_host, dcondt_host_2;
     ColumnView doconvproc_extd_dev, dpdry_i_dev, fa_u_dev, mu_i_dev, md_i_dev,
         dudp_dev, dddp_dev, eudp_dev, eddp_dev;
-    Kokkos::View<Real * [ConvProc::pcnst_extd], Kokkos::MemoryUnmanaged>
-        gath_dev, chat_dev, conu_dev, cond_dev, dconudt_activa_dev,
-        dconudt_wetdep_dev, dcondt_dev, dcondt_dev_2;
+    convproc::Kokkos_2D_View gath_dev, chat_dev, conu_dev, cond_dev,
+        dconudt_activa_dev, dconudt_wetdep_dev, dcondt_dev, dcondt_dev_2;
 
     get_input(input, "doconvproc_extd", ConvProc::pcnst_extd,
               doconvproc_extd_host, doconvproc_extd_dev);
@@ -124,13 +118,11 @@ void initialize_dcondt(Ensemble *ensemble) {
     ColumnView col_view =
         mam4::validation::create_column_view(nlev * ConvProc::pcnst_extd);
     dcondt_dev =
-        Kokkos::View<Real * [ConvProc::pcnst_extd], Kokkos::MemoryUnmanaged>(
-            col_view.data(), nlev, ConvProc::pcnst_extd);
+        convproc::Kokkos_2D_View(col_view.data(), nlev, ConvProc::pcnst_extd);
     ColumnView col_view_2 =
         mam4::validation::create_column_view(nlev * ConvProc::pcnst_extd);
     dcondt_dev_2 =
-        Kokkos::View<Real * [ConvProc::pcnst_extd], Kokkos::MemoryUnmanaged>(
-            col_view_2.data(), nlev, ConvProc::pcnst_extd);
+        convproc::Kokkos_2D_View(col_view_2.data(), nlev, ConvProc::pcnst_extd);
 
     Kokkos::parallel_for(
         "initialize_dcondt", 1, KOKKOS_LAMBDA(int) {
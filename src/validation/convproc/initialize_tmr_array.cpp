@@ -47,8 +47,7 @@ void get_input(
 }
 void set_output(Output &output, const std::string &name, const int rows,
                 const int cols, std::vector<Real> &host,
-                const Kokkos::View<Real * [ConvProc::pcnst_extd],
-                                   Kokkos::MemoryUnmanaged> &dev) {
+                const convproc::Kokkos_2D_View &dev) {
   host.resize(rows * cols);
   auto host_view = Kokkos::create_mirror_view(dev);
   Kokkos::deep_copy(host_view, dev);
@@ -66,8 +65,7 @@ void initialize_tmr_array(Ensemble *ensemble) {
     const int nlev = 72;
     const int pcnst_extd = ConvProc::pcnst_extd;
     const int pcnst = ConvProc::gas_pcnst;
-    using Kokko2DView =
-        Kokkos::View<Real *[pcnst_extd], Kokkos::MemoryUnmanaged>;
+    using Kokko2DView = convproc::Kokkos_2D_View;
     // Fetch ensemble parameters
     EKAT_ASSERT(pcnst_extd == input.get("pcnst_extd"));
     EKAT_ASSERT(pcnst == input.get("ncnst"));
@@ -25,14 +25,12 @@ void get_input(const Input &input, const std::string &name, const int size,
     host_view[n] = host[n];
   Kokkos::deep_copy(dev, host_view);
 }
-void get_input(
-    const Input &input, const std::string &name, const int rows, const int cols,
-    std::vector<Real> &host,
-    Kokkos::View<Real * [ConvProc::pcnst_extd], Kokkos::MemoryUnmanaged> &dev) {
+void get_input(const Input &input, const std::string &name, const int rows,
+               const int cols, std::vector<Real> &host,
+               convproc::Kokkos_2D_View &dev) {
   host = input.get_array(name);
   ColumnView col_view = mam4::validation::create_column_view(rows * cols);
-  dev = Kokkos::View<Real * [ConvProc::pcnst_extd], Kokkos::MemoryUnmanaged>(
-      col_view.data(), rows, cols);
+  dev = convproc::Kokkos_2D_View(col_view.data(), rows, cols);
   EKAT_ASSERT(host.size() == rows * cols);
   {
     std::vector<std::vector<Real>> matrix(rows, std::vector<Real>(cols));
@@ -47,13 +45,11 @@ void get_input(
     Kokkos::deep_copy(dev, host_view);
   }
 }
-void get_input(
-    const int rows, const int cols, std::vector<Real> &host,
-    Kokkos::View<Real * [ConvProc::pcnst_extd], Kokkos::MemoryUnmanaged> &dev) {
+void get_input(const int rows, const int cols, std::vector<Real> &host,
+               convproc::Kokkos_2D_View &dev) {
   host.resize(rows * cols, 0);
   ColumnView col_view = mam4::validation::create_column_view(rows * cols);
-  dev = Kokkos::View<Real * [ConvProc::pcnst_extd], Kokkos::MemoryUnmanaged>(
-      col_view.data(), rows, cols);
+  dev = convproc::Kokkos_2D_View(col_view.data(), rows, cols);
   auto host_view = Kokkos::create_mirror_view(dev);
   for (int i = 0; i < rows; ++i)
     for (int j = 0; j < cols; ++j)
@@ -62,8 +58,7 @@ void get_input(
 }
 void set_output(Output &output, const std::string &name, const int rows,
                 const int cols, std::vector<Real> &host,
-                const Kokkos::View<Real * [ConvProc::pcnst_extd],
-                                   Kokkos::MemoryUnmanaged> &dev) {
+                const convproc::Kokkos_2D_View &dev) {
   auto host_view = Kokkos::create_mirror_view(dev);
   Kokkos::deep_copy(host_view, dev);
   for (int i = 0, n = 0; i < rows; ++i)
@@ -90,9 +85,8 @@ void ma_precpevap_convproc(Ensemble *ensemble) {
         doconvproc_extd_host, species_class_host, mmtoo_prevap_resusp_host;
     ColumnView rprd_dev, evapc_dev, dpdry_i_dev, doconvproc_extd_dev,
         species_class_dev, mmtoo_prevap_resusp_dev;
-    Kokkos::View<Real * [ConvProc::pcnst_extd], Kokkos::MemoryUnmanaged>
-        dcondt_dev, dcondt_prevap_dev, dcondt_prevap_hist_dev,
-        dcondt_wetdep_dev;
+    convproc::Kokkos_2D_View dcondt_dev, dcondt_prevap_dev,
+        dcondt_prevap_hist_dev, dcondt_wetdep_dev;
     get_input(input, "rprd", nlev, rprd_host, rprd_dev);
     get_input(input, "evapc", nlev, evapc_host, evapc_dev);
     get_input(input, "dpdry_i", nlev, dpdry_i_host, dpdry_i_dev);
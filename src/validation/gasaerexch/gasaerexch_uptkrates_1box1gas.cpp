@@ -15,9 +15,21 @@ using mam4::gasaerexch::gas_aer_uptkrates_1box1gas;
 using namespace haero;
 using namespace skywalker;
 
-void test_gasaerexch_uptkrates_1box1gas_process(const Input &input,
-                                                Output &output,
-                                                mam4::GasAerExch &gasaerexch) {
+namespace {
+constexpr int n_mode = 4;
+
+// inputs and outputs of gas_aer_uptkrates_1box1gas for one ensemble member
+struct UptkratesBox {
+  bool l_condense_to_mode[n_mode];
+  Real temp, pmid, mw_gas, beta_inp, vol_molar_gas;
+  int nghq;
+  Real dgncur_awet[n_mode];
+  Real lnsg[n_mode];
+  Real uptkaer[n_mode];
+};
+
+// returns the inputs of gas_aer_uptkrates_1box1gas given by an ensemble member
+UptkratesBox get_uptkrates_1box1gas_input(const Input &input) {
   // Ensemble parameters
   if (!input.has("temp")) {
     std::cerr << "Required name: "
@@ -45,93 +57,86 @@ void test_gasaerexch_uptkrates_1box1gas_process(const Input &input,
   const bool has_nghq = input.has("nghq");
   const bool has_vol_molar_gas = input.has("vol_molar_gas");
   const bool has_condense_to_mode = input.has_array("condense_to_mode");
-  const bool has_solution = input.has_array("uptkaer");
-
-  //-------------------------------------------------------
-  // Process input, do calculations, and prepare output
-  //-------------------------------------------------------
-  const int n_mode = 4;
-  int nghq = 2;
-  const Real accom = 0.65000000000000002;
-  Real beta_inp = 1.5000000000000000;
-  const Real pi = 3.1415926535897931;
-  const Real r_universal = 8314.4675910000005;
-  Real mw_gas = 98.078400000000002;
-  const Real mw_air = 28.966000000000001;
-  Real pmid = 100000.00000000000;
-  const Real pstd = 101325.00000000000;
-  Real vol_molar_gas = 42.880000000000003;
-  const Real vol_molar_air = 20.100000000000001;
 
-  bool l_condense_to_mode[n_mode] = {true, true, true, true};
+  UptkratesBox box = {};
+  box.nghq = 2;
+  box.beta_inp = 1.5000000000000000;
+  box.mw_gas = 98.078400000000002;
+  box.pmid = 100000.00000000000;
+  box.vol_molar_gas = 42.880000000000003;
+  for (int i = 0; i < n_mode; ++i)
+    box.l_condense_to_mode[i] = true;
   // Parse input
-  Real dgncur_awet[n_mode];
-  Real lnsg[n_mode];
   {
     const std::vector<Real> array = input.get_array("dgncur_awet");
     for (size_t i = 0; i < array.size() && i < n_mode; ++i)
-      dgncur_awet[i] = array[i];
+      box.dgncur_awet[i] = array[i];
   }
   {
     const std::vector<Real> array = input.get_array("lnsg");
     for (size_t i = 0; i < array.size() && i < n_mode; ++i)
-      lnsg[i] = array[i];
+      box.lnsg[i] = array[i];
   }
-  const std::vector<Real> aernum = input.get_array("aernum");
-  const Real temp = input.get("temp");
+  box.temp = input.get("temp");
   if (has_mw_gas)
-    mw_gas = input.get("mw_gas");
+    box.mw_gas = input.get("mw_gas");
   if (has_pmid)
-    pmid = input.get("pmid");
+    box.pmid = input.get("pmid");
   if (has_beta)
-    beta_inp = input.get("beta");
+    box.beta_inp = input.get("beta");
   if (has_nghq)
-    nghq = static_cast<int>(input.get("nghq"));
+    box.nghq = static_cast<int>(input.get("nghq"));
   if (has_vol_molar_gas)
-    vol_molar_gas = input.get("vol_molar_gas");
+    box.vol_molar_gas = input.get("vol_molar_gas");
   if (has_condense_to_mode) {
     const std::vector<Real> values = input.get_array("condense_to_mode");
     for (int i = 0; i < n_mode; ++i)
-      l_condense_to_mode[i] = (values[i] <= 0) ? false : true;
-  }
-  std::vector<Real> test_uptkaer;
-  if (has_solution) {
-    test_uptkaer = input.get_array("uptkaer");
-  }
-  ColumnView uptkaer_dev = mam4::validation::create_column_view(n_mode);
-  Kokkos::parallel_for(
-      "gasaerexch::gas_aer_uptkrates_1box1gas", 1, KOKKOS_LAMBDA(const int) {
-        Real uptkaer[n_mode];
-        mam4::gasaerexch::gas_aer_uptkrates_1box1gas(
-            l_condense_to_mode, temp, pmid, pstd, mw_gas, mw_air, vol_molar_gas,
-            vol_molar_air, accom, r_universal, pi, beta_inp, nghq, dgncur_awet,
-            lnsg, uptkaer);
-        for (size_t i = 0; i < n_mode; ++i)
-          uptkaer_dev(i) = uptkaer[i];
-      });
-  Kokkos::Array<Real, n_mode> uptkaer;
-  {
-    auto host_view = Kokkos::create_mirror_view(uptkaer_dev);
-    Kokkos::deep_copy(host_view, uptkaer_dev);
-    for (size_t i = 0; i < n_mode; ++i)
-      uptkaer[i] = host_view[i];
-  }
-  // Write the computed nucleation rate.
-  {
-    std::vector<Real> values(n_mode);
-    for (size_t i = 0; i < values.size() && i < n_mode; ++i)
-      values[i] = uptkaer[i];
-    output.set("uptkaer", values);
+      box.l_condense_to_mode[i] = (values[i] <= 0) ? false : true;
   }
+  return box;
 }
+} // namespace
 
+// Runs the ensemble with a single kernel launch, one box per member.
 void test_gasaerexch_uptkrates_1box1gas(std::unique_ptr<Ensemble> &ensemble) {
-  mam4::AeroConfig mam4_config;
-  mam4::GasAerExch gasaerexch;
-  mam4::GasAerExch::Config config;
-  gasaerexch.init(mam4_config, config);
+  //-------------------------------------------------------
+  // Process input, do calculations, and prepare output
+  //-------------------------------------------------------
+  const Real accom = 0.65000000000000002;
+  const Real pi = 3.1415926535897931;
+  const Real r_universal = 8314.4675910000005;
+  const Real mw_air = 28.966000000000001;
+  const Real pstd = 101325.00000000000;
+  const Real vol_molar_air = 20.100000000000001;
+
+  std::vector<UptkratesBox> host_boxes;
+  ensemble->process([&](const Input &input, Output &output) {
+    host_boxes.push_back(get_uptkrates_1box1gas_input(input));
+  });
+  const int num_members = static_cast<int>(host_boxes.size());
+  DeviceType::view_1d<UptkratesBox> boxes("gas_aer_uptkrates_1box1gas",
+                                          num_members);
+  auto h_boxes = Kokkos::create_mirror_view(boxes);
+  for (int m = 0; m < num_members; ++m)
+    h_boxes(m) = host_boxes[m];
+  Kokkos::deep_copy(boxes, h_boxes);
+
+  Kokkos::parallel_for(
+      "gasaerexch::gas_aer_uptkrates_1box1gas", num_members,
+      KOKKOS_LAMBDA(const int m) {
+        UptkratesBox &b = boxes(m);
+        mam4::gasaerexch::gas_aer_uptkrates_1box1gas(
+            b.l_condense_to_mode, b.temp, b.pmid, pstd, b.mw_gas, mw_air,
+            b.vol_molar_gas, vol_molar_air, accom, r_universal, pi, b.beta_inp,
+            b.nghq, b.dgncur_awet, b.lnsg, b.uptkaer);
+      });
+  Kokkos::deep_copy(h_boxes, boxes);
 
+  // Write the computed uptake rates.
+  int member = 0;
   ensemble->process([&](const Input &input, Output &output) {
-    test_gasaerexch_uptkrates_1box1gas_process(input, output, gasaerexch);
+    const UptkratesBox &b = h_boxes(member);
+    output.set("uptkaer", std::vector<Real>(b.uptkaer, b.uptkaer + n_mode));
+    ++member;
   });
 }
@@ -14,10 +14,12 @@
 #include <haero/atmosphere.hpp>
 #include <haero/constants.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <ekat/ekat_assert.hpp>
 #include <iostream>
 #include <skywalker.hpp>
+#include <vector>
 
 using namespace skywalker;
 using namespace haero;
@@ -117,6 +119,27 @@ GasAerExch::Config gasaerexch_module_var_init() {
   return config;
 }
 
+// The state and output time series of one ensemble member, which is a column
+// of a batch that is stepped forward in time together with the other members
+// of the batch (see validation::BatchColumns).
+struct MemberState {
+  static constexpr int num_gas = mam4::AeroConfig::num_gas_ids();
+  static constexpr int num_mode = mam4::AeroConfig::num_modes();
+  static constexpr int num_aer = mam4::AeroConfig::num_aerosol_ids();
+
+  Real pmid, temp;
+  Real qgas_netprod_otrproc[num_gas] = {};
+  Real qgas_cur[num_gas] = {};
+  Real qnum_cur[num_mode];
+  Real qaer_cur[num_aer][num_mode];
+  Real run_length, dt_mam, dt_soa_opt, dt_soa_fixed;
+  int nstep_end;
+  bool update_diameter_every_time_step;
+
+  std::vector<Real> time, so4a, so4g, so4g_ddt_exch, soaa, soag, soag_ddt_exch,
+      soag_amb_qsat, soag_niter;
+};
+
 // =================================================================
 //  This is the driver program that tests MAM's gas-aerosol exchange
 //  parameterizations.
@@ -190,36 +213,34 @@ int main(int argc, char **argv) {
   const int i_dst = static_cast<int>(mam4::AeroId::DST);
   const int i_mom = static_cast<int>(mam4::AeroId::MOM);
   // =======================================================================
-  //  Loop over all members of the ensemble. Process input, do calculations, and
-  //  prepare output
+  //  Process the input of all members of the ensemble.
   // =======================================================================
-  ensemble->process([=](const Input &input, Output &output) {
-    Real qgas_netprod_otrproc[num_gas] = {};
-    Real qgas_cur[num_gas] = {};
+  const int n_mode = ntot_amode - 1;
+  std::vector<MemberState> members;
+  ensemble->process([&](const Input &input, Output &output) {
+    MemberState m;
     // ----------------------------------------
     //  Process input for this ensemble member
     // ----------------------------------------
     //  Ambient conditions
 
-    const Real pmid = input.get("pmid"); // air pressure
-    const Real temp = input.get("temp"); // air temperature
+    m.pmid = input.get("pmid"); // air pressure
+    m.temp = input.get("temp"); // air temperature
 
     // gas production rates and mixing ratio ICs
 
-    qgas_netprod_otrproc[i_h2so4] = input.get("qgas_prod_rate_h2so4");
-    qgas_netprod_otrproc[i_soag] = input.get("qgas_prod_rate_soag");
+    m.qgas_netprod_otrproc[i_h2so4] = input.get("qgas_prod_rate_h2so4");
+    m.qgas_netprod_otrproc[i_soag] = input.get("qgas_prod_rate_soag");
 
-    qgas_cur[i_h2so4] = input.get("qgas_cur_h2so4");
-    qgas_cur[i_soag] = input.get("qgas_cur_soag");
+    m.qgas_cur[i_h2so4] = input.get("qgas_cur_h2so4");
+    m.qgas_cur[i_soag] = input.get("qgas_cur_soag");
 
     // aerosol mixing ratio ICs
-    Real qnum_cur[num_mode];
     {
       const std::vector<Real> val = input.get_array("qnum_cur");
       for (int i = 0; i < num_mode; ++i)
-        qnum_cur[i] = val[i];
+        m.qnum_cur[i] = val[i];
     }
-    Real qaer_cur[num_aer][num_mode];
     {
       std::vector<Real> val[7];
       val[0] = input.get_array("qaer_soa");
@@ -230,229 +251,253 @@ int main(int argc, char **argv) {
       val[5] = input.get_array("qaer_dst");
       val[6] = input.get_array("qaer_mom");
       for (int i = 0; i < num_mode; ++i) {
-        qaer_cur[i_soa][i] = val[0][i];
-        qaer_cur[i_so4][i] = val[1][i];
-        qaer_cur[i_pom][i] = val[2][i];
-        qaer_cur[i_bc][i] = val[3][i];
-        qaer_cur[i_ncl][i] = val[4][i];
-        qaer_cur[i_dst][i] = val[5][i];
-        qaer_cur[i_mom][i] = val[6][i];
+        m.qaer_cur[i_soa][i] = val[0][i];
+        m.qaer_cur[i_so4][i] = val[1][i];
+        m.qaer_cur[i_pom][i] = val[2][i];
+        m.qaer_cur[i_bc][i] = val[3][i];
+        m.qaer_cur[i_ncl][i] = val[4][i];
+        m.qaer_cur[i_dst][i] = val[5][i];
+        m.qaer_cur[i_mom][i] = val[6][i];
       }
     }
     // Time-stepping
-    const Real run_length = input.get("run_length");
-    const Real dt_mam = input.get("dt_mam");
-    int nstep_end = std::round(run_length / dt_mam);
+    m.run_length = input.get("run_length");
+    m.dt_mam = input.get("dt_mam");
+    m.nstep_end = std::round(m.run_length / m.dt_mam);
     EKAT_REQUIRE_MSG(
-        mam4::FloatingPoint<Real>::equiv(nstep_end * dt_mam, run_length),
+        mam4::FloatingPoint<Real>::equiv(m.nstep_end * m.dt_mam, m.run_length),
         "The run length should be a multiple of the time step.");
-    ++nstep_end;
+    ++m.nstep_end;
 
-    const Real dt_soa_opt = std::round(input.get("dt_soa_opt"));
-    EKAT_REQUIRE_MSG(dt_soa_opt == 0 || dt_soa_opt == -1,
+    m.dt_soa_opt = std::round(input.get("dt_soa_opt"));
+    EKAT_REQUIRE_MSG(m.dt_soa_opt == 0 || m.dt_soa_opt == -1,
                      "dt_soa_opt should be 0 or -1.");
-    const Real dt_soa_fixed = dt_soa_opt == -1 ? -1 : dt_mam;
+    m.dt_soa_fixed = m.dt_soa_opt == -1 ? -1 : m.dt_mam;
 
-    const bool update_diameter_every_time_step =
+    m.update_diameter_every_time_step =
         std::round(input.get("update_diameter_every_time_step"));
 
-    // Miscellaneous input and tmp variables
-
-    const int n_mode = ntot_amode - 1;
-    const Real dwet_ddry_ratio = 1.0;
-    // const bool l_calc_gas_uptake_coeff = true;
-
-    std::vector<Real> time(nstep_end, 0);
-    std::vector<Real> so4a(nstep_end, 0);
-    std::vector<Real> so4g(nstep_end, 0);
-    std::vector<Real> so4g_ddt_exch(nstep_end, 0);
-    std::vector<Real> soaa(nstep_end, 0);
-    std::vector<Real> soag(nstep_end, 0);
-    std::vector<Real> soag_ddt_exch(nstep_end, 0);
-    std::vector<Real> soag_amb_qsat(nstep_end, 0);
-    std::vector<Real> soag_niter(nstep_end, 0);
+    const int nstep_end = m.nstep_end;
+    m.time.assign(nstep_end, 0);
+    m.so4a.assign(nstep_end, 0);
+    m.so4g.assign(nstep_end, 0);
+    m.so4g_ddt_exch.assign(nstep_end, 0);
+    m.soaa.assign(nstep_end, 0);
+    m.soag.assign(nstep_end, 0);
+    m.soag_ddt_exch.assign(nstep_end, 0);
+    m.soag_amb_qsat.assign(nstep_end, 0);
+    m.soag_niter.assign(nstep_end, 0);
 
     // ------------------------------------------------------------------
     //  save initial conditions for output
     // ------------------------------------------------------------------
-    {
-      const int istep = 0;
-      time[istep] = 0;
-      so4g[istep] = qgas_cur[i_h2so4];
-      soag[istep] = qgas_cur[i_soag];
-      for (int i = 0; i < n_mode; ++i)
-        so4a[istep] += qaer_cur[i_so4][i];
-      for (int i = 0; i < n_mode; ++i)
-        soaa[istep] += qaer_cur[i_soa][i];
-      // ------------------------------------------------------------------
-      //  Time loop, in which the MAM subroutine we want to test is called.
-      // ------------------------------------------------------------------
-      std::cout << std::endl;
-      std::cout << "===== Time loop starting" << std::endl;
-      std::cout << "run_length   = " << run_length << std::endl;
-      std::cout << "nstep_end    = " << nstep_end << std::endl;
-      std::cout << "dt_mam       = " << dt_mam << std::endl;
-      std::cout << "dt_soa_fixed = " << dt_soa_fixed
-                << " (dt_soa_opt = " << dt_soa_opt << ")" << std::endl;
-      std::cout << std::endl;
+    m.time[0] = 0;
+    m.so4g[0] = m.qgas_cur[i_h2so4];
+    m.soag[0] = m.qgas_cur[i_soag];
+    for (int i = 0; i < n_mode; ++i)
+      m.so4a[0] += m.qaer_cur[i_so4][i];
+    for (int i = 0; i < n_mode; ++i)
+      m.soaa[0] += m.qaer_cur[i_soa][i];
+    members.push_back(m);
+  });
+  const int num_members = static_cast<int>(members.size());
+
+  // Miscellaneous input and tmp variables
+  const Real dwet_ddry_ratio = 1.0;
+  // const bool l_calc_gas_uptake_coeff = true;
+
+  // create containers for the timestepping below: one single-level column per
+  // member of a batch, with the member's own gas-aerosol exchange (configured
+  // with its gas production rates) and time step
+  const int nlev = 1;
+  const Real pblh = 1000;
+  validation::BatchColumns columns(nlev, pblh,
+                                   fields_accessed<GasAerExchProcess>());
+  const auto atm = columns.atm;
+  const auto sfc = columns.sfc;
+  const auto progs = columns.progs;
+  const auto diags = columns.diags;
+  const auto tends = columns.tends;
+  DeviceType::view_1d<GasAerExch> gasaerexch("gasaerexch",
+                                             validation::max_batch_size);
+  DeviceType::view_1d<Real> dt("dt", validation::max_batch_size);
+  DeviceType::view_1d<int> active("active", validation::max_batch_size);
+  DeviceType::view_1d<int> niter("niter", validation::max_batch_size);
+  auto h_gasaerexch = Kokkos::create_mirror_view(gasaerexch);
+  auto h_dt = Kokkos::create_mirror_view(dt);
+  auto h_active = Kokkos::create_mirror_view(active);
+  auto h_niter = Kokkos::create_mirror_view(niter);
+  const mam4::AeroConfig mam4_config;
+
+  for (const validation::MemberBatch &batch :
+       validation::member_batches(num_members)) {
+    columns.pool.zero_host();
+    int nstep_end = 0;
+    for (int icol = 0; icol < batch.size(); ++icol) {
+      const MemberState &m = members[batch.begin + icol];
+      GasAerExch::Config process_config = config;
+      for (int i = 0; i < num_gas; ++i)
+        process_config.qgas_netprod_otrproc[i] = m.qgas_netprod_otrproc[i];
+      h_gasaerexch(icol).init(mam4_config, process_config);
+      h_dt(icol) = m.dt_mam;
+      nstep_end = std::max(nstep_end, m.nstep_end);
     }
-
-    // create containers for the timestepping below.
-    int nlev = 1;
-    Real pblh = 1000;
-    Atmosphere atm = validation::create_atmosphere(nlev, pblh);
-    Surface sfc = validation::create_surface();
-    mam4::Prognostics progs = validation::create_prognostics(nlev);
-    mam4::Diagnostics diags = validation::create_diagnostics(nlev);
-    mam4::Tendencies tends = validation::create_tendencies(nlev);
+    Kokkos::deep_copy(gasaerexch, h_gasaerexch);
+    Kokkos::deep_copy(dt, h_dt);
 
     // ---------
     for (int istep = 1; istep < nstep_end; ++istep) {
+      for (int icol = 0; icol < batch.size(); ++icol) {
+        MemberState &m = members[batch.begin + icol];
+        h_active(icol) = (istep < m.nstep_end);
+        if (!h_active(icol))
+          continue;
+
+        // ------------------------------------------------------------------
+        //  Apply net production from other processes (e.g., chemistry,
+        //  advection). This is done here for SOA only, because the
+        //  production rate of H2SO4 gas is handled inside the MAM subroutine
+        //  we are testing.
+        // ------------------------------------------------------------------
+        m.qgas_cur[i_soag] =
+            m.qgas_cur[i_soag] + m.qgas_netprod_otrproc[i_soag] * m.dt_mam;
+
+        // ------------------------------------------------------------------
+        //  Calculate/update wet geometric mean diameter of each aerosol mode
+        // ------------------------------------------------------------------
+        // geometric mean diameter of each aerosol mode
+        Real dgn_awet[num_mode] = {};
+        if ((m.update_diameter_every_time_step == 1) || (istep == 1)) {
+          mam4::diag_dgn_wet(m.qaer_cur, m.qnum_cur, molecular_weight_gm,
+                             dwet_ddry_ratio, dgn_awet);
+        }
 
-      // ------------------------------------------------------------------
-      //  Apply net production from other processes (e.g., chemistry,
-      //  advection). This is done here for SOA only, because the production
-      //  rate of H2SO4 gas is handled inside the MAM subroutine we are testing.
-      // ------------------------------------------------------------------
-      qgas_cur[i_soag] =
-          qgas_cur[i_soag] + qgas_netprod_otrproc[i_soag] * dt_mam;
-
-      // ------------------------------------------------------------------
-      //  Calculate/update wet geometric mean diameter of each aerosol mode
-      // ------------------------------------------------------------------
-      // geometric mean diameter of each aerosol mode
-      Real dgn_awet[num_mode] = {};
-      if ((update_diameter_every_time_step == 1) || (istep == 1)) {
-        mam4::diag_dgn_wet(qaer_cur, qnum_cur, molecular_weight_gm,
-                           dwet_ddry_ratio, dgn_awet);
+        // Load the member's column. Gas and aerosol mixing ratios will be
+        // updated by the MAM subroutine.
+        const validation::ColumnPool &pool = columns.pool;
+        const Atmosphere &a = columns.h_atm(icol);
+        const mam4::Prognostics &p = columns.h_progs(icol);
+        const mam4::Diagnostics &d = columns.h_diags(icol);
+        *pool.host(a.temperature) = m.temp;
+        *pool.host(a.pressure) = m.pmid;
+        for (int n = 0; n < num_mode; ++n)
+          for (int g = 0; g < num_aer; ++g)
+            *pool.host(p.q_aero_i[n][g]) = m.qaer_cur[g][n];
+        for (int n = 0; n < num_gas; ++n)
+          *pool.host(p.q_gas[n]) = m.qgas_cur[n];
+        for (int n = 0; n < num_mode; ++n)
+          *pool.host(p.n_mode_i[n]) = m.qnum_cur[n];
+        for (int igas = 0; igas < num_gas; ++igas)
+          for (int imode = 0; imode < num_mode; ++imode)
+            *pool.host(p.uptkaer[igas][imode]) = 0;
+        *pool.host(d.g0_soa_out) = 0;
+        for (int i = 0; i < num_mode; ++i)
+          *pool.host(d.wet_geometric_mean_diameter_i[i]) = dgn_awet[i];
       }
-      // ------------------------------------------------------------------
-      //  Gas-aerosol exchanges
-      // ------------------------------------------------------------------
-      //  Save the gas mixing ratios before gas-aerosol exchange to diagnose the
-      //  tendencies after the subroutine call.
-      // Note: qgas_cur[num_gas] is out of bounds but the constructor is for
-      // [begin,end)
-      const std::vector<Real> zqgas_bef(&qgas_cur[0], &qgas_cur[num_gas]);
-
-      // Call the MAM subroutine. Gas and aerosol mixing ratios will be updated
-      // during the call
-      auto d_temp = validation::create_column_view(nlev);
-      auto d_pmid = validation::create_column_view(nlev);
-      Kokkos::deep_copy(d_temp, temp);
-      Kokkos::deep_copy(d_pmid, pmid);
-      atm.temperature = d_temp;
-      atm.pressure = d_pmid;
-      for (int n = 0; n < num_mode; ++n)
-        for (int g = 0; g < num_aer; ++g)
-          Kokkos::deep_copy(progs.q_aero_i[n][g], qaer_cur[g][n]);
-
-      for (int n = 0; n < num_gas; ++n)
-        Kokkos::deep_copy(progs.q_gas[n], qgas_cur[n]);
-
-      for (int n = 0; n < num_mode; ++n)
-        Kokkos::deep_copy(progs.n_mode_i[n], qnum_cur[n]);
-
-      for (int igas = 0; igas < num_gas; ++igas)
-        for (int imode = 0; imode < num_mode; ++imode)
-          Kokkos::deep_copy(progs.uptkaer[igas][imode], 0);
-
-      Kokkos::deep_copy(diags.g0_soa_out, 0);
-
-      for (int i = 0; i < num_mode; ++i)
-        Kokkos::deep_copy(diags.wet_geometric_mean_diameter_i[i], dgn_awet[i]);
+      columns.pool.copy_to_device();
+      Kokkos::deep_copy(active, h_active);
 
-      mam4::AeroConfig mam4_config;
-
-      mam4::GasAerExchProcess::ProcessConfig process_config = config;
-      for (int i = 0; i < num_gas; ++i)
-        process_config.qgas_netprod_otrproc[i] = qgas_netprod_otrproc[i];
-
-      mam4::GasAerExchProcess process(mam4_config, process_config);
-      auto team_policy = ThreadTeamPolicy(1u, Kokkos::AUTO);
-      Real t = 0.0, dt = dt_mam;
+      auto team_policy = ThreadTeamPolicy(batch.size(), Kokkos::AUTO);
+      const Real t = 0.0;
       Kokkos::parallel_for(
           team_policy, KOKKOS_LAMBDA(const ThreadTeam &team) {
-            process.compute_tendencies(team, t, dt, atm, sfc, progs, diags,
-                                       tends);
+            const int icol = team.league_rank();
+            if (!active(icol))
+              return;
+            gasaerexch(icol).compute_tendencies(mam4_config, team, t, dt(icol),
+                                                atm(icol), sfc(icol),
+                                                progs(icol), diags(icol),
+                                                tends(icol));
+            team.team_barrier();
+            Kokkos::single(Kokkos::PerTeam(team), [&]() {
+              niter(icol) = diags(icol).num_substeps(0);
+            });
           });
+      Kokkos::fence();
+      columns.pool.copy_to_host();
+      Kokkos::deep_copy(h_niter, niter);
 
       // ---------------------------------------------------------
       //  Calculations for this timestep done. Prepare for output.
       // ---------------------------------------------------------
       //  Save values for output and postprocessing
-
-      for (int n = 0; n < num_mode; ++n)
-        for (int g = 0; g < num_aer; ++g) {
-          auto host_view = Kokkos::create_mirror_view(progs.q_aero_i[n][g]);
-          Kokkos::deep_copy(host_view, progs.q_aero_i[n][g]);
-          qaer_cur[g][n] = host_view(0);
-        }
-
-      for (int n = 0; n < num_gas; ++n) {
-        auto host_view = Kokkos::create_mirror_view(progs.q_gas[n]);
-        Kokkos::deep_copy(host_view, progs.q_gas[n]);
-        qgas_cur[n] = host_view(0);
-      }
-
-      // ambient saturation mixing ratio of SOA gases, solute effect ignored
-      Real g0_soa = 0;
-      {
-        auto host_view = Kokkos::create_mirror_view(diags.g0_soa_out);
-        Kokkos::deep_copy(host_view, diags.g0_soa_out);
-        g0_soa = host_view(0);
+      for (int icol = 0; icol < batch.size(); ++icol) {
+        if (!h_active(icol))
+          continue;
+        MemberState &m = members[batch.begin + icol];
+        const Real qh2so4_bef = m.qgas_cur[i_h2so4];
+        const Real qsoag_bef = m.qgas_cur[i_soag];
+        const validation::ColumnPool &pool = columns.pool;
+        const mam4::Prognostics &p = columns.h_progs(icol);
+        for (int n = 0; n < num_mode; ++n)
+          for (int g = 0; g < num_aer; ++g)
+            m.qaer_cur[g][n] = *pool.host(p.q_aero_i[n][g]);
+        for (int n = 0; n < num_gas; ++n)
+          m.qgas_cur[n] = *pool.host(p.q_gas[n]);
+
+        // ambient saturation mixing ratio of SOA gases, solute effect ignored
+        const Real g0_soa = *pool.host(columns.h_diags(icol).g0_soa_out);
+
+        m.time[istep] = istep * m.dt_mam;
+
+        // so4
+        m.so4g[istep] = m.qgas_cur[i_h2so4];
+        m.so4a[istep] = 0;
+        for (int n = 0; n < num_mode; ++n)
+          m.so4a[istep] += m.qaer_cur[i_so4][n];
+
+        m.so4g_ddt_exch[istep] = (m.qgas_cur[i_h2so4] - qh2so4_bef) / m.dt_mam -
+                                 m.qgas_netprod_otrproc[i_h2so4];
+
+        // soa
+        m.soag[istep] = m.qgas_cur[i_soag];
+        m.soaa[istep] = 0;
+        for (int n = 0; n < num_mode; ++n)
+          m.soaa[istep] += m.qaer_cur[i_soa][n];
+        m.soag_ddt_exch[istep] = (m.qgas_cur[i_soag] - qsoag_bef) / m.dt_mam;
+        m.soag_amb_qsat[istep] = g0_soa;
+        // Number of time substeps needed for convergence of SOA gases
+        m.soag_niter[istep] = h_niter(icol);
       }
+    }
+  }
 
-      // Number of time substeps needed for convergence of SOA gases
-      int niter = 0;
-      {
-        auto host_view = Kokkos::create_mirror_view(diags.num_substeps);
-        Kokkos::deep_copy(host_view, diags.num_substeps);
-        niter = host_view(0);
-      }
+  // ------------------------------------------
+  //  Process output for each ensemble member
+  // ------------------------------------------
+  int member = 0;
+  ensemble->process([&](const Input &input, Output &output) {
+    const MemberState &m = members[member];
+    ++member;
 
-      time[istep] = istep * dt_mam;
-
-      // so4
-      so4g[istep] = qgas_cur[i_h2so4];
-      so4a[istep] = 0;
-      for (int n = 0; n < num_mode; ++n)
-        so4a[istep] += qaer_cur[i_so4][n];
-
-      so4g_ddt_exch[istep] = (qgas_cur[i_h2so4] - zqgas_bef[i_h2so4]) / dt_mam -
-                             qgas_netprod_otrproc[i_h2so4];
-
-      // soa
-      soag[istep] = qgas_cur[i_soag];
-      soaa[istep] = 0;
-      for (int n = 0; n < num_mode; ++n)
-        soaa[istep] += qaer_cur[i_soa][n];
-      soag_ddt_exch[istep] = (qgas_cur[i_soag] - zqgas_bef[i_soag]) / dt_mam;
-      soag_amb_qsat[istep] = g0_soa;
-      soag_niter[istep] = niter;
-      // Print some numbers to stdout for quick checks
-      std::cout << "step " << istep << ", dqSOAG/dt = " << soag_ddt_exch[istep]
-                << ", qSOAG after = " << qgas_cur[i_soag]
-                << ", g0_soa = " << g0_soa << ", niter = " << niter
-                << std::endl;
-      // ----------------------------------------------
-    }
+    // Print some numbers to stdout for quick checks
+    std::cout << std::endl;
+    std::cout << "===== Time loop starting" << std::endl;
+    std::cout << "run_length   = " << m.run_length << std::endl;
+    std::cout << "nstep_end    = " << m.nstep_end << std::endl;
+    std::cout << "dt_mam       = " << m.dt_mam << std::endl;
+    std::cout << "dt_soa_fixed = " << m.dt_soa_fixed
+              << " (dt_soa_opt = " << m.dt_soa_opt << ")" << std::endl;
+    std::cout << std::endl;
+    for (int istep = 1; istep < m.nstep_end; ++istep)
+      std::cout << "step " << istep
+                << ", dqSOAG/dt = " << m.soag_ddt_exch[istep]
+                << ", qSOAG after = " << m.soag[istep]
+                << ", g0_soa = " << m.soag_amb_qsat[istep]
+                << ", niter = " << m.soag_niter[istep] << std::endl;
     std::cout << std::endl;
     std::cout << "===== Time loop done" << std::endl;
     std::cout << std::endl;
 
-    // ------------------------------------------
-    //  Process output for this ensemble member
-    // ------------------------------------------
-    output.set("model_time", time);
-    output.set("so4a_time_series", so4a);
-    output.set("so4g_time_series", so4g);
-    output.set("so4g_ddt_exch", so4g_ddt_exch);
-    output.set("soaa_time_series", soaa);
-    output.set("soag_time_series", soag);
-    output.set("soag_ddt_exch", soag_ddt_exch);
-    output.set("soag_amb_qsat", soag_amb_qsat);
-    output.set("soag_niter", soag_niter);
+    output.set("model_time", m.time);
+    output.set("so4a_time_series", m.so4a);
+    output.set("so4g_time_series", m.so4g);
+    output.set("so4g_ddt_exch", m.so4g_ddt_exch);
+    output.set("soaa_time_series", m.soaa);
+    output.set("soag_time_series", m.soag);
+    output.set("soag_ddt_exch", m.soag_ddt_exch);
+    output.set("soag_amb_qsat", m.soag_amb_qsat);
+    output.set("soag_niter", m.soag_niter);
   });
 
   // ========================================
@@ -10,6 +10,7 @@
 #include <skywalker.hpp>
 
 #include <iostream>
+#include <vector>
 
 using namespace skywalker;
 using namespace mam4;
@@ -45,39 +46,62 @@ void mer07_veh02_wang08_nuc_1box(Ensemble *ensemble) {
   Real adjust_factor_pbl_ratenucl = 1.0;
   Real ln_nuc_rate_cutoff = -13.82;
 
-  // Run the ensemble.
-  ensemble->process([=](const Input &input, Output &output) {
-    // Parse input
-
-    Real temp = input.get("temperature");
-    Real relhumnn = input.get("relative_humidity");
-
-    Real nh3ppt = input.get("xi_nh3");
-    Real so4vol = input.get("c_h2so4");
-
-    Real zmid = input.get("height");
-    Real pblh = input.get("planetary_boundary_layer_height");
+  // Gather the inputs of all members, so that the ensemble is run in a
+  // single kernel launch with one box per member.
+  std::vector<Input> inputs;
+  ensemble->process([&](const Input &input, Output &output) {
+    inputs.push_back(input);
+  });
+  const int num_members = static_cast<int>(inputs.size());
+  DeviceType::view_1d<Real> temp("temperature", num_members),
+      relhumnn("relative_humidity", num_members),
+      nh3ppt("xi_nh3", num_members), so4vol("c_h2so4", num_members),
+      zmid("height", num_members),
+      pblh("planetary_boundary_layer_height", num_members),
+      dnclusterdt("dnclusterdt", num_members);
+  auto h_temp = Kokkos::create_mirror_view(temp);
+  auto h_relhumnn = Kokkos::create_mirror_view(relhumnn);
+  auto h_nh3ppt = Kokkos::create_mirror_view(nh3ppt);
+  auto h_so4vol = Kokkos::create_mirror_view(so4vol);
+  auto h_zmid = Kokkos::create_mirror_view(zmid);
+  auto h_pblh = Kokkos::create_mirror_view(pblh);
+  for (int m = 0; m < num_members; ++m) {
+    const Input &input = inputs[m];
+    h_temp(m) = input.get("temperature");
+    h_relhumnn(m) = input.get("relative_humidity");
+    h_nh3ppt(m) = input.get("xi_nh3");
+    h_so4vol(m) = input.get("c_h2so4");
+    h_zmid(m) = input.get("height");
+    h_pblh(m) = input.get("planetary_boundary_layer_height");
+  }
+  Kokkos::deep_copy(temp, h_temp);
+  Kokkos::deep_copy(relhumnn, h_relhumnn);
+  Kokkos::deep_copy(nh3ppt, h_nh3ppt);
+  Kokkos::deep_copy(so4vol, h_so4vol);
+  Kokkos::deep_copy(zmid, h_zmid);
+  Kokkos::deep_copy(pblh, h_pblh);
 
-    // Call the nucleation function on device.
-    Real dnclusterdt;
-    Kokkos::parallel_reduce(
-        "mer07_veh02_wang08_nuc_1box", 1,
-        KOKKOS_LAMBDA(int i, Real &dnclusterdt) {
-          int newnuc_method_actual, pbl_nuc_wang2008_actual;
-          Real temp_dnclusterdt, rateloge, cnum_h2so4, cnum_nh3, radius_cluster;
-          nucleation::mer07_veh02_wang08_nuc_1box(
-              newnuc_method_user_choice, newnuc_method_actual,
-              pbl_nuc_wang2008_user_choice, pbl_nuc_wang2008_actual,
-              ln_nuc_rate_cutoff, adjust_factor_bin_tern_ratenucl,
-              adjust_factor_pbl_ratenucl, pi, so4vol, nh3ppt, temp, relhumnn,
-              zmid, pblh, temp_dnclusterdt, rateloge, cnum_h2so4, cnum_nh3,
-              radius_cluster);
-          dnclusterdt = temp_dnclusterdt;
-        },
-        Kokkos::Max<Real>(dnclusterdt));
+  // Call the nucleation function on device for every member.
+  Kokkos::parallel_for(
+      "mer07_veh02_wang08_nuc_1box", num_members, KOKKOS_LAMBDA(int m) {
+        int newnuc_method_actual, pbl_nuc_wang2008_actual;
+        Real rateloge, cnum_h2so4, cnum_nh3, radius_cluster;
+        nucleation::mer07_veh02_wang08_nuc_1box(
+            newnuc_method_user_choice, newnuc_method_actual,
+            pbl_nuc_wang2008_user_choice, pbl_nuc_wang2008_actual,
+            ln_nuc_rate_cutoff, adjust_factor_bin_tern_ratenucl,
+            adjust_factor_pbl_ratenucl, pi, so4vol(m), nh3ppt(m), temp(m),
+            relhumnn(m), zmid(m), pblh(m), dnclusterdt(m), rateloge,
+            cnum_h2so4, cnum_nh3, radius_cluster);
+      });
+  auto h_dnclusterdt = Kokkos::create_mirror_view(dnclusterdt);
+  Kokkos::deep_copy(h_dnclusterdt, dnclusterdt);
 
-    // Process output
-    Real J_cm3s = dnclusterdt * 1e-6;
+  // Process output
+  int member = 0;
+  ensemble->process([&](const Input &input, Output &output) {
+    Real J_cm3s = h_dnclusterdt(member) * 1e-6;
     output.set("nucleation_rate", J_cm3s);
+    ++member;
   });
 }
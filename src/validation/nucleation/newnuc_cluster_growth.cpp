@@ -11,10 +11,23 @@
 #include <validation.hpp>
 
 #include <iostream>
+#include <vector>
 
 using namespace skywalker;
 using namespace mam4;
 
+namespace {
+// inputs and outputs of newnuc_cluster_growth for one ensemble member
+struct ClusterGrowthBox {
+  Real dnclusterdt, cnum_h2so4, cnum_nh3, radius_cluster;
+  Real dplom_mode[1], dphim_mode[1];
+  int nsize;
+  Real deltat, temp, relhumnn, cair, accom_coef_h2so4, mw_so4a_host;
+  Real qnh3_cur, qh2so4_cur, so4vol, tmp_uptkrate;
+  Real qh2so4_del, qnh3_del, qso4a_del, qnh4a_del, qnuma_del;
+};
+} // namespace
+
 void newnuc_cluster_growth(Ensemble *ensemble) {
   constexpr Real rgas = Constants::r_gas; // [J/K/mol]
   constexpr Real pi = Constants::pi;
@@ -25,66 +38,70 @@ void newnuc_cluster_growth(Ensemble *ensemble) {
   // We don't need any settings for this particular test.
   // Settings settings = ensemble->settings();
 
-  // Run the ensemble.
-  ensemble->process([=](const Input &input, Output &output) {
+  // Gather the inputs of all members, so that the ensemble is run in a
+  // single kernel launch with one box per member.
+  std::vector<ClusterGrowthBox> host_boxes;
+  ensemble->process([&](const Input &input, Output &output) {
     // Fetch ensemble parameters
+    ClusterGrowthBox box = {};
+    box.dnclusterdt = input.get("dnclusterdt");
+    box.cnum_h2so4 = input.get("cnum_h2so4");
+    box.cnum_nh3 = input.get("cnum_nh3");
+    box.radius_cluster = input.get("radius_cluster");
 
-    Real dnclusterdt = input.get("dnclusterdt");
-    Real cnum_h2so4 = input.get("cnum_h2so4");
-    Real cnum_nh3 = input.get("cnum_nh3");
-    Real radius_cluster = input.get("radius_cluster");
-
-    Real dplom_mode[1] = {input.get("dplom_mode")};
-    Real dphim_mode[1] = {input.get("dphim_mode")};
-    int nsize = static_cast<int>(input.get("nsize"));
+    box.dplom_mode[0] = input.get("dplom_mode");
+    box.dphim_mode[0] = input.get("dphim_mode");
+    box.nsize = static_cast<int>(input.get("nsize"));
 
-    Real deltat = input.get("deltat");
-    Real temp = input.get("temperature");
-    Real relhumnn = input.get("relative_humidity");
+    box.deltat = input.get("deltat");
+    box.temp = input.get("temperature");
+    box.relhumnn = input.get("relative_humidity");
 
-    Real pmid = input.get("pmid");
-    Real cair = pmid / (temp * rgas);
+    const Real pmid = input.get("pmid");
+    box.cair = pmid / (box.temp * rgas);
 
-    Real accom_coef_h2so4 = input.get("accom_coef_h2so4");
-    Real mw_so4a_host = input.get("mw_so4a_host");
+    box.accom_coef_h2so4 = input.get("accom_coef_h2so4");
+    box.mw_so4a_host = input.get("mw_so4a_host");
 
-    Real qnh3_cur = input.get("qnh3_cur");
-    Real qh2so4_cur = input.get("qh2so4_cur");
-    Real so4vol = input.get("so4vol");
-    Real tmp_uptkrate = input.get("tmp_uptkrate");
+    box.qnh3_cur = input.get("qnh3_cur");
+    box.qh2so4_cur = input.get("qh2so4_cur");
+    box.so4vol = input.get("so4vol");
+    box.tmp_uptkrate = input.get("tmp_uptkrate");
+    host_boxes.push_back(box);
+  });
+  const int num_members = static_cast<int>(host_boxes.size());
+  DeviceType::view_1d<ClusterGrowthBox> boxes("newnuc_cluster_growth",
+                                              num_members);
+  auto h_boxes = Kokkos::create_mirror_view(boxes);
+  for (int m = 0; m < num_members; ++m)
+    h_boxes(m) = host_boxes[m];
+  Kokkos::deep_copy(boxes, h_boxes);
 
-    // Call the cluster growth function on device.
-    DeviceType::view_1d<Real> return_vals("Return from Device", 5);
-    Kokkos::parallel_for(
-        "newnuc_cluster_growth", 1, KOKKOS_LAMBDA(int i) {
-          // computed outputs
-          int isize_group;
-          Real dens_nh4so4a, qh2so4_del, qnh3_del, qso4a_del, qnh4a_del,
-              qnuma_del;
-          nucleation::newnuc_cluster_growth(
-              dnclusterdt, cnum_h2so4, cnum_nh3, radius_cluster, dplom_mode,
-              dphim_mode, nsize, deltat, temp, relhumnn, cair, accom_coef_h2so4,
-              mw_so4a, mw_so4a_host, mw_nh4a, avogadro, pi, qnh3_cur,
-              qh2so4_cur, so4vol, tmp_uptkrate, isize_group, dens_nh4so4a,
-              qh2so4_del, qnh3_del, qso4a_del, qnh4a_del, qnuma_del);
-          return_vals[0] = qh2so4_del;
-          return_vals[1] = qnh3_del;
-          return_vals[2] = qso4a_del;
-          return_vals[3] = qnh4a_del;
-          return_vals[4] = qnuma_del;
-        });
-    auto host_vals = Kokkos::create_mirror_view(return_vals);
-    Kokkos::deep_copy(host_vals, return_vals);
-    const Real qh2so4_del = host_vals[0];
-    const Real qnh3_del = host_vals[1];
-    const Real qso4a_del = host_vals[2];
-    const Real qnh4a_del = host_vals[3];
-    const Real qnuma_del = host_vals[4];
+  // Call the cluster growth function on device for every member.
+  Kokkos::parallel_for(
+      "newnuc_cluster_growth", num_members, KOKKOS_LAMBDA(int m) {
+        ClusterGrowthBox &b = boxes(m);
+        // computed outputs
+        int isize_group;
+        Real dens_nh4so4a;
+        nucleation::newnuc_cluster_growth(
+            b.dnclusterdt, b.cnum_h2so4, b.cnum_nh3, b.radius_cluster,
+            b.dplom_mode, b.dphim_mode, b.nsize, b.deltat, b.temp, b.relhumnn,
+            b.cair, b.accom_coef_h2so4, mw_so4a, b.mw_so4a_host, mw_nh4a,
+            avogadro, pi, b.qnh3_cur, b.qh2so4_cur, b.so4vol, b.tmp_uptkrate,
+            isize_group, dens_nh4so4a, b.qh2so4_del, b.qnh3_del, b.qso4a_del,
+            b.qnh4a_del, b.qnuma_del);
+      });
+  Kokkos::deep_copy(h_boxes, boxes);
 
-    output.set("qh2so4_del", qh2so4_del);
-    output.set("qnh3_del", qnh3_del);
-    output.set("qso4a_del", qso4a_del);
-    output.set("qnh4a_del", qnh4a_del);
-    output.set("qnuma_del", qnuma_del);
+  int member = 0;
+  ensemble->process([&](const Input &input, Output &output) {
+    const ClusterGrowthBox &b = h_boxes(member);
+    output.set("qh2so4_del", b.qh2so4_del);
+    output.set("qnh3_del", b.qnh3_del);
+    output.set("qso4a_del", b.qso4a_del);
+    output.set("qnh4a_del", b.qnh4a_del);
+    output.set("qnuma_del", b.qnuma_del);
+    ++member;
   });
 }
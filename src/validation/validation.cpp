@@ -5,6 +5,12 @@
 
 #include "validation.hpp"
 
+#include <mam4xx/column_storage.hpp>
+
+#include <ekat/ekat_assert.hpp>
+
+#include <algorithm>
+
 namespace mam4 {
 namespace validation {
 
@@ -32,6 +38,73 @@ std::string output_name(const std::string &input_file) {
          std::string(".py");
 }
 
+std::string npy_output_prefix(const std::string &input_file) {
+  const std::string module = output_name(input_file);
+  return module.substr(0, module.length() - 3); // strip ".py"
+}
+
+// .npy files have a fixed-size header (a multiple of 64 bytes) so the final
+// shape can be written in place once all members have been appended
+static constexpr std::size_t npy_header_size = 128;
+
+NpyWriter::NpyWriter(const std::string &prefix) : prefix_(prefix) {}
+
+NpyWriter::~NpyWriter() { close(); }
+
+void NpyWriter::append(const std::string &name,
+                       const std::vector<Real> &values) {
+  auto iter = files_.find(name);
+  if (iter == files_.end()) {
+    const std::string filename = prefix_ + "_" + name + ".npy";
+    iter = files_.emplace(name, File()).first;
+    File &file = iter->second;
+    file.stream.open(filename, std::ios::binary);
+    EKAT_REQUIRE_MSG(file.stream, "NpyWriter: could not open " << filename);
+    file.num_columns = values.size();
+    file.num_rows = 0;
+    write_header_(file);
+  }
+  File &file = iter->second;
+  EKAT_REQUIRE_MSG(values.size() == file.num_columns,
+                   "NpyWriter: expected " << file.num_columns
+                                          << " values for " << name << ", got "
+                                          << values.size());
+  file.stream.write(reinterpret_cast<const char *>(values.data()),
+                    values.size() * sizeof(Real));
+  ++file.num_rows;
+}
+
+void NpyWriter::close() {
+  for (auto &entry : files_) {
+    File &file = entry.second;
+    if (file.stream.is_open()) {
+      file.stream.seekp(0);
+      write_header_(file);
+      file.stream.close();
+    }
+  }
+}
+
+void NpyWriter::write_header_(File &file) {
+  // format version 1.0: magic string, version, header length, and a Python
+  // dict describing the (little-endian) array, padded with spaces
+  const char *descr = (sizeof(Real) == 8) ? "<f8" : "<f4";
+  std::string dict = std::string("{'descr': '") + descr +
+                     "', 'fortran_order': False, 'shape': (" +
+                     std::to_string(file.num_rows) + ", " +
+                     std::to_string(file.num_columns) + "), }";
+  const std::size_t dict_size = npy_header_size - 10;
+  dict.resize(dict_size - 1, ' ');
+  dict += '\n';
+  const char preamble[8] = {'\x93', 'N', 'U', 'M', 'P', 'Y', 1, 0};
+  const unsigned char length[2] = {
+      static_cast<unsigned char>(dict_size & 0xff),
+      static_cast<unsigned char>(dict_size >> 8)};
+  file.stream.write(preamble, sizeof(preamble));
+  file.stream.write(reinterpret_cast<const char *>(length), sizeof(length));
+  file.stream.write(dict.data(), dict.size());
+}
+
 void convert_vector_to_mass_mixing_ratios(
     const std::vector<Real> &vector_in,
     Real values[AeroConfig::num_modes()][AeroConfig::num_aerosol_ids()]) {
@@ -127,5 +200,108 @@ void convert_2d_view_device_to_1d_vector(const View2D &var_device,
   }
 }
 
+std::vector<MemberBatch> member_batches(const int num_members) {
+  std::vector<MemberBatch> batches;
+  for (int begin = 0; begin < num_members; begin += max_batch_size)
+    batches.push_back({begin, std::min(begin + max_batch_size, num_members)});
+  return batches;
+}
+
+ColumnView ColumnPool::column_view(const int num_values) {
+  if (blocks_.empty() ||
+      block_used_ + num_values > blocks_.back().extent_int(0)) {
+    blocks_.push_back(DeviceType::view_1d<Real>(
+        "validation::ColumnPool", std::max(num_values, block_size)));
+    host_blocks_.push_back(Kokkos::create_mirror_view(blocks_.back()));
+    block_used_ = 0;
+  }
+  const ColumnView v(blocks_.back().data() + block_used_, num_values);
+  block_used_ += num_values;
+  return v;
+}
+
+Real *ColumnPool::host_(const Real *data) const {
+  for (std::size_t b = 0; b < blocks_.size(); ++b) {
+    const Real *begin = blocks_[b].data();
+    if (begin <= data && data < begin + blocks_[b].extent(0))
+      return host_blocks_[b].data() + (data - begin);
+  }
+  EKAT_REQUIRE_MSG(false, "ColumnPool: view not created by this pool");
+  return nullptr;
+}
+
+void ColumnPool::set_host(const haero::ConstColumnView &v,
+                          const std::vector<Real> &values) const {
+  EKAT_REQUIRE_MSG(values.size() == v.extent(0),
+                   "ColumnPool: expected " << v.extent(0) << " values, got "
+                                           << values.size());
+  std::copy(values.begin(), values.end(), host(v));
+}
+
+void ColumnPool::set_host_tracers(const Diagnostics::ColumnTracerView &v,
+                                  const std::vector<Real> &values) const {
+  EKAT_REQUIRE_MSG(values.size() == v.size(),
+                   "ColumnPool: expected " << v.size() << " values, got "
+                                           << values.size());
+  const HostTracerView h(host(v), v.extent(0), v.extent(1));
+  for (int j = 0, n = 0; j < v.extent_int(1); ++j)
+    for (int i = 0; i < v.extent_int(0); ++i, ++n)
+      h(i, j) = values[n];
+}
+
+std::vector<Real> ColumnPool::get_host(const haero::ConstColumnView &v) const {
+  const Real *h = host(v);
+  return std::vector<Real>(h, h + v.extent(0));
+}
+
+std::vector<Real>
+ColumnPool::get_host_tracers(const Diagnostics::ColumnTracerView &v) const {
+  const HostTracerView h(host(v), v.extent(0), v.extent(1));
+  std::vector<Real> values(v.size());
+  for (int j = 0, n = 0; j < v.extent_int(1); ++j)
+    for (int i = 0; i < v.extent_int(0); ++i, ++n)
+      values[n] = h(i, j);
+  return values;
+}
+
+void ColumnPool::zero_host() {
+  for (const auto &h : host_blocks_)
+    Kokkos::deep_copy(h, 0.0);
+}
+
+void ColumnPool::copy_to_device() {
+  for (std::size_t b = 0; b < blocks_.size(); ++b)
+    Kokkos::deep_copy(blocks_[b], host_blocks_[b]);
+}
+
+void ColumnPool::copy_to_host() {
+  for (std::size_t b = 0; b < blocks_.size(); ++b)
+    Kokkos::deep_copy(host_blocks_[b], blocks_[b]);
+}
+
+BatchColumns::BatchColumns(const int num_levels, const Real pblh,
+                           const FieldSet fields)
+    : atm("validation::atm", max_batch_size),
+      sfc("validation::sfc", max_batch_size),
+      progs("validation::progs", max_batch_size),
+      diags("validation::diags", max_batch_size),
+      tends("validation::tends", max_batch_size) {
+  h_atm = Kokkos::create_mirror_view(atm);
+  h_progs = Kokkos::create_mirror_view(progs);
+  h_diags = Kokkos::create_mirror_view(diags);
+  h_tends = Kokkos::create_mirror_view(tends);
+  const auto column_view = [&](const int n) { return pool.column_view(n); };
+  for (int icol = 0; icol < max_batch_size; ++icol) {
+    h_atm(icol) = mam4::create_atmosphere(num_levels, pblh, column_view);
+    h_progs(icol) = mam4::create_prognostics(num_levels, column_view);
+    h_diags(icol) = mam4::create_diagnostics(num_levels, fields, column_view);
+    h_tends(icol) = mam4::create_prognostics(num_levels, column_view);
+  }
+  Kokkos::deep_copy(atm, h_atm);
+  Kokkos::deep_copy(progs, h_progs);
+  Kokkos::deep_copy(diags, h_diags);
+  Kokkos::deep_copy(tends, h_tends);
+}
+
 } // namespace validation
 } // namespace mam4
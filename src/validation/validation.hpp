@@ -8,7 +8,11 @@
 #include <haero/testing.hpp>
 #include <mam4xx/aero_config.hpp>
 #include <mam4xx/mo_photo.hpp>
+
+#include <fstream>
+#include <map>
 #include <string>
+#include <vector>
 
 namespace mam4 {
 
@@ -42,6 +46,45 @@ void finalize();
 /// @param [in] input_file The name of the Skywalker input YAML file.
 std::string output_name(const std::string &input_file);
 
+/// Given the name of a Skywalker input YAML file, determine the prefix of the
+/// names of the corresponding NumPy (.npy) output files written by NpyWriter.
+/// @param [in] input_file The name of the Skywalker input YAML file.
+std::string npy_output_prefix(const std::string &input_file);
+
+/// NpyWriter streams the outputs of ensemble members to NumPy .npy files as
+/// they are computed, instead of holding them until a Python module is
+/// written. Each named output goes to <prefix>_<name>.npy, a 2D array with a
+/// row per member, which numpy.load reads (or memory-maps) directly.
+class NpyWriter {
+public:
+  /// Creates a writer whose files are named with the given prefix
+  explicit NpyWriter(const std::string &prefix);
+
+  /// Finishes writing all files (see close)
+  ~NpyWriter();
+
+  NpyWriter(const NpyWriter &) = delete;
+  NpyWriter &operator=(const NpyWriter &) = delete;
+
+  /// Appends the values of the named output for the next member. Every member
+  /// must have the same number of values for a given output.
+  void append(const std::string &name, const std::vector<Real> &values);
+
+  /// Writes the final array shapes and closes all files
+  void close();
+
+private:
+  struct File {
+    std::ofstream stream;
+    std::size_t num_columns;
+    std::size_t num_rows;
+  };
+  static void write_header_(File &file);
+
+  std::string prefix_;
+  std::map<std::string, File> files_;
+};
+
 /// The E3SM code has different indexing than mam4xx for the aerosol species in
 // the accumulation, aitken, coarse, and primary carbon modes.
 //  Therefore for validation proposes, we need to convert the index of the
@@ -136,6 +179,104 @@ void convert_1d_vector_to_2d_view_device(const std::vector<Real> &pmid_db,
 // to 1D std::vector
 void convert_2d_view_device_to_1d_vector(const View2D &var_device,
                                          std::vector<Real> &var_std);
+
+// Batched validation: the members of an ensemble are processed in batches of
+// consecutive members (in input order), each member being a column of a
+// multi-column state, so that a batch runs with one kernel launch per process
+// and one host/device transfer per block of column data instead of one of
+// each per member.
+
+/// Maximum number of members in a batch
+constexpr int max_batch_size = 512;
+
+/// A batch of the consecutive ensemble members with indices in [begin, end)
+struct MemberBatch {
+  int begin, end;
+  int size() const { return end - begin; }
+};
+
+/// Returns the batches of at most max_batch_size members that cover an
+/// ensemble with the given number of members, in order
+std::vector<MemberBatch> member_batches(int num_members);
+
+/// ColumnPool creates column views in large device blocks with host copies, so
+/// the columns of a batch are filled on the host, copied to the device, and
+/// read back with one transfer per block.
+class ColumnPool {
+public:
+  ColumnPool() = default;
+  ColumnPool(const ColumnPool &) = delete;
+  ColumnPool &operator=(const ColumnPool &) = delete;
+
+  /// Returns a new column view of the given number of values
+  ColumnView column_view(int num_values);
+
+  /// Returns the host copy of the values of the given view created by the pool
+  template <typename View> Real *host(const View &v) const {
+    return host_(v.data());
+  }
+
+  /// Sets the host copy of the values of the given column view
+  void set_host(const haero::ConstColumnView &v,
+                const std::vector<Real> &values) const;
+
+  /// Sets the host copy of the values of the given (level, tracer) view from
+  /// values in column-major (Fortran) order, as E3SM writes them
+  void set_host_tracers(const Diagnostics::ColumnTracerView &v,
+                        const std::vector<Real> &values) const;
+
+  /// Returns the host copy of the values of the given column view
+  std::vector<Real> get_host(const haero::ConstColumnView &v) const;
+
+  /// Returns the host copy of the values of the given (level, tracer) view in
+  /// column-major (Fortran) order
+  std::vector<Real>
+  get_host_tracers(const Diagnostics::ColumnTracerView &v) const;
+
+  /// Zeroes the host copies of all values
+  void zero_host();
+
+  /// Copies the host copies of all values to the device
+  void copy_to_device();
+
+  /// Copies all values from the device to their host copies
+  void copy_to_host();
+
+private:
+  // host copies of (level, tracer) views, with their layout
+  using HostTracerView =
+      Kokkos::View<Real **, Diagnostics::ColumnTracerView::array_layout,
+                   Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
+
+  Real *host_(const Real *data) const;
+
+  static constexpr int block_size = 1 << 20;
+  std::vector<DeviceType::view_1d<Real>> blocks_;
+  std::vector<DeviceType::view_1d<Real>::HostMirror> host_blocks_;
+  int block_used_ = 0; // number of values used in the last block
+};
+
+/// BatchColumns holds the state of up to max_batch_size member columns with
+/// the given number of levels, created in a ColumnPool: the atmosphere,
+/// surface, prognostics, diagnostics (only the given groups of fields), and
+/// tendencies of each column, on the device and on the host (with views of
+/// device data whose values are accessed with pool.host).
+struct BatchColumns {
+  BatchColumns(int num_levels, Real pblh,
+               FieldSet fields = diagnostic_fields);
+
+  ColumnPool pool;
+  DeviceType::view_1d<haero::Atmosphere> atm;
+  DeviceType::view_1d<haero::Surface> sfc;
+  DeviceType::view_1d<Prognostics> progs;
+  DeviceType::view_1d<Diagnostics> diags;
+  DeviceType::view_1d<Tendencies> tends;
+  DeviceType::view_1d<haero::Atmosphere>::HostMirror h_atm;
+  DeviceType::view_1d<Prognostics>::HostMirror h_progs;
+  DeviceType::view_1d<Diagnostics>::HostMirror h_diags;
+  DeviceType::view_1d<Tendencies>::HostMirror h_tends;
+};
+
 } // namespace validation
 } // namespace mam4
 
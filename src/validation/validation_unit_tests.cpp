@@ -0,0 +1,98 @@
+// mam4xx: Copyright (c) 2022,
+// Battelle Memorial Institute and
+// National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <validation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace mam4;
+
+namespace {
+
+// the header and data of a NumPy .npy file (format version 1.0)
+struct NpyFile {
+  std::string magic;
+  int major_version, minor_version;
+  std::size_t header_length; // length of the preamble and the array dict
+  std::string dict;          // Python dict describing the array
+  std::vector<Real> data;
+};
+
+// reads a .npy file written by NpyWriter
+NpyFile read_npy(const std::string &filename) {
+  std::ifstream stream(filename, std::ios::binary);
+  const std::string bytes((std::istreambuf_iterator<char>(stream)),
+                          std::istreambuf_iterator<char>());
+  NpyFile file;
+  file.magic = bytes.substr(0, 6);
+  file.major_version = bytes[6];
+  file.minor_version = bytes[7];
+  const std::size_t dict_size = static_cast<unsigned char>(bytes[8]) |
+                                (static_cast<unsigned char>(bytes[9]) << 8);
+  file.header_length = 10 + dict_size;
+  file.dict = bytes.substr(10, dict_size);
+  file.data.resize((bytes.size() - file.header_length) / sizeof(Real));
+  std::memcpy(file.data.data(), bytes.data() + file.header_length,
+              file.data.size() * sizeof(Real));
+  return file;
+}
+
+} // namespace
+
+TEST_CASE("npy_writer_round_trip", "validation") {
+  const std::string prefix = "validation_unit_tests";
+  const std::vector<std::vector<Real>> rows = {
+      {1.0, -2.5, 3.0e-20, 4.0}, {5.0, 6.0, 7.0, 8.0}, {0.0, 1.0e300, -0.0, 9}};
+  {
+    validation::NpyWriter writer(prefix);
+    for (const auto &row : rows) {
+      writer.append("values", row);
+      writer.append("first", {row[0]});
+    }
+  } // the destructor finishes the files
+
+  // a 3 x 4 array of the appended rows, in row-major order
+  const NpyFile values = read_npy(prefix + "_values.npy");
+  REQUIRE(values.magic == "\x93NUMPY");
+  REQUIRE(values.major_version == 1);
+  REQUIRE(values.minor_version == 0);
+  // the data are aligned on 64 bytes, and the dict ends with a newline
+  REQUIRE(values.header_length % 64 == 0);
+  REQUIRE(values.dict.back() == '\n');
+  const std::string descr = (sizeof(Real) == 8) ? "<f8" : "<f4";
+  REQUIRE(values.dict.find("'descr': '" + descr + "'") != std::string::npos);
+  REQUIRE(values.dict.find("'fortran_order': False") != std::string::npos);
+  REQUIRE(values.dict.find("'shape': (3, 4)") != std::string::npos);
+  REQUIRE(values.data.size() == 12);
+  bool data_match = true;
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j)
+      data_match = data_match && (values.data[4 * i + j] == rows[i][j]);
+  REQUIRE(data_match);
+
+  // a 3 x 1 array of the first values of the rows
+  const NpyFile first = read_npy(prefix + "_first.npy");
+  REQUIRE(first.header_length % 64 == 0);
+  REQUIRE(first.dict.find("'shape': (3, 1)") != std::string::npos);
+  REQUIRE(first.data.size() == 3);
+  REQUIRE(first.data[0] == 1.0);
+  REQUIRE(first.data[1] == 5.0);
+  REQUIRE(first.data[2] == 0.0);
+
+  std::remove((prefix + "_values.npy").c_str());
+  std::remove((prefix + "_first.npy").c_str());
+}
+
+TEST_CASE("npy_output_prefix", "validation") {
+  REQUIRE(validation::npy_output_prefix("some/dir/calcsize_e3sm.yaml") ==
+          "mam4xx_calcsize_e3sm");
+}